@@ -0,0 +1,17 @@
+# Writes a hash of the plugin sources to a header, so that the incremental runs of a plugin built from other sources
+# generate every unit again instead of keeping those of the previous build
+#
+# Usage: cmake -DSOURCES=<source>|<source>... -DOUTPUT=<header> -P GeneratorVersion.cmake
+
+string(REPLACE "|" ";" SOURCES "${SOURCES}")
+set(hashes "")
+foreach(source ${SOURCES})
+    file(SHA256 "${source}" hash)
+    string(APPEND hashes "${hash}")
+endforeach()
+string(SHA256 version "${hashes}")
+string(SUBSTRING "${version}" 0 16 version)
+file(WRITE "${OUTPUT}.tmp" "#define DELPHI_GENERATOR_VERSION \"${version}\"\n")
+# the header keeps its timestamp when the hash is unchanged, so that nothing is rebuilt
+execute_process(COMMAND "${CMAKE_COMMAND}" -E copy_if_different "${OUTPUT}.tmp" "${OUTPUT}")
+file(REMOVE "${OUTPUT}.tmp")
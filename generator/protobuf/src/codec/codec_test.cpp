@@ -0,0 +1,554 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/util/message_differencer.h>
+
+#include "addressbook.pb.h"
+#include "config.pb.h"
+#include "envelope.pb.h"
+#include "message.pb.h"
+#include "presence.pb.h"
+#include "relay.pb.h"
+#include "sensor.pb.h"
+
+#include "Schema.Addressbook.Proto.layout.h"
+#include "Schema.Config.Proto.layout.h"
+#include "Schema.Envelope.Proto.layout.h"
+#include "Schema.Message.Proto.layout.h"
+#include "Schema.Presence.Proto.layout.h"
+#include "Schema.Relay.Proto.layout.h"
+#include "Schema.Sensor.Proto.layout.h"
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        if (!(condition)) {                                                                 \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                                     \
+        }                                                                                   \
+    } while (0)
+
+// strings and dynamic arrays laid out as by the Delphi memory manager, which keeps their length just ahead of their
+// first element, with every block released along with the heap
+class DelphiHeap
+{
+public:
+    DelphiHeap()
+        : allocator{this, SetLength, SetString, SetBytes}
+    {
+    }
+
+    dsc_allocator allocator;
+
+    static size_t GetLength(const void *array)
+    {
+        return array ? static_cast<const intptr_t *>(array)[-1] : 0;
+    }
+
+    static std::u16string GetString(const void *chars)
+    {
+        const auto data = static_cast<const char16_t *>(chars);
+        return chars ? std::u16string(data, static_cast<const int32_t *>(chars)[-1]) : std::u16string();
+    }
+
+private:
+    uint8_t *Allocate(size_t header, size_t size)
+    {
+        _blocks.emplace_back(new uint8_t[header + size]());
+        return _blocks.back().get() + header;
+    }
+
+    static void SetLength(void *context, void **array, size_t length, size_t elementsize, const dsc_message *,
+                          const dsc_field *)
+    {
+        const auto data = static_cast<DelphiHeap *>(context)->Allocate(2 * sizeof(intptr_t), length * elementsize);
+        reinterpret_cast<intptr_t *>(data)[-1] = length;
+        if (*array) {
+            std::memcpy(data, *array, std::min(GetLength(*array), length) * elementsize);
+        }
+        *array = length > 0 ? data : nullptr;
+    }
+
+    static void SetString(void *context, void **string, const uint16_t *chars, size_t length)
+    {
+        const auto data = static_cast<DelphiHeap *>(context)->Allocate(sizeof(intptr_t) + 8, 2 * (length + 1));
+        reinterpret_cast<int32_t *>(data)[-1] = static_cast<int32_t>(length);
+        if (length > 0) {
+            std::memcpy(data, chars, 2 * length);
+        }
+        *string = length > 0 ? data : nullptr;
+    }
+
+    static void SetBytes(void *context, void **bytes, const uint8_t *data, size_t size)
+    {
+        *bytes = nullptr;
+        SetLength(context, bytes, size, 1, nullptr, nullptr);
+        if (size > 0) {
+            std::memcpy(*bytes, data, size);
+        }
+    }
+
+    std::vector<std::unique_ptr<uint8_t[]>> _blocks;
+};
+
+const uint8_t *GetField(const dsc_message &message, const void *record, uint32_t number)
+{
+    for (uint32_t i = 0; i < message.field_count; ++i) {
+        if (message.fields[i].number == number) {
+            return static_cast<const uint8_t *>(record) + message.fields[i].offset;
+        }
+    }
+    return nullptr;
+}
+
+template <typename T>
+T Load(const uint8_t *value)
+{
+    T result;
+    std::memcpy(&result, value, sizeof(T));
+    return result;
+}
+
+// decodes the input into a Delphi record, and encodes the record back
+std::string Recode(const dsc_message &message, const std::string &input, DelphiHeap &heap,
+                   std::vector<uint64_t> &record)
+{
+    record.assign(message.size / sizeof(uint64_t) + 1, 0);
+    const auto data = reinterpret_cast<const uint8_t *>(input.data());
+    CHECK(dsc_decode(&message, record.data(), data, input.size(), &heap.allocator) == DSC_OK);
+    std::string output(dsc_encoded_size(&message, record.data()), '\0');
+    size_t written;
+    CHECK(dsc_encode(&message, record.data(), reinterpret_cast<uint8_t *>(&output[0]), output.size(), &written)
+          == DSC_OK);
+    CHECK(written == output.size());
+    return output;
+}
+
+void TestAddressBook()
+{
+    AddressBook addressbook;
+    auto person = addressbook.add_people();
+    person->set_name("abc");
+    person->set_id(1);
+    person->set_email("e\xC3\xA9\xF0\x9F\x98\x80");
+    person->mutable_last_updated()->set_seconds(-1);
+    person->mutable_last_updated()->set_nanos(2);
+    person = addressbook.add_people();
+    person->set_id(300);
+    auto phone = person->add_phones();
+    phone->set_number("123");
+    phone->set_type(Person::WORK);
+    person->add_phones()->set_number("456");
+    const auto expected = addressbook.SerializeAsString();
+
+    using namespace Schema::Addressbook::Proto;
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TAddressBook, expected, heap, record) == expected);
+    const auto people = Load<const uint8_t *>(GetField(TAddressBook, record.data(), 1));
+    CHECK(DelphiHeap::GetLength(people) == 2);
+    CHECK(DelphiHeap::GetString(Load<const void *>(GetField(TPerson, people, 1))) == u"abc");
+    CHECK(DelphiHeap::GetString(Load<const void *>(GetField(TPerson, people, 3))) == u"e\u00E9\U0001F600");
+    CHECK(Load<int64_t>(GetField(TGoogleProtobufTimestamp, GetField(TPerson, people, 5), 1)) == -1);
+    CHECK(Load<int32_t>(GetField(TPerson, people + TPerson.size, 2)) == 300);
+    CHECK(DelphiHeap::GetLength(Load<const void *>(GetField(TPerson, people + TPerson.size, 4))) == 2);
+}
+
+void TestMessage()
+{
+    Message message;
+    auto optional = message.add_optional();
+    optional->set_double_(0.5);
+    optional->set_int32(-1);
+    optional->set_sint32(-3);
+    optional->set_sfixed64(-4);
+    optional->set_bool_(true);
+    optional->set_string("a");
+    optional->set_bytes(std::string("\0\1", 2));
+    optional->set_enum_(VALUE2);
+    auto defaults = message.add_default_();
+    defaults->set_float_(0.25f);
+    defaults->set_uint64(UINT64_MAX);
+    auto required = message.add_required();
+    required->set_double_(0);
+    required->set_float_(0);
+    required->set_int32(0);
+    required->set_int64(0);
+    required->set_uint32(0);
+    required->set_uint64(0);
+    required->set_sint32(0);
+    required->set_sint64(0);
+    required->set_fixed32(0);
+    required->set_fixed64(0);
+    required->set_sfixed32(0);
+    required->set_sfixed64(0);
+    required->set_bool_(false);
+    required->set_string("");
+    required->set_bytes("");
+    required->set_enum_(VALUE0);
+    auto repeated = message.add_repeated();
+    repeated->add_int32(-1);
+    repeated->add_int32(300);
+    repeated->add_sint64(-2);
+    repeated->add_fixed32(3);
+    repeated->add_bool_(true);
+    repeated->add_bool_(false);
+    repeated->add_string("a");
+    repeated->add_string("");
+    repeated->add_bytes("");
+    repeated->add_enum_(VALUE2);
+    auto unpacked = message.add_unpacked();
+    unpacked->add_float_(0.1f);
+    unpacked->add_uint64(1);
+    unpacked->add_uint64(300);
+    unpacked->add_enum_(VALUE0);
+    const auto expected = message.SerializeAsString();
+
+    using namespace Schema::Message::Proto;
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TMessage, expected, heap, record) == expected);
+    const auto optionals = Load<const uint8_t *>(GetField(TMessage, record.data(), 1));
+    CHECK(Load<int32_t>(GetField(TOptional, optionals, 7)) == -3);
+    CHECK(*GetField(TOptional, optionals, 16) == VALUE2);
+
+    SparseValues sparse;
+    sparse.set_sparse(SPARSE_MINUS);
+    sparse.add_sparses(SPARSE_MILLION);
+    sparse.add_sparses(SPARSE_ZERO);
+    CHECK(Recode(TSparseValues, sparse.SerializeAsString(), heap, record) == sparse.SerializeAsString());
+}
+
+void TestMerge()
+{
+    // both encodings of packable fields are accepted, unknown fields are dropped, and repeated occurrences are merged
+    UnPacked unpacked;
+    unpacked.add_int32(-1);
+    unpacked.add_sint32(5);
+    unpacked.add_double_(0.5);
+    Repeated packed;
+    packed.add_int32(2);
+    packed.add_string("b");
+    const auto input = unpacked.SerializeAsString() + packed.SerializeAsString() + unpacked.SerializeAsString();
+    Repeated merged;
+    CHECK(merged.ParseFromString(input));
+
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(Schema::Message::Proto::TRepeated, input, heap, record) == merged.SerializeAsString());
+    UnPacked remerged;
+    CHECK(remerged.ParseFromString(input));
+    remerged.DiscardUnknownFields();
+    CHECK(Recode(Schema::Message::Proto::TUnPacked, input, heap, record) == remerged.SerializeAsString());
+
+    Person person;
+    person.set_name("abc");
+    person.set_email("e");
+    person.add_phones()->set_number("1");
+    Person::PhoneNumber phone;
+    CHECK(phone.ParseFromString(person.SerializeAsString()));
+    phone.DiscardUnknownFields();
+    CHECK(Recode(Schema::Addressbook::Proto::TPersonPhoneNumber, person.SerializeAsString(), heap, record)
+          == phone.SerializeAsString());
+
+    // a packed run of a singular field is skipped, as by libprotobuf, instead of being parsed into the field
+    const std::string run("\x1a\x02\x05\x07\x28\x09", 6);
+    Optional optional;
+    CHECK(optional.ParseFromString(run));
+    CHECK(!optional.has_int32() && optional.uint32() == 9);
+    optional.DiscardUnknownFields();
+    CHECK(Recode(Schema::Message::Proto::TOptional, run, heap, record) == optional.SerializeAsString());
+}
+
+void TestLazy()
+{
+    // lazy fields keep the encoding of their message, which is copied back as is and merged by concatenation
+    LazyFields lazy;
+    lazy.mutable_optional()->set_int32(-1);
+    lazy.mutable_optional()->set_string("a");
+    lazy.add_repeated()->add_string("b");
+    LazyFields more;
+    more.mutable_optional()->set_sint64(-2);
+    const auto input = lazy.SerializeAsString() + more.SerializeAsString();
+    LazyFields merged;
+    CHECK(merged.ParseFromString(input));
+
+    using namespace Schema::Message::Proto;
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TLazyFields, lazy.SerializeAsString(), heap, record) == lazy.SerializeAsString());
+    const auto optional = GetField(TLazyFields, record.data(), 1);
+    const auto encoded = Load<const uint8_t *>(optional + TOptional.size);
+    CHECK(DelphiHeap::GetLength(encoded) == lazy.optional().ByteSizeLong());
+    CHECK(optional[TOptional.size + sizeof(void *)] == 0);
+    CHECK(Load<int32_t>(GetField(TOptional, optional, 3)) == 0);
+
+    // once parsed, the value is encoded from the record instead, here an empty message that is omitted
+    const_cast<uint8_t *>(optional)[TOptional.size + sizeof(void *)] = 1;
+    std::string output(dsc_encoded_size(&TLazyFields, record.data()), '\0');
+    size_t written;
+    CHECK(dsc_encode(&TLazyFields, record.data(), reinterpret_cast<uint8_t *>(&output[0]), output.size(), &written)
+          == DSC_OK);
+    lazy.clear_optional();
+    CHECK(output == lazy.SerializeAsString());
+
+    LazyFields reparsed;
+    CHECK(reparsed.ParseFromString(Recode(TLazyFields, input, heap, record)));
+    CHECK(reparsed.SerializeAsString() == merged.SerializeAsString());
+}
+
+void TestPresence()
+{
+    // fields with presence are encoded when their bit is set, even if they hold zero, and only then
+    Presence presence;
+    presence.set_int32(0);
+    presence.set_bool_(false);
+    presence.set_string("");
+    presence.set_sint64(-1);
+    presence.set_implicit(0);
+    presence.set_first(0);
+    const auto expected = presence.SerializeAsString();
+
+    using namespace Schema::Presence::Proto;
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TPresence, expected, heap, record) == expected);
+    const auto bits = reinterpret_cast<uint8_t *>(record.data()) + TPresence.fields[0].case_offset;
+    CHECK(Load<uint32_t>(bits) == 0x4D);
+
+    // a value without its bit is left out
+    const auto one = 1.0;
+    std::memcpy(const_cast<uint8_t *>(GetField(TPresence, record.data(), 2)), &one, sizeof(one));
+    bits[0] = 0x4C;
+    std::string output(dsc_encoded_size(&TPresence, record.data()), '\0');
+    size_t written;
+    CHECK(dsc_encode(&TPresence, record.data(), reinterpret_cast<uint8_t *>(&output[0]), output.size(), &written)
+          == DSC_OK);
+    presence.clear_int32();
+    CHECK(output == presence.SerializeAsString());
+
+    WidePresence wide;
+    wide.set_alpha(0);
+    wide.set_hematite(0);
+    CHECK(Recode(TWidePresence, wide.SerializeAsString(), heap, record) == wide.SerializeAsString());
+    const auto words = reinterpret_cast<uint8_t *>(record.data()) + TWidePresence.size - 2 * sizeof(uint32_t);
+    CHECK(Load<uint32_t>(words) == 1);
+    CHECK(Load<uint32_t>(words + sizeof(uint32_t)) == 2);
+}
+
+void TestBoxed()
+{
+    // a boxed message is encoded whenever it is allocated, even if it is empty
+    using namespace Schema::Presence::Proto;
+    Presence presence;
+    presence.mutable_inner();
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TPresence, presence.SerializeAsString(), heap, record) == presence.SerializeAsString());
+    const auto box = Load<const uint8_t *>(GetField(TPresence, record.data(), 12));
+    CHECK(box != nullptr && DelphiHeap::GetLength(box) == 1);
+
+    presence.mutable_inner()->set_value(-5);
+    CHECK(Recode(TPresence, presence.SerializeAsString(), heap, record) == presence.SerializeAsString());
+    CHECK(Load<int32_t>(Load<const uint8_t *>(GetField(TPresence, record.data(), 12))) == -5);
+
+    // an absent message takes no memory beyond the pointer
+    presence.clear_inner();
+    CHECK(Recode(TPresence, presence.SerializeAsString(), heap, record).empty());
+    CHECK(Load<const uint8_t *>(GetField(TPresence, record.data(), 12)) == nullptr);
+}
+
+void TestOverlaid()
+{
+    // the members of the oneof that hold no managed values share the storage that follows the managed ones
+    using namespace Schema::Envelope::Proto;
+    CHECK(GetField(TEnvelope, nullptr, 2) == GetField(TEnvelope, nullptr, 5));
+    CHECK(GetField(TEnvelope, nullptr, 6) == GetField(TEnvelope, nullptr, 7));
+    CHECK(GetField(TEnvelope, nullptr, 3) != GetField(TEnvelope, nullptr, 4));
+    CHECK(TEnvelope.size == 56);
+
+    Envelope envelope;
+    envelope.set_id(1);
+    envelope.mutable_click()->set_x(0.5);
+    envelope.mutable_click()->set_time(-3);
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TEnvelope, envelope.SerializeAsString(), heap, record) == envelope.SerializeAsString());
+
+    // a message replacing another member starts from scratch, while one replacing itself is merged
+    Envelope first;
+    first.mutable_move()->set_x(1);
+    Envelope second;
+    second.set_code(-1);
+    Envelope third;
+    third.mutable_click()->set_y(2);
+    Envelope fourth;
+    fourth.mutable_click()->set_time(4);
+    const auto input = first.SerializeAsString() + second.SerializeAsString() + third.SerializeAsString()
+                     + fourth.SerializeAsString();
+    envelope.ParseFromString(input);
+    CHECK(Recode(TEnvelope, input, heap, record) == envelope.SerializeAsString());
+}
+
+void TestMaps()
+{
+    // a map record starts with its entries, which are decoded as a repeated message, and leaves the slots to Delphi
+    using namespace Schema::Config::Proto;
+    CHECK(GetField(TConfig, nullptr, 2) - GetField(TConfig, nullptr, 1) == 3 * sizeof(void *));
+
+    Config config;
+    (*config.mutable_settings())["a"] = "1";
+    (*config.mutable_settings())["b"] = "";
+    (*config.mutable_limits())[-1].set_high(5);
+    (*config.mutable_flags())[0] = true;
+    config.set_name("n");
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    Config recoded;
+    CHECK(recoded.ParseFromString(Recode(TConfig, config.SerializeAsString(), heap, record)));
+    CHECK(google::protobuf::util::MessageDifferencer::Equals(recoded, config));
+    const auto settings = GetField(TConfig, record.data(), 1);
+    CHECK(DelphiHeap::GetLength(Load<const void *>(settings)) == 2);
+    CHECK(Load<const void *>(settings + sizeof(void *)) == nullptr);
+    CHECK(Load<int32_t>(settings + 2 * sizeof(void *)) == 0);
+
+    // a key found twice is kept twice until Delphi rebuilds the slots, and the last value wins either way
+    Config update;
+    (*update.mutable_settings())["a"] = "2";
+    const auto input = config.SerializeAsString() + update.SerializeAsString();
+    CHECK(recoded.ParseFromString(Recode(TConfig, input, heap, record)));
+    CHECK(recoded.settings().at("a") == "2");
+    CHECK(DelphiHeap::GetLength(Load<const void *>(GetField(TConfig, record.data(), 1))) == 3);
+}
+
+void TestBounded()
+{
+    // a bounded record starts with its count, and holds its values in place of a dynamic array
+    using namespace Schema::Sensor::Proto;
+    CHECK(GetField(TReading, nullptr, 1) == reinterpret_cast<const uint8_t *>(sizeof(int32_t)));
+
+    Reading reading;
+    reading.add_values(-1);
+    reading.add_values(300);
+    reading.add_weights(0.5);
+    reading.add_tags("a");
+    reading.add_tags("");
+    reading.add_samples()->set_label("s");
+    reading.add_flags(true);
+    reading.add_flags(false);
+    reading.add_history(7);
+    reading.set_name("n");
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TReading, reading.SerializeAsString(), heap, record) == reading.SerializeAsString());
+    CHECK(Load<int32_t>(reinterpret_cast<const uint8_t *>(record.data())) == 2);
+    CHECK(Load<int32_t>(GetField(TReading, record.data(), 1)) == -1);
+    const auto tags = GetField(TReading, record.data(), 3);
+    CHECK(DelphiHeap::GetString(Load<const void *>(tags)) == u"a");
+    CHECK(Load<const void *>(tags + sizeof(void *)) == nullptr);
+
+    // merging fills the capacity, and one more value is rejected whether it is packed or not
+    Reading more;
+    more.add_values(1);
+    more.add_values(2);
+    CHECK(Recode(TReading, reading.SerializeAsString() + more.SerializeAsString(), heap, record).size() > 0);
+    CHECK(Load<int32_t>(reinterpret_cast<const uint8_t *>(record.data())) == 4);
+    more.add_values(3);
+    const auto input = reading.SerializeAsString() + more.SerializeAsString();
+    record.assign(TReading.size / sizeof(uint64_t) + 1, 0);
+    CHECK(dsc_decode(&TReading, record.data(), reinterpret_cast<const uint8_t *>(input.data()), input.size(),
+                     &heap.allocator)
+          == DSC_EXCEEDED);
+    Reading samples;
+    for (int i = 0; i < 3; ++i) {
+        samples.add_samples()->set_time(i);
+    }
+    const auto unpacked = samples.SerializeAsString();
+    record.assign(TReading.size / sizeof(uint64_t) + 1, 0);
+    CHECK(dsc_decode(&TReading, record.data(), reinterpret_cast<const uint8_t *>(unpacked.data()), unpacked.size(),
+                     &heap.allocator)
+          == DSC_EXCEEDED);
+}
+
+void TestUnknown()
+{
+    // the fields of the next revision are kept by the records of the first one, and encoded back after the known ones
+    using namespace Schema::Relay::Proto;
+    CHECK(TFrame.unknown_offset + sizeof(void *) == TFrame.size);
+    CHECK(THeader.unknown_offset + sizeof(void *) == THeader.size);
+
+    ExtendedFrame frame;
+    frame.set_id(1);
+    frame.mutable_header()->set_hop(2);
+    frame.mutable_header()->set_target("t");
+    frame.mutable_header()->set_weight(0.5);
+    frame.set_payload("p");
+    frame.add_tags("a");
+    frame.add_tags("b");
+    frame.set_stamp(3);
+    frame.set_priority(-4);
+    const auto input = frame.SerializeAsString();
+    DelphiHeap heap;
+    std::vector<uint64_t> record;
+    CHECK(Recode(TFrame, input, heap, record) == input);
+    const auto unknown = Load<const uint8_t *>(reinterpret_cast<const uint8_t *>(record.data()) + TFrame.unknown_offset);
+    CHECK(DelphiHeap::GetLength(unknown) == 2 * 3 + 9 + 2);
+    CHECK(unknown[0] == (4 << 3 | 2));
+    const auto header = GetField(TFrame, record.data(), 2);
+    CHECK(DelphiHeap::GetLength(Load<const void *>(header + THeader.unknown_offset)) == 9);
+
+    // a known field with an unexpected wire type is kept as well, and merging appends to the fields already kept
+    const std::string fixed("\x0D\x01\x02\x03\x04", 5);
+    const auto output = Recode(TFrame, input + input + fixed, heap, record);
+    CHECK(output.compare(output.size() - fixed.size(), fixed.size(), fixed) == 0);
+    ExtendedFrame recoded;
+    CHECK(recoded.ParseFromString(output));
+    CHECK(google::protobuf::util::MessageDifferencer::Equals(recoded.header(), frame.header()));
+    CHECK(recoded.tags_size() == 4);
+}
+
+void TestErrors()
+{
+    using namespace Schema::Message::Proto;
+    Optional optional;
+    optional.set_string("abc");
+    const auto input = optional.SerializeAsString();
+    DelphiHeap heap;
+    std::vector<uint64_t> record(TOptional.size / sizeof(uint64_t) + 1);
+    const auto data = reinterpret_cast<const uint8_t *>(input.data());
+    CHECK(dsc_decode(&TOptional, record.data(), data, input.size() - 1, &heap.allocator) == DSC_TRUNCATED);
+    CHECK(dsc_decode(&TOptional, record.data(), data, input.size(), &heap.allocator) == DSC_OK);
+    uint8_t buffer[4];
+    size_t written;
+    CHECK(dsc_encode(&TOptional, record.data(), buffer, sizeof(buffer), &written) == DSC_OVERFLOW);
+    CHECK(written == input.size());
+}
+
+} // namespace
+
+int main()
+{
+    TestAddressBook();
+    TestMessage();
+    TestMerge();
+    TestLazy();
+    TestPresence();
+    TestBoxed();
+    TestOverlaid();
+    TestMaps();
+    TestBounded();
+    TestUnknown();
+    TestErrors();
+    if (failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,894 @@
+#include "delphicodec.h"
+
+#include <cstring>
+#include <vector>
+
+namespace {
+
+enum WireType
+{
+    WireVarInt = 0,
+    WireFixed64 = 1,
+    WireLengthPrefixed = 2,
+    WireStartGroup = 3,
+    WireEndGroup = 4,
+    WireFixed32 = 5
+};
+
+// indexed by dsc_kind
+const int KindWireTypes[] = {WireFixed64, WireFixed32, WireVarInt, WireVarInt, WireVarInt, WireVarInt, WireVarInt,
+                             WireVarInt, WireFixed32, WireFixed64, WireFixed32, WireFixed64, WireVarInt, WireVarInt,
+                             WireVarInt, WireVarInt, WireLengthPrefixed, WireLengthPrefixed, WireLengthPrefixed};
+const size_t KindSizes[] = {8, 4, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 1, 1, 2, 4, sizeof(void *), sizeof(void *), 0};
+
+const uint16_t ReplacementChar = 0xFFFD;
+
+template <typename T>
+T Load(const uint8_t *value)
+{
+    T result;
+    std::memcpy(&result, value, sizeof(T));
+    return result;
+}
+
+template <typename T>
+void Store(uint8_t *value, T result)
+{
+    std::memcpy(value, &result, sizeof(T));
+}
+
+bool IsForced(const dsc_field &field)
+{
+    return (field.flags & (DSC_REQUIRED | DSC_ONEOF | DSC_PRESENCE | DSC_BOXED)) != 0;
+}
+
+bool IsSelected(const dsc_field &field, const uint8_t *record)
+{
+    if (field.flags & DSC_PRESENCE) {
+        return (Load<uint32_t>(record + field.case_offset) >> field.case_value & 1) != 0;
+    }
+    if (field.flags & DSC_BOXED) {
+        return Load<const void *>(record + field.offset) != nullptr;
+    }
+    return !(field.flags & DSC_ONEOF) || record[field.case_offset] == field.case_value;
+}
+
+// a lazy message field keeps its value first, then the encoding of the value until it is accessed, then whether it
+// was parsed
+size_t GetEncodedOffset(const dsc_field &field)
+{
+    return (field.message->size + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+}
+
+bool IsParsed(const dsc_field &field, const uint8_t *value)
+{
+    return !(field.flags & DSC_LAZY) || value[GetEncodedOffset(field) + sizeof(void *)] != 0;
+}
+
+size_t GetElementSize(const dsc_field &field)
+{
+    if (field.flags & DSC_LAZY) {
+        return GetEncodedOffset(field) + 2 * sizeof(void *);
+    }
+    return field.kind == DSC_MESSAGE ? field.message->size : KindSizes[field.kind];
+}
+
+// Delphi keeps the length of strings and dynamic arrays just ahead of their first element, and empty ones are nil
+size_t GetStringLength(const uint16_t *chars)
+{
+    return chars ? reinterpret_cast<const int32_t *>(chars)[-1] : 0;
+}
+
+size_t GetArrayLength(const void *array)
+{
+    return array ? static_cast<const intptr_t *>(array)[-1] : 0;
+}
+
+// the values of a bounded field are counted by the record, which holds them in place of a dynamic array
+const uint8_t *GetElements(const dsc_field &field, const uint8_t *value, size_t &count)
+{
+    if (field.flags & DSC_BOUNDED) {
+        count = Load<int32_t>(value - field.offset + field.case_offset);
+        return value;
+    }
+    const auto elements = Load<const uint8_t *>(value);
+    count = GetArrayLength(elements);
+    return elements;
+}
+
+size_t GetVarIntSize(uint64_t value)
+{
+    size_t result = 1;
+    for (; value >= 0x80; value >>= 7) {
+        ++result;
+    }
+    return result;
+}
+
+uint64_t GetZigZag(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+bool IsSurrogatePair(const uint16_t *chars, size_t i, size_t length)
+{
+    return chars[i] >= 0xD800 && chars[i] < 0xDC00 && i + 1 < length && chars[i + 1] >= 0xDC00 && chars[i + 1] < 0xE000;
+}
+
+// lone surrogates are encoded as the replacement character, as TEncoding.UTF8 does
+size_t GetUtf8Size(const uint16_t *chars, size_t length)
+{
+    size_t result = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (chars[i] < 0x80) {
+            result += 1;
+        } else if (chars[i] < 0x800) {
+            result += 2;
+        } else if (IsSurrogatePair(chars, i, length)) {
+            result += 4;
+            ++i;
+        } else {
+            result += 3;
+        }
+    }
+    return result;
+}
+
+uint64_t GetValue(const uint8_t *value, int kind)
+{
+    // the value that is packed as a varint, or the bits of a fixed-size value
+    switch (kind) {
+    case DSC_INT32:
+    case DSC_ENUM32:
+        return static_cast<uint64_t>(static_cast<int64_t>(Load<int32_t>(value)));
+    case DSC_SINT32:
+        return static_cast<uint32_t>(GetZigZag(Load<int32_t>(value)));
+    case DSC_SINT64:
+        return GetZigZag(Load<int64_t>(value));
+    case DSC_UINT32:
+    case DSC_FIXED32:
+    case DSC_SFIXED32:
+    case DSC_FLOAT:
+        return Load<uint32_t>(value);
+    case DSC_BOOL:
+        return *value != 0;
+    case DSC_ENUM8:
+        return *value;
+    case DSC_ENUM16:
+        return Load<uint16_t>(value);
+    default:
+        return Load<uint64_t>(value);
+    }
+}
+
+bool IsSet(const uint8_t *value, int kind)
+{
+    switch (kind) {
+    case DSC_DOUBLE:
+        return Load<double>(value) != 0;
+    case DSC_FLOAT:
+        return Load<float>(value) != 0;
+    case DSC_STRING:
+    case DSC_BYTES:
+        return Load<void *>(value) != nullptr;
+    default:
+        return GetValue(value, kind) != 0;
+    }
+}
+
+size_t GetValueSize(const uint8_t *value, int kind)
+{
+    switch (KindWireTypes[kind]) {
+    case WireFixed32:
+        return 4;
+    case WireFixed64:
+        return 8;
+    default:
+        return GetVarIntSize(GetValue(value, kind));
+    }
+}
+
+size_t GetFixedSize(int kind)
+{
+    // the size of every value of a packed array, or zero if it depends on the value
+    switch (KindWireTypes[kind]) {
+    case WireFixed32:
+        return 4;
+    case WireFixed64:
+        return 8;
+    default:
+        return kind == DSC_BOOL ? 1 : 0;
+    }
+}
+
+uint32_t GetTag(const dsc_field &field)
+{
+    const auto wiretype = field.flags & DSC_PACKED ? WireLengthPrefixed : KindWireTypes[field.kind];
+    return field.number << 3 | wiretype;
+}
+
+// sizes of length-prefixed fields, stored in pre-order while computing the size of a message and consumed in the same
+// order while encoding it, so that each length prefix is written before its payload
+class Encoder
+{
+public:
+    size_t ComputeSize(const dsc_message *message, const uint8_t *record)
+    {
+        size_t result = 0;
+        for (uint32_t i = 0; i < message->field_count; ++i) {
+            const auto &field = message->fields[i];
+            if (IsSelected(field, record)) {
+                result += ComputeSize(field, record + field.offset);
+            }
+        }
+        if (message->unknown_offset >= 0) {
+            result += GetArrayLength(Load<const void *>(record + message->unknown_offset));
+        }
+        return result;
+    }
+
+    uint8_t *Encode(const dsc_message *message, const uint8_t *record, uint8_t *output)
+    {
+        for (uint32_t i = 0; i < message->field_count; ++i) {
+            const auto &field = message->fields[i];
+            if (IsSelected(field, record)) {
+                output = Encode(field, record + field.offset, output);
+            }
+        }
+        if (message->unknown_offset >= 0) {
+            // the unknown fields follow the known ones, as they were decoded
+            const auto unknown = Load<const uint8_t *>(record + message->unknown_offset);
+            const auto size = GetArrayLength(unknown);
+            if (size > 0) {
+                std::memcpy(output, unknown, size);
+            }
+            output += size;
+        }
+        return output;
+    }
+
+private:
+    size_t ComputeSize(const dsc_field &field, const uint8_t *value)
+    {
+        const auto tagsize = GetVarIntSize(GetTag(field));
+        if (field.flags & DSC_REPEATED) {
+            size_t count;
+            const auto elements = GetElements(field, value, count);
+            if (count == 0) {
+                return 0;
+            }
+            const auto elementsize = GetElementSize(field);
+            if (field.flags & DSC_PACKED) {
+                auto size = count * GetFixedSize(field.kind);
+                if (size == 0) {
+                    for (size_t k = 0; k < count; ++k) {
+                        size += GetValueSize(elements + k * elementsize, field.kind);
+                    }
+                    _sizes.push_back(size);
+                }
+                return tagsize + GetVarIntSize(size) + size;
+            }
+            size_t result = 0;
+            for (size_t k = 0; k < count; ++k) {
+                result += tagsize + ComputeValueSize(field, elements + k * elementsize);
+            }
+            return result;
+        }
+        if (field.kind == DSC_MESSAGE) {
+            // the slot is kept even for an empty sub-message, so that the encoder can find out it must be omitted
+            const auto slot = _sizes.size();
+            _sizes.push_back(0);
+            const auto size = ComputeMessageSize(field, value);
+            _sizes[slot] = size;
+            if (size > 0 || IsForced(field)) {
+                return tagsize + GetVarIntSize(size) + size;
+            }
+            _sizes.resize(slot + 1);
+            return 0;
+        }
+        if (!IsForced(field) && !IsSet(value, field.kind)) {
+            return 0;
+        }
+        return tagsize + ComputeValueSize(field, value);
+    }
+
+    size_t ComputeMessageSize(const dsc_field &field, const uint8_t *value)
+    {
+        if (field.flags & DSC_BOXED) {
+            value = Load<const uint8_t *>(value);
+        }
+        if (IsParsed(field, value)) {
+            return ComputeSize(field.message, value);
+        }
+        return GetArrayLength(Load<const void *>(value + GetEncodedOffset(field)));
+    }
+
+    size_t ComputeValueSize(const dsc_field &field, const uint8_t *value)
+    {
+        size_t size;
+        switch (field.kind) {
+        case DSC_MESSAGE: {
+            const auto slot = _sizes.size();
+            _sizes.push_back(0);
+            size = ComputeMessageSize(field, value);
+            _sizes[slot] = size;
+            break;
+        }
+        case DSC_STRING: {
+            const auto chars = Load<const uint16_t *>(value);
+            size = GetUtf8Size(chars, GetStringLength(chars));
+            _sizes.push_back(size);
+            break;
+        }
+        case DSC_BYTES:
+            size = GetArrayLength(Load<const void *>(value));
+            break;
+        default:
+            return GetValueSize(value, field.kind);
+        }
+        return GetVarIntSize(size) + size;
+    }
+
+    uint8_t *Encode(const dsc_field &field, const uint8_t *value, uint8_t *output)
+    {
+        const auto tag = GetTag(field);
+        if (field.flags & DSC_REPEATED) {
+            size_t count;
+            const auto elements = GetElements(field, value, count);
+            if (count == 0) {
+                return output;
+            }
+            const auto elementsize = GetElementSize(field);
+            if (field.flags & DSC_PACKED) {
+                auto size = count * GetFixedSize(field.kind);
+                if (size == 0) {
+                    size = _sizes[_next++];
+                }
+                output = WriteVarInt(WriteVarInt(output, tag), size);
+                for (size_t k = 0; k < count; ++k) {
+                    output = WriteValue(elements + k * elementsize, field.kind, output);
+                }
+                return output;
+            }
+            for (size_t k = 0; k < count; ++k) {
+                output = EncodeValue(field, elements + k * elementsize, WriteVarInt(output, tag));
+            }
+            return output;
+        }
+        if (field.kind == DSC_MESSAGE) {
+            // empty sub-messages are omitted from the output unless they are known to be present
+            const auto size = _sizes[_next++];
+            if (size > 0 || IsForced(field)) {
+                output = WriteVarInt(WriteVarInt(output, tag), size);
+                output = EncodeMessage(field, value, output);
+            }
+            return output;
+        }
+        if (!IsForced(field) && !IsSet(value, field.kind)) {
+            return output;
+        }
+        return EncodeValue(field, value, WriteVarInt(output, tag));
+    }
+
+    uint8_t *EncodeValue(const dsc_field &field, const uint8_t *value, uint8_t *output)
+    {
+        switch (field.kind) {
+        case DSC_MESSAGE:
+            output = WriteVarInt(output, _sizes[_next++]);
+            return EncodeMessage(field, value, output);
+        case DSC_STRING: {
+            const auto chars = Load<const uint16_t *>(value);
+            return WriteUtf8(WriteVarInt(output, _sizes[_next++]), chars, GetStringLength(chars));
+        }
+        case DSC_BYTES: {
+            const auto bytes = Load<const uint8_t *>(value);
+            const auto size = GetArrayLength(bytes);
+            output = WriteVarInt(output, size);
+            if (size > 0) {
+                std::memcpy(output, bytes, size);
+            }
+            return output + size;
+        }
+        default:
+            return WriteValue(value, field.kind, output);
+        }
+    }
+
+    uint8_t *EncodeMessage(const dsc_field &field, const uint8_t *value, uint8_t *output)
+    {
+        if (field.flags & DSC_BOXED) {
+            value = Load<const uint8_t *>(value);
+        }
+        if (IsParsed(field, value)) {
+            return Encode(field.message, value, output);
+        }
+        // the encoding is copied as it was decoded
+        const auto encoded = Load<const uint8_t *>(value + GetEncodedOffset(field));
+        const auto size = GetArrayLength(encoded);
+        if (size > 0) {
+            std::memcpy(output, encoded, size);
+        }
+        return output + size;
+    }
+
+    static uint8_t *WriteValue(const uint8_t *value, int kind, uint8_t *output)
+    {
+        switch (KindWireTypes[kind]) {
+        case WireFixed32:
+            Store(output, static_cast<uint32_t>(GetValue(value, kind)));
+            return output + 4;
+        case WireFixed64:
+            Store(output, GetValue(value, kind));
+            return output + 8;
+        default:
+            return WriteVarInt(output, GetValue(value, kind));
+        }
+    }
+
+    static uint8_t *WriteVarInt(uint8_t *output, uint64_t value)
+    {
+        for (; value >= 0x80; value >>= 7) {
+            *output++ = static_cast<uint8_t>(value | 0x80);
+        }
+        *output++ = static_cast<uint8_t>(value);
+        return output;
+    }
+
+    static uint8_t *WriteUtf8(uint8_t *output, const uint16_t *chars, size_t length)
+    {
+        for (size_t i = 0; i < length; ++i) {
+            uint32_t c = chars[i];
+            if (c < 0x80) {
+                *output++ = static_cast<uint8_t>(c);
+                continue;
+            }
+            if (c < 0x800) {
+                *output++ = static_cast<uint8_t>(0xC0 | c >> 6);
+                *output++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+                continue;
+            }
+            if (IsSurrogatePair(chars, i, length)) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (chars[++i] - 0xDC00);
+                *output++ = static_cast<uint8_t>(0xF0 | c >> 18);
+                *output++ = static_cast<uint8_t>(0x80 | (c >> 12 & 0x3F));
+            } else {
+                if (c >= 0xD800 && c < 0xE000) {
+                    c = ReplacementChar;
+                }
+                *output++ = static_cast<uint8_t>(0xE0 | c >> 12);
+            }
+            *output++ = static_cast<uint8_t>(0x80 | (c >> 6 & 0x3F));
+            *output++ = static_cast<uint8_t>(0x80 | (c & 0x3F));
+        }
+        return output;
+    }
+
+    std::vector<size_t> _sizes;
+    size_t _next = 0;
+};
+
+// decodes a message in two passes over its input: the first one counts the values of the repeated fields, so that
+// each dynamic array is resized once instead of once per value, and the second one stores the values
+class Decoder
+{
+public:
+    explicit Decoder(const dsc_allocator *allocator)
+        : _allocator(allocator)
+    {
+    }
+
+    dsc_status Decode(const dsc_message *message, uint8_t *record, const uint8_t *input, const uint8_t *end)
+    {
+        std::vector<size_t> next; // the index of the next value of each repeated field
+        std::vector<uint8_t> unknown; // the fields that the record does not declare, stored once they are all read
+        auto status = Reserve(message, record, input, end, next);
+        uint32_t index = 0;
+        while (status == DSC_OK && input < end) {
+            const auto start = input;
+            uint64_t tag;
+            if ((status = ReadVarInt(input, end, tag)) != DSC_OK) {
+                break;
+            }
+            const auto wiretype = static_cast<int>(tag & 7);
+            const auto field = FindField(message, tag >> 3, index);
+            if (!field || !IsAccepted(*field, wiretype)) {
+                status = Skip(input, end, wiretype, tag >> 3);
+                if (status == DSC_OK && message->unknown_offset >= 0) {
+                    unknown.insert(unknown.end(), start, input);
+                }
+                continue;
+            }
+            if (field->flags & DSC_ONEOF) {
+                // a message is merged into an overlaid member only if it held the previous one
+                if ((field->flags & DSC_OVERLAID) && field->kind == DSC_MESSAGE
+                    && record[field->case_offset] != field->case_value) {
+                    std::memset(record + field->offset, 0, field->message->size);
+                }
+                record[field->case_offset] = field->case_value;
+            } else if (field->flags & DSC_PRESENCE) {
+                const auto presence = record + field->case_offset;
+                Store<uint32_t>(presence, Load<uint32_t>(presence) | 1u << field->case_value);
+            }
+            const auto value = record + field->offset;
+            auto target = value;
+            if (wiretype != KindWireTypes[field->kind]) {
+                // parsers must accept both packed and unpacked encodings of packable fields
+                const uint8_t *payloadend;
+                if ((status = ReadLength(input, end, payloadend)) != DSC_OK) {
+                    break;
+                }
+                while (status == DSC_OK && input < payloadend) {
+                    status = Append(*field, value, next, index, target);
+                    if (status == DSC_OK) {
+                        status = ReadValue(input, payloadend, field->kind, target);
+                    }
+                }
+                continue;
+            }
+            if (field->flags & DSC_REPEATED) {
+                if ((status = Append(*field, value, next, index, target)) != DSC_OK) {
+                    break;
+                }
+            } else if (field->flags & DSC_BOXED) {
+                const auto box = reinterpret_cast<void **>(value);
+                _allocator->set_length(_allocator->context, box, 1, field->message->size, message, field);
+                target = static_cast<uint8_t *>(*box);
+            }
+            status = ReadField(*field, input, end, target);
+        }
+        if (status == DSC_OK && !unknown.empty()) {
+            AppendBytes(record + message->unknown_offset, unknown.data(), unknown.data() + unknown.size());
+        }
+        return status;
+    }
+
+private:
+    dsc_status Reserve(const dsc_message *message, uint8_t *record, const uint8_t *input, const uint8_t *end,
+                       std::vector<size_t> &next)
+    {
+        // values are appended to the elements already in the arrays, since the fields of a message are merged
+        std::vector<size_t> counts;
+        uint32_t index = 0;
+        while (input < end) {
+            uint64_t tag;
+            auto status = ReadVarInt(input, end, tag);
+            if (status != DSC_OK) {
+                return status;
+            }
+            const auto wiretype = static_cast<int>(tag & 7);
+            const auto field = FindField(message, tag >> 3, index);
+            // bounded fields hold their values in the record, so they have no array to resize
+            if (!field || (field->flags & (DSC_REPEATED | DSC_BOUNDED)) != DSC_REPEATED
+                || !IsAccepted(*field, wiretype)) {
+                status = Skip(input, end, wiretype, tag >> 3);
+            } else if (wiretype != KindWireTypes[field->kind]) {
+                const uint8_t *payloadend;
+                status = ReadLength(input, end, payloadend);
+                if (status == DSC_OK) {
+                    counts.resize(message->field_count);
+                    status = CountValues(input, payloadend, field->kind, counts[index]);
+                    input = payloadend;
+                }
+            } else {
+                counts.resize(message->field_count);
+                ++counts[index];
+                status = Skip(input, end, wiretype, tag >> 3);
+            }
+            if (status != DSC_OK) {
+                return status;
+            }
+        }
+        next.resize(counts.size());
+        for (size_t i = 0; i < counts.size(); ++i) {
+            if (counts[i] > 0) {
+                const auto &field = message->fields[i];
+                const auto array = reinterpret_cast<void **>(record + field.offset);
+                next[i] = GetArrayLength(*array);
+                _allocator->set_length(_allocator->context, array, next[i] + counts[i], GetElementSize(field), message,
+                                       &field);
+            }
+        }
+        return DSC_OK;
+    }
+
+    static dsc_status Append(const dsc_field &field, uint8_t *value, std::vector<size_t> &next, uint32_t index,
+                             uint8_t *&target)
+    {
+        if (!(field.flags & DSC_BOUNDED)) {
+            target = Load<uint8_t *>(value) + next[index]++ * GetElementSize(field);
+            return DSC_OK;
+        }
+        // the values past the count are zeroed, so the next one is decoded in place
+        const auto bound = value - field.offset + field.case_offset;
+        const auto count = Load<int32_t>(bound);
+        if (count >= field.case_value) {
+            return DSC_EXCEEDED;
+        }
+        Store<int32_t>(bound, count + 1);
+        target = value + count * GetElementSize(field);
+        return DSC_OK;
+    }
+
+    dsc_status ReadField(const dsc_field &field, const uint8_t *&input, const uint8_t *end, uint8_t *value)
+    {
+        if (KindWireTypes[field.kind] != WireLengthPrefixed) {
+            return ReadValue(input, end, field.kind, value);
+        }
+        const uint8_t *payloadend;
+        const auto status = ReadLength(input, end, payloadend);
+        if (status != DSC_OK) {
+            return status;
+        }
+        const auto payload = input;
+        input = payloadend;
+        switch (field.kind) {
+        case DSC_MESSAGE:
+            if (IsParsed(field, value)) {
+                return Decode(field.message, value, payload, payloadend);
+            }
+            DecodeLazy(field, payload, payloadend, value);
+            return DSC_OK;
+        case DSC_STRING:
+            ReadUtf8(payload, payloadend);
+            _allocator->set_string(_allocator->context, reinterpret_cast<void **>(value), _chars.data(),
+                                   _chars.size());
+            return DSC_OK;
+        default:
+            _allocator->set_bytes(_allocator->context, reinterpret_cast<void **>(value), payload,
+                                  payloadend - payload);
+            return DSC_OK;
+        }
+    }
+
+    void DecodeLazy(const dsc_field &field, const uint8_t *payload, const uint8_t *end, uint8_t *value)
+    {
+        // decoding the concatenation of several encodings merges the messages they hold
+        AppendBytes(value + GetEncodedOffset(field), payload, end);
+    }
+
+    void AppendBytes(uint8_t *value, const uint8_t *data, const uint8_t *end)
+    {
+        const auto bytes = reinterpret_cast<void **>(value);
+        const auto previous = static_cast<const uint8_t *>(*bytes);
+        if (!previous) {
+            _allocator->set_bytes(_allocator->context, bytes, data, end - data);
+            return;
+        }
+        std::vector<uint8_t> merged(previous, previous + GetArrayLength(previous));
+        merged.insert(merged.end(), data, end);
+        _allocator->set_bytes(_allocator->context, bytes, merged.data(), merged.size());
+    }
+
+    static dsc_status ReadValue(const uint8_t *&input, const uint8_t *end, int kind, uint8_t *value)
+    {
+        uint64_t bits;
+        switch (KindWireTypes[kind]) {
+        case WireFixed32:
+            if (end - input < 4) {
+                return DSC_TRUNCATED;
+            }
+            Store(value, Load<uint32_t>(input));
+            input += 4;
+            return DSC_OK;
+        case WireFixed64:
+            if (end - input < 8) {
+                return DSC_TRUNCATED;
+            }
+            Store(value, Load<uint64_t>(input));
+            input += 8;
+            return DSC_OK;
+        default: {
+            const auto status = ReadVarInt(input, end, bits);
+            if (status != DSC_OK) {
+                return status;
+            }
+            break;
+        }
+        }
+        switch (kind) {
+        case DSC_INT32:
+        case DSC_UINT32:
+        case DSC_ENUM32:
+            Store(value, static_cast<uint32_t>(bits));
+            break;
+        case DSC_SINT32:
+        case DSC_SINT64:
+            bits = bits >> 1 ^ (0 - (bits & 1));
+            if (kind == DSC_SINT32) {
+                Store(value, static_cast<uint32_t>(bits));
+            } else {
+                Store(value, bits);
+            }
+            break;
+        case DSC_BOOL:
+            *value = bits != 0;
+            break;
+        case DSC_ENUM8:
+            *value = static_cast<uint8_t>(bits);
+            break;
+        case DSC_ENUM16:
+            Store(value, static_cast<uint16_t>(bits));
+            break;
+        default:
+            Store(value, bits);
+            break;
+        }
+        return DSC_OK;
+    }
+
+    static dsc_status CountValues(const uint8_t *input, const uint8_t *end, int kind, size_t &count)
+    {
+        const auto size = static_cast<size_t>(end - input);
+        switch (KindWireTypes[kind]) {
+        case WireFixed32:
+        case WireFixed64: {
+            const auto valuesize = KindSizes[kind];
+            if (size % valuesize != 0) {
+                return DSC_MALFORMED;
+            }
+            count += size / valuesize;
+            return DSC_OK;
+        }
+        default:
+            // each varint ends with the only one of its bytes that has no continuation bit
+            for (; input < end; ++input) {
+                count += *input < 0x80;
+            }
+            return size == 0 || end[-1] < 0x80 ? DSC_OK : DSC_TRUNCATED;
+        }
+    }
+
+    static const dsc_field *FindField(const dsc_message *message, uint64_t number, uint32_t &index)
+    {
+        // fields mostly come in the order they are declared, so the search starts after the previous one
+        for (uint32_t k = 0; k < message->field_count; ++k) {
+            const auto i = (index + k) % message->field_count;
+            if (message->fields[i].number == number) {
+                index = i;
+                return &message->fields[i];
+            }
+        }
+        return nullptr;
+    }
+
+    static bool IsAccepted(const dsc_field &field, int wiretype)
+    {
+        // only repeated fields take the packed encoding of their values, as the generated decoders have it
+        const auto expected = KindWireTypes[field.kind];
+        return wiretype == expected
+            || (wiretype == WireLengthPrefixed && expected != WireLengthPrefixed && (field.flags & DSC_REPEATED));
+    }
+
+    static dsc_status ReadVarInt(const uint8_t *&input, const uint8_t *end, uint64_t &value)
+    {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (input == end) {
+                return DSC_TRUNCATED;
+            }
+            const auto byte = *input++;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (byte < 0x80) {
+                return DSC_OK;
+            }
+        }
+        return DSC_MALFORMED;
+    }
+
+    static dsc_status ReadLength(const uint8_t *&input, const uint8_t *end, const uint8_t *&payloadend)
+    {
+        uint64_t length;
+        const auto status = ReadVarInt(input, end, length);
+        if (status != DSC_OK) {
+            return status;
+        }
+        if (length > static_cast<uint64_t>(end - input)) {
+            return DSC_TRUNCATED;
+        }
+        payloadend = input + length;
+        return DSC_OK;
+    }
+
+    static dsc_status Skip(const uint8_t *&input, const uint8_t *end, int wiretype, uint64_t number)
+    {
+        uint64_t value;
+        switch (wiretype) {
+        case WireVarInt:
+            return ReadVarInt(input, end, value);
+        case WireFixed64:
+        case WireFixed32: {
+            const auto size = wiretype == WireFixed64 ? 8 : 4;
+            if (end - input < size) {
+                return DSC_TRUNCATED;
+            }
+            input += size;
+            return DSC_OK;
+        }
+        case WireLengthPrefixed: {
+            const uint8_t *payloadend;
+            const auto status = ReadLength(input, end, payloadend);
+            if (status != DSC_OK) {
+                return status;
+            }
+            input = payloadend;
+            return DSC_OK;
+        }
+        case WireStartGroup:
+            // groups are skipped up to the end tag with the same number, along with the groups they contain
+            while (input < end) {
+                const auto status = ReadVarInt(input, end, value);
+                if (status != DSC_OK) {
+                    return status;
+                }
+                if ((value & 7) == WireEndGroup) {
+                    return value >> 3 == number ? DSC_OK : DSC_MALFORMED;
+                }
+                const auto nested = Skip(input, end, static_cast<int>(value & 7), value >> 3);
+                if (nested != DSC_OK) {
+                    return nested;
+                }
+            }
+            return DSC_TRUNCATED;
+        default:
+            return DSC_MALFORMED;
+        }
+    }
+
+    void ReadUtf8(const uint8_t *input, const uint8_t *end)
+    {
+        // invalid sequences are decoded as the replacement character, as TEncoding.UTF8 does
+        _chars.clear();
+        while (input < end) {
+            uint32_t c = *input++;
+            int trailing = c < 0x80 ? 0 : c < 0xC2 ? -1 : c < 0xE0 ? 1 : c < 0xF0 ? 2 : c < 0xF5 ? 3 : -1;
+            if (trailing < 0) {
+                _chars.push_back(ReplacementChar);
+                continue;
+            }
+            c &= 0x7F >> trailing;
+            const auto start = input;
+            for (; trailing > 0 && input < end && (*input & 0xC0) == 0x80; --trailing) {
+                c = c << 6 | (*input++ & 0x3F);
+            }
+            const auto count = input - start;
+            if (trailing > 0 || (count == 2 && (c < 0x800 || (c >= 0xD800 && c < 0xE000)))
+                || (count == 3 && (c < 0x10000 || c > 0x10FFFF))) {
+                _chars.push_back(ReplacementChar);
+            } else if (c >= 0x10000) {
+                _chars.push_back(static_cast<uint16_t>(0xD800 + ((c - 0x10000) >> 10)));
+                _chars.push_back(static_cast<uint16_t>(0xDC00 + ((c - 0x10000) & 0x3FF)));
+            } else {
+                _chars.push_back(static_cast<uint16_t>(c));
+            }
+        }
+    }
+
+    const dsc_allocator *_allocator;
+    std::vector<uint16_t> _chars;
+};
+
+} // namespace
+
+size_t dsc_encoded_size(const dsc_message *message, const void *record)
+{
+    return Encoder().ComputeSize(message, static_cast<const uint8_t *>(record));
+}
+
+dsc_status dsc_encode(const dsc_message *message, const void *record, uint8_t *buffer, size_t capacity,
+                      size_t *written)
+{
+    Encoder encoder;
+    const auto size = encoder.ComputeSize(message, static_cast<const uint8_t *>(record));
+    *written = size;
+    if (size > capacity) {
+        return DSC_OVERFLOW;
+    }
+    encoder.Encode(message, static_cast<const uint8_t *>(record), buffer);
+    return DSC_OK;
+}
+
+dsc_status dsc_decode(const dsc_message *message, void *record, const uint8_t *data, size_t size,
+                      const dsc_allocator *allocator)
+{
+    return Decoder(allocator).Decode(message, static_cast<uint8_t *>(record), data, data + size);
+}
@@ -0,0 +1,119 @@
+#ifndef DELPHICODEC_H
+#define DELPHICODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(DSC_BUILDING)
+#define DSC_API __declspec(dllexport)
+#else
+#define DSC_API __declspec(dllimport)
+#endif
+#else
+#define DSC_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the Delphi representation of a field value, in the same order as TFieldKind */
+typedef enum dsc_kind {
+    DSC_DOUBLE,
+    DSC_FLOAT,
+    DSC_INT32,
+    DSC_INT64,
+    DSC_UINT32,
+    DSC_UINT64,
+    DSC_SINT32,
+    DSC_SINT64,
+    DSC_FIXED32,
+    DSC_FIXED64,
+    DSC_SFIXED32,
+    DSC_SFIXED64,
+    DSC_BOOL,
+    DSC_ENUM8,
+    DSC_ENUM16,
+    DSC_ENUM32,
+    DSC_STRING,
+    DSC_BYTES,
+    DSC_MESSAGE
+} dsc_kind;
+
+/* the flags of a field, in the same order as TFieldFlag */
+enum {
+    DSC_REPEATED = 1,
+    DSC_PACKED = 2,
+    DSC_REQUIRED = 4,
+    DSC_ONEOF = 8,
+    DSC_LAZY = 16,     /* the message is held by a wrapper that keeps its encoding until it is accessed */
+    DSC_PRESENCE = 32, /* the field is encoded when its bit is set in the presence bitmap of the record */
+    DSC_BOXED = 64,    /* the message is held by a dynamic array of one element, which is nil while it is absent */
+    DSC_OVERLAID = 128, /* the member of a oneof shares its storage with the other overlaid members */
+    DSC_BOUNDED = 256   /* the values of the repeated field are held by the record, following their count */
+};
+
+typedef struct dsc_message dsc_message;
+
+/* a field of a generated record, located by its offset from the start of the record */
+typedef struct dsc_field {
+    uint32_t number;
+    uint8_t kind;
+    uint16_t flags;
+    uint8_t case_value;   /* the value of the oneof case when this field is set, or the index of its presence bit, or
+                             the capacity of a bounded field */
+    uint32_t offset;
+    uint32_t case_offset; /* the offset of the case of the containing oneof, or of the word holding the presence bit,
+                             or of the count of a bounded field */
+    const dsc_message *message;
+} dsc_field;
+
+/* the fields of a generated record, in the order they are encoded */
+struct dsc_message {
+    const char *name;
+    const dsc_field *fields;
+    uint32_t field_count;
+    uint32_t size; /* the size of the record, which is also the stride of its dynamic arrays */
+    int32_t unknown_offset; /* the offset of the byte array holding the fields that the record does not declare, as
+                               they were decoded, or -1 if they are skipped */
+};
+
+/* the callbacks that allocate strings and dynamic arrays, which belong to the Delphi memory manager */
+typedef struct dsc_allocator {
+    void *context;
+    /* sets the length of the dynamic array of a repeated or boxed field, keeping its elements and zeroing the new ones,
+       and leaving the array unique to the record */
+    void (*set_length)(void *context, void **array, size_t length, size_t element_size,
+                       const dsc_message *message, const dsc_field *field);
+    /* replaces a string with a copy of the given UTF-16 characters, or with nil if there are none */
+    void (*set_string)(void *context, void **string, const uint16_t *chars, size_t length);
+    /* replaces a byte array with a copy of the given bytes, or with nil if there are none */
+    void (*set_bytes)(void *context, void **bytes, const uint8_t *data, size_t size);
+} dsc_allocator;
+
+typedef enum dsc_status {
+    DSC_OK,
+    DSC_TRUNCATED, /* the input ends in the middle of a field */
+    DSC_MALFORMED, /* the input is not a valid encoding of the message */
+    DSC_OVERFLOW,  /* the output buffer is too small for the message */
+    DSC_EXCEEDED   /* the input holds more values than a bounded field can */
+} dsc_status;
+
+/* returns the size of the encoded record */
+DSC_API size_t dsc_encoded_size(const dsc_message *message, const void *record);
+
+/* encodes the record in the same format as the generated codecs, and sets written to the size of the output, or to
+   the required capacity if it is too small */
+DSC_API dsc_status dsc_encode(const dsc_message *message, const void *record, uint8_t *buffer, size_t capacity,
+                              size_t *written);
+
+/* decodes the input into the record, merging the fields as the generated codecs do */
+DSC_API dsc_status dsc_decode(const dsc_message *message, void *record, const uint8_t *data, size_t size,
+                              const dsc_allocator *allocator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DELPHICODEC_H */
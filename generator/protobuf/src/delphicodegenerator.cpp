@@ -1,7 +1,15 @@
 #include "delphicodegenerator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 
+#include "delphimanifest.h"
 #include "delphiunitgenerator.h"
 #include "delphiutils.h"
 
@@ -14,17 +22,163 @@ bool DelphiCodeGenerator::Generate(const FileDescriptor *file,
                                    const std::string &parameter,
                                    compiler::GeneratorContext *generator_context,
                                    std::string *error) const
+{
+    std::vector<std::pair<std::string, std::string>> parameters;
+    compiler::ParseGeneratorParameter(parameter, &parameters);
+    Unit unit;
+    Generate(file, parameters, &unit);
+    return Write(unit, generator_context, error);
+}
+
+bool DelphiCodeGenerator::GenerateAll(const std::vector<const FileDescriptor *> &files,
+                                      const std::string &parameter,
+                                      compiler::GeneratorContext *generator_context,
+                                      std::string *error) const
+{
+    std::vector<std::pair<std::string, std::string>> parameters;
+    compiler::ParseGeneratorParameter(parameter, &parameters);
+
+    // with an incremental output directory, the units whose inputs did not change since the last run are skipped
+    std::unique_ptr<DelphiManifest> manifest;
+    std::string directory;
+    if (!GetIncrementalDirectory(parameters, &directory, error)) {
+        return false;
+    }
+    if (!directory.empty()) {
+        manifest.reset(new DelphiManifest(directory));
+    }
+    std::vector<const FileDescriptor *> changed;
+    std::vector<uint64_t> hashes;
+    for (const auto file : files) {
+        if (manifest) {
+            const auto hash = DelphiManifest::GetHash(file, parameters);
+            if (manifest->IsUpToDate(GetFileNames(GetUnitName(file->name()), parameters), hash)) {
+                continue;
+            }
+            hashes.push_back(hash);
+        }
+        changed.push_back(file);
+    }
+
+    // units are generated concurrently into memory, each worker taking the next file until none is left
+    std::vector<Unit> units(changed.size());
+    std::atomic<size_t> next(0);
+    const auto work = [&]() {
+        for (auto i = next++; i < changed.size(); i = next++) {
+            Generate(changed[i], parameters, &units[i]);
+        }
+    };
+    const auto jobcount = std::min<size_t>(GetJobCount(parameters), changed.size());
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < jobcount; ++k) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // the generator context is not thread-safe, so the outputs are committed afterwards in the original order
+    for (size_t i = 0; i < units.size(); ++i) {
+        if (!Write(units[i], generator_context, error)) {
+            return false;
+        }
+        if (manifest) {
+            manifest->Update(GetFileNames(units[i].name, parameters), hashes[i]);
+        }
+    }
+    if (manifest) {
+        std::unique_ptr<io::ZeroCopyOutputStream> stream(generator_context->Open(DelphiManifest::FileName));
+        io::CodedOutputStream output(stream.get());
+        output.WriteString(manifest->ToString());
+    }
+    return true;
+}
+
+bool DelphiCodeGenerator::HasGenerateAll() const
+{
+    return true;
+}
+
+uint64_t DelphiCodeGenerator::GetSupportedFeatures() const
+{
+    // proto3 optional fields are emitted as plain fields, rather than as members of their synthetic oneof
+    return FEATURE_PROTO3_OPTIONAL;
+}
+
+void DelphiCodeGenerator::Generate(const FileDescriptor *file,
+                                   const std::vector<std::pair<std::string, std::string>> &parameters,
+                                   Unit *unit)
 {
     try {
-        const auto unitname = GetUnitName(file->name());
-        std::vector<std::pair<std::string, std::string>> parameters;
-        compiler::ParseGeneratorParameter(parameter, &parameters);
-        std::unique_ptr<io::ZeroCopyOutputStream> stream(generator_context->Open(unitname + ".pas"));
-        DelphiUnitGenerator generator(unitname, parameters, stream.get());
+        unit->name = GetUnitName(file->name());
+        io::StringOutputStream stream(&unit->content);
+        DelphiUnitGenerator generator(unit->name, parameters, &stream);
         generator.Generate(file);
+        for (const auto &pair : parameters) {
+            if (pair.first == "emit_layout") {
+                io::StringOutputStream layout(&unit->layout);
+                generator.GenerateLayout(&layout);
+            }
+        }
     } catch (std::exception &e) {
-        *error = e.what();
+        unit->error = e.what();
+    }
+}
+
+bool DelphiCodeGenerator::Write(const Unit &unit, compiler::GeneratorContext *generator_context, std::string *error)
+{
+    if (!unit.error.empty()) {
+        *error = unit.error;
         return false;
     }
+    std::unique_ptr<io::ZeroCopyOutputStream> stream(generator_context->Open(unit.name + ".pas"));
+    io::CodedOutputStream output(stream.get());
+    output.WriteString(unit.content);
+    if (!unit.layout.empty()) {
+        std::unique_ptr<io::ZeroCopyOutputStream> layout(generator_context->Open(unit.name + ".layout.h"));
+        io::CodedOutputStream(layout.get()).WriteString(unit.layout);
+    }
+    return true;
+}
+
+std::vector<std::string> DelphiCodeGenerator::GetFileNames(
+    const std::string &unitName,
+    const std::vector<std::pair<std::string, std::string>> &parameters)
+{
+    std::vector<std::string> filenames{unitName + ".pas"};
+    for (const auto &pair : parameters) {
+        if (pair.first == "emit_layout") {
+            filenames.push_back(unitName + ".layout.h");
+        }
+    }
+    return filenames;
+}
+
+bool DelphiCodeGenerator::GetIncrementalDirectory(const std::vector<std::pair<std::string, std::string>> &parameters,
+                                                  std::string *directory,
+                                                  std::string *error)
+{
+    for (const auto &pair : parameters) {
+        if (pair.first == "incremental") {
+            // the manifest is read from this directory but written through the generator context, so that the two
+            // only meet if it is the output directory, which the plugin is not told
+            if (pair.second.empty()) {
+                *error = "incremental needs the output directory, as in incremental=<dir>";
+                return false;
+            }
+            *directory = pair.second;
+        }
+    }
     return true;
 }
+
+unsigned DelphiCodeGenerator::GetJobCount(const std::vector<std::pair<std::string, std::string>> &parameters)
+{
+    for (const auto &pair : parameters) {
+        if (pair.first == "jobs") {
+            return std::max(std::atoi(pair.second.c_str()), 1);
+        }
+    }
+    return std::max(std::thread::hardware_concurrency(), 1u);
+}
@@ -14,6 +14,35 @@ public:
                           const std::string &parameter,
                           compiler::GeneratorContext *generator_context,
                           std::string *error) const;
+
+    virtual bool GenerateAll(const std::vector<const FileDescriptor *> &files,
+                             const std::string &parameter,
+                             compiler::GeneratorContext *generator_context,
+                             std::string *error) const;
+
+    virtual bool HasGenerateAll() const;
+
+    virtual uint64_t GetSupportedFeatures() const;
+
+private:
+    struct Unit
+    {
+        std::string name;
+        std::string content;
+        std::string layout;
+        std::string error;
+    };
+
+    static void Generate(const FileDescriptor *file,
+                         const std::vector<std::pair<std::string, std::string>> &parameters,
+                         Unit *unit);
+    static bool Write(const Unit &unit, compiler::GeneratorContext *generator_context, std::string *error);
+    static std::vector<std::string> GetFileNames(const std::string &unitName,
+                                                 const std::vector<std::pair<std::string, std::string>> &parameters);
+    static bool GetIncrementalDirectory(const std::vector<std::pair<std::string, std::string>> &parameters,
+                                        std::string *directory,
+                                        std::string *error);
+    static unsigned GetJobCount(const std::vector<std::pair<std::string, std::string>> &parameters);
 };
 
 #endif // DELPHICODEGENERATOR_H
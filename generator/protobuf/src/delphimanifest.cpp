@@ -0,0 +1,89 @@
+#include "delphimanifest.h"
+
+#include <fstream>
+#include <set>
+#include <sstream>
+
+#include <google/protobuf/descriptor.pb.h>
+
+#include "delphiutils.h"
+#include "generatorversion.h"
+
+const char *const DelphiManifest::FileName = "protoc-gen-delphi.manifest";
+
+DelphiManifest::DelphiManifest(const std::string &directory)
+    : _directory(directory)
+{
+    // each line holds the hash of a unit followed by its file name, a missing manifest being just empty
+    std::ifstream input(_directory + "/" + FileName);
+    std::string line;
+    while (std::getline(input, line)) {
+        std::istringstream fields(line);
+        uint64_t hash;
+        std::string filename;
+        if (fields >> std::hex >> hash >> filename) {
+            _hashes[filename] = hash;
+        }
+    }
+}
+
+bool DelphiManifest::IsUpToDate(const std::vector<std::string> &filenames, uint64_t hash) const
+{
+    for (const auto &filename : filenames) {
+        const auto it = _hashes.find(filename);
+        if (it == _hashes.end() || it->second != hash) {
+            return false;
+        }
+        // a file deleted since the last run has to be written again, along with the other outputs of its unit
+        if (!std::ifstream(_directory + "/" + filename).good()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DelphiManifest::Update(const std::vector<std::string> &filenames, uint64_t hash)
+{
+    for (const auto &filename : filenames) {
+        _hashes[filename] = hash;
+    }
+}
+
+std::string DelphiManifest::ToString() const
+{
+    std::ostringstream output;
+    output << std::hex;
+    for (const auto &pair : _hashes) {
+        output << pair.second << ' ' << pair.first << '\n';
+    }
+    return output.str();
+}
+
+uint64_t DelphiManifest::GetHash(const FileDescriptor *file,
+                                 const std::vector<std::pair<std::string, std::string>> &parameters)
+{
+    // the unit depends on the names and types declared by its imports as well, and on the generator itself
+    auto hash = GetFnv1aHash(DELPHI_GENERATOR_VERSION);
+    for (const auto &pair : parameters) {
+        // the output directory and the number of workers leave the content of the units as it is
+        if (pair.first != "incremental" && pair.first != "jobs") {
+            hash = GetFnv1aHash(pair.first + "=" + pair.second + ",", hash);
+        }
+    }
+    std::set<const FileDescriptor *> visited;
+    std::vector<const FileDescriptor *> pending{file};
+    while (!pending.empty()) {
+        const auto current = pending.back();
+        pending.pop_back();
+        if (!visited.insert(current).second) {
+            continue;
+        }
+        FileDescriptorProto proto;
+        current->CopyTo(&proto);
+        hash = GetFnv1aHash(proto.SerializeAsString(), hash);
+        for (int i = current->dependency_count() - 1; i >= 0; --i) {
+            pending.push_back(current->dependency(i));
+        }
+    }
+    return hash;
+}
@@ -0,0 +1,33 @@
+#ifndef DELPHIMANIFEST_H
+#define DELPHIMANIFEST_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/descriptor.h>
+
+using namespace google::protobuf;
+
+// Content hashes of the units written to an output directory, used to leave unchanged units untouched
+class DelphiManifest
+{
+public:
+    static const char *const FileName;
+
+    explicit DelphiManifest(const std::string &directory);
+
+    // the files are the outputs of a single unit, which is only up to date if all of them are
+    bool IsUpToDate(const std::vector<std::string> &filenames, uint64_t hash) const;
+    void Update(const std::vector<std::string> &filenames, uint64_t hash);
+    std::string ToString() const;
+
+    static uint64_t GetHash(const FileDescriptor *file,
+                            const std::vector<std::pair<std::string, std::string>> &parameters);
+
+private:
+    std::string _directory;
+    std::map<std::string, uint64_t> _hashes;
+};
+
+#endif // DELPHIMANIFEST_H
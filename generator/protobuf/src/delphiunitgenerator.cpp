@@ -1,6 +1,11 @@
 #include "delphiunitgenerator.h"
 
+#include <cstdio>
+#include <cstring>
+
+#include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/unknown_field_set.h>
 
 #include "delphiutils.h"
 
@@ -16,6 +21,30 @@ DelphiUnitGenerator::DelphiUnitGenerator(
             _emitJsonNames = true;
         } else if (pair.first == "emit_unused_types") {
             _emitUnusedTypes = true;
+        } else if (pair.first == "emit_codecs") {
+            _emitCodecs = true;
+        } else if (pair.first == "optimize_layout") {
+            _optimizeLayout = true;
+        } else if (pair.first == "emit_tables") {
+            _emitTables = true;
+        } else if (pair.first == "lazy_messages") {
+            _lazyFields = true;
+        } else if (pair.first == "box_messages") {
+            _boxFields = true;
+        } else if (pair.first == "emit_views") {
+            _emitViews = true;
+        } else if (pair.first == "overlap_oneofs") {
+            _overlapOneofs = true;
+        } else if (pair.first == "emit_presence") {
+            _emitPresence = true;
+        } else if (pair.first == "emit_schema") {
+            _emitSchema = true;
+        } else if (pair.first == "hash_maps") {
+            _hashMaps = true;
+        } else if (pair.first == "keep_unknown") {
+            _keepUnknown = true;
+        } else if (pair.first == "emit_layout") {
+            _emitLayout = true;
         }
     }
 }
@@ -25,14 +54,128 @@ void DelphiUnitGenerator::Generate(const FileDescriptor *desc)
     Print(desc);
 }
 
+void DelphiUnitGenerator::GenerateLayout(io::ZeroCopyOutputStream *stream)
+{
+    // the records of the unit as laid out for 64-bit targets, for the native codec, which fails to compile for other
+    // targets: the tables are defined in an unnamed namespace, so that every translation unit that includes them gets
+    // its own copy
+    io::Printer printer(stream, '$');
+    std::map<std::string, std::string> variables;
+    const auto &unitname = _variables["unitname"];
+    std::string namespaces;
+    std::string closing;
+    std::string scope;
+    for (size_t start = 0, end; start < unitname.size(); start = end + 1) {
+        end = std::min(unitname.find('.', start), unitname.size());
+        namespaces += (namespaces.empty() ? "" : " ") + ("namespace " + unitname.substr(start, end - start) + " {");
+        closing += "}";
+        scope += (scope.empty() ? "" : "::") + unitname.substr(start, end - start);
+    }
+    variables["guard"] = ::ToUpper(unitname) + "_LAYOUT_H";
+    std::replace(variables["guard"].begin(), variables["guard"].end(), '.', '_');
+    variables["namespaces"] = namespaces;
+    variables["closing"] = closing;
+    variables["scope"] = scope;
+    variables["unitname"] = unitname;
+    printer.Print(variables, "#ifndef $guard$\n#define $guard$\n\n#include \"delphicodec.h\"\n\n");
+    printer.Print(variables,
+                  "static_assert(sizeof(void *) == 8, \"The layouts of $unitname$ only hold for 64-bit targets\");\n\n");
+    printer.Print(variables, "$namespaces$\nnamespace {\n\n");
+    for (const auto message : _messages) {
+        variables["recordname"] = GetRecordName(message->full_name());
+        printer.Print(variables, "extern const dsc_message $recordname$;\n");
+    }
+    for (const auto message : _messages) {
+        std::map<const FieldDescriptor *, int> offsets;
+        std::map<const OneofDescriptor *, int> caseOffsets;
+        int presenceOffset;
+        int unknownOffset;
+        GetOffsets(message, offsets, caseOffsets, presenceOffset, unknownOffset);
+        variables["recordname"] = GetRecordName(message->full_name());
+        variables["fullname"] = message->full_name();
+        variables["count"] = std::to_string(message->field_count());
+        variables["size"] = std::to_string(GetLayout(message).size);
+        variables["unknownoffset"] = std::to_string(unknownOffset);
+        printer.Print(variables, "\n");
+        if (message->field_count() == 0) {
+            printer.Print(variables,
+                          "const dsc_message $recordname$ = {\"$fullname$\", nullptr, 0, $size$, $unknownoffset$};\n");
+            continue;
+        }
+        printer.Print(variables, "const dsc_field $recordname$Fields[] = {\n");
+        for (int i = 0; i < message->field_count(); ++i) {
+            const auto field = message->field(i);
+            const auto oneof = field->real_containing_oneof();
+            if (oneof && GetOrdinalSize(oneof->field_count()) > 1) {
+                throw std::runtime_error("Too many members in oneof for a table: " + oneof->full_name());
+            }
+            variables["number"] = std::to_string(field->number());
+            variables["kind"] = GetLayoutKind(field);
+            variables["flags"] = GetLayoutFlags(field);
+            variables["casevalue"] = oneof ? std::to_string(GetCaseValue(field)) : "0";
+            variables["offset"] = std::to_string(offsets[field]);
+            variables["caseoffset"] = oneof ? std::to_string(caseOffsets[oneof]) : "0";
+            if (HasPresenceBit(field)) {
+                // the bit of a field with presence is located like the case of a oneof
+                const auto bit = GetPresenceBit(field);
+                variables["casevalue"] = std::to_string(bit % 32);
+                variables["caseoffset"] = std::to_string(presenceOffset + bit / 32 * 4);
+            } else if (IsBounded(field)) {
+                // the values of a bounded field follow its count, and its capacity takes the case value
+                std::vector<int> boundedOffsets;
+                GetBoundedLayout(field, &boundedOffsets);
+                variables["casevalue"] = std::to_string(GetMaxCount(field));
+                variables["offset"] = std::to_string(offsets[field] + boundedOffsets[1]);
+                variables["caseoffset"] = std::to_string(offsets[field] + boundedOffsets[0]);
+            }
+            variables["message"] = field->message_type() ? "&" + GetRecordName(field->message_type()->full_name())
+                                                         : "nullptr";
+            printer.Print(variables,
+                          "    {$number$, $kind$, $flags$, $casevalue$, $offset$, $caseoffset$, $message$},\n");
+        }
+        printer.Print(variables, "};\n");
+        printer.Print(
+            variables,
+            "const dsc_message $recordname$ = {\"$fullname$\", $recordname$Fields, $count$, $size$, $unknownoffset$};\n");
+    }
+    printer.Print(variables, "\n} // namespace\n$closing$ // namespace $scope$\n\n#endif // $guard$\n");
+}
+
 void DelphiUnitGenerator::Print(const FileDescriptor *desc)
 {
     _printer.Print(_variables, "unit $unitname$;\n\n");
     _printer.Print(_variables, "{$$SCOPEDENUMS ON}\n\n");
+    if (_emitLayout) {
+        // the offsets of the layout header only hold for the default alignment of 64-bit targets, so that any other
+        // target fails to compile instead of having the native codec write past the fields
+        _printer.Print(_variables, "{$$ALIGN 8}\n");
+        _printer.Print(_variables, "{$$IF SizeOf(Pointer) <> 8}\n");
+        _printer.Print(_variables,
+                       "{$$MESSAGE FATAL 'The layouts of $unitname$.layout.h only hold for 64-bit targets'}\n");
+        _printer.Print(_variables, "{$$IFEND}\n\n");
+    }
     _printer.Print(_variables, "interface\n\n");
     _printer.Print(_variables, "uses\n");
     _printer.Indent();
-    _printer.Print(_variables, "Delphi.Serial;\n\n");
+    std::vector<std::string> units{"Delphi.Serial"};
+    if (_emitCodecs) {
+        units.insert(units.end(), {"Delphi.Serial.Protobuf.Types", "Delphi.Serial.Protobuf.Reader",
+                                   "Delphi.Serial.Protobuf.Writer"});
+    }
+    if (_emitTables) {
+        units.push_back("Delphi.Serial.Protobuf.Table");
+    }
+    if (_emitViews) {
+        if (!_emitCodecs) {
+            units.push_back("Delphi.Serial.Protobuf.Types");
+        }
+        units.push_back("Delphi.Serial.Protobuf.View");
+    }
+    for (const auto &unit : units) {
+        _variables["usedunit"] = unit;
+        _variables["separator"] = &unit == &units.back() ? ";\n" : ",";
+        _printer.Print(_variables, "$usedunit$$separator$\n");
+    }
     _printer.Outdent();
     _printer.Print(_variables, "type\n\n");
     _printer.Indent();
@@ -46,9 +189,119 @@ void DelphiUnitGenerator::Print(const FileDescriptor *desc)
     }
     _printer.Outdent();
     _printer.Print(_variables, "implementation\n\n");
+    std::vector<std::string> implementationUnits;
+    if (!_lazyMessages.empty()) {
+        implementationUnits.push_back("System.Classes");
+    }
+    if (_emitSchema) {
+        implementationUnits.push_back("Delphi.Serial.Protobuf.Schema");
+    }
+    if (!implementationUnits.empty()) {
+        _printer.Print(_variables, "uses\n");
+        for (const auto &unit : implementationUnits) {
+            _variables["usedunit"] = unit;
+            _variables["separator"] = &unit == &implementationUnits.back() ? ";\n" : ",";
+            _printer.Print(_variables, "  $usedunit$$separator$\n");
+        }
+    }
+    for (const auto &sparse : _sparseEnums) {
+        PrintSparseTables(sparse);
+    }
+    if (_emitJsonNames) {
+        for (const auto &dense : _denseEnums) {
+            PrintEnumNames(dense);
+        }
+        for (const auto message : _messages) {
+            PrintFieldNames(message);
+        }
+    }
+    for (const auto message : _boxedMessages) {
+        PrintBoxedMethods(message);
+    }
+    for (const auto entry : _mapEntries) {
+        PrintMapMethods(entry);
+    }
+    for (const auto field : _boundedFields) {
+        PrintBoundedMethods(field);
+    }
+    if (_emitCodecs) {
+        PrintTagConstants();
+        for (const auto message : _lazyMessages) {
+            PrintLazyMethods(message);
+        }
+        for (const auto message : _messages) {
+            PrintEncoder(message);
+            PrintSizer(message);
+            PrintDecoder(message);
+        }
+    }
+    if (_emitPresence) {
+        for (const auto message : _messages) {
+            PrintPresenceMethods(message);
+        }
+    }
+    if (_emitViews) {
+        for (const auto message : _messages) {
+            PrintViewMethods(message);
+        }
+    }
+    if (_emitSchema) {
+        PrintSchema(desc);
+    }
+    if (!_denseEnums.empty() || (_emitTables && !_messages.empty()) || _emitSchema) {
+        _printer.Print(_variables, "initialization\n\n");
+        if (_emitSchema) {
+            _printer.Print(_variables, "SchemaRegistry.Register(CSchema);\n");
+        }
+        for (const auto &dense : _denseEnums) {
+            _variables["enumname"] = dense.name;
+            _variables["tablename"] = "C" + dense.name.substr(1);
+            _printer.Print(_variables, "EnumRegistry.Register(TypeInfo($enumname$), $tablename$ByValue);\n");
+        }
+        if (_emitTables) {
+            for (const auto message : _messages) {
+                PrintTable(message);
+            }
+        }
+        _printer.Print(_variables, "\n");
+    }
     _printer.Print(_variables, "end.\n");
 }
 
+void DelphiUnitGenerator::PrintSchema(const FileDescriptor *desc)
+{
+    // the file and the files it imports, since their types are declared in the unit as well, as a FileDescriptorSet
+    // without the options, ranges, services and comments that the runtime does not describe
+    std::vector<const FileDescriptor *> files;
+    GetSchemaFiles(desc, files);
+    FileDescriptorSet schema;
+    for (const auto file : files) {
+        const auto proto = schema.add_file();
+        file->CopyTo(proto);
+        file->CopyJsonNameTo(proto);
+        Strip(proto);
+    }
+    std::string bytes;
+    schema.SerializeToString(&bytes);
+    _variables["schemahigh"] = std::to_string(bytes.size() - 1);
+    _printer.Print(_variables, "const\n");
+    _printer.Print(_variables, "  CSchema: array [0 .. $schemahigh$] of Byte = (\n");
+    _printer.Indent();
+    _printer.Indent();
+    for (std::size_t i = 0; i < bytes.size(); i += 16) {
+        std::string line;
+        for (auto k = i; k < std::min(i + 16, bytes.size()); ++k) {
+            line += (k > i ? ", " : "") + GetHexLiteral(static_cast<unsigned char>(bytes[k]));
+        }
+        _variables["schemabytes"] = line;
+        _variables["separator"] = i + 16 < bytes.size() ? "," : "";
+        _printer.Print(_variables, "$schemabytes$$separator$\n");
+    }
+    _printer.Outdent();
+    _printer.Outdent();
+    _printer.Print(_variables, "  );\n\n");
+}
+
 std::string DelphiUnitGenerator::Print(const Descriptor *desc)
 {
     const auto recordname = GetRecordName(desc->full_name());
@@ -64,44 +317,362 @@ std::string DelphiUnitGenerator::Print(const Descriptor *desc)
         }
     }
     const auto fields = GetFields(desc);
+    if (_optimizeLayout) {
+        std::vector<Layout> layouts;
+        for (const auto &group : GetFieldGroups(desc)) {
+            layouts.push_back(GetLayout(group));
+        }
+        GOOGLE_LOG(INFO) << recordname << ": " << GetRecordLayout(layouts).size << " bytes in declaration order, "
+                         << GetLayout(desc).size << " bytes with optimized layout, on 64-bit targets";
+    }
 
+    for (int i = 0; i < desc->real_oneof_decl_count(); ++i) {
+        PrintCase(desc->oneof_decl(i));
+    }
     _variables["recordname"] = recordname;
     _printer.Print(_variables, "$recordname$ = record\n");
     _printer.Indent();
     const OneofDescriptor *oneof = nullptr;
+    auto variant = false;
     for (const auto &field : fields) {
-        const auto containingOneof = field.desc->containing_oneof();
+        const auto containingOneof = field.desc->real_containing_oneof();
         if (containingOneof != oneof) {
+            if (variant) {
+                _printer.Outdent();
+                variant = false;
+            }
             Print(containingOneof, oneof);
             oneof = containingOneof;
         }
-        Print(field);
+        if (!IsOverlaid(field.desc)) {
+            Print(field);
+            continue;
+        }
+        if (!variant) {
+            // the case of the oneof selects the member, so the variant part needs no tag field of its own
+            _printer.Print(_variables, "case Byte of\n");
+            _printer.Indent();
+            variant = true;
+        }
+        PrintVariant(field);
+    }
+    if (variant) {
+        _printer.Outdent();
     }
     Print(nullptr, oneof);
+    if (_emitTables) {
+        _printer.Print(_variables, "class var Table: MessageTable;\n");
+    }
+    if (_emitJsonNames) {
+        _printer.Print(_variables, "class function FindFieldTag(const AName: string): Integer; static;\n");
+    }
+    if (_emitCodecs) {
+        _printer.Print(_variables, "procedure SerializeTo(AWriter: TWriter);\n");
+        _printer.Print(_variables, "procedure ParseFrom(AReader: TReader);\n");
+        _printer.Print(_variables, "function ComputeSize(AWriter: TWriter): Integer;\n");
+    }
+    for (const auto &field : fields) {
+        if (HasPresenceBit(field.desc)) {
+            _variables["fieldname"] = GetPascalCase(field.desc->name());
+            _variables["fieldtype"] = field.type;
+            _printer.Print(_variables, "function Has$fieldname$: Boolean; inline;\n");
+            _printer.Print(_variables, "procedure Set$fieldname$(const AValue: $fieldtype$); inline;\n");
+            _printer.Print(_variables, "procedure Clear$fieldname$; inline;\n");
+        }
+    }
+    const auto words = GetPresenceWordCount(desc);
+    if (_emitCodecs || words > 0 || KeepsUnknown(desc)) {
+        _printer.Print(_variables, "private\n");
+    }
+    if (words > 0) {
+        // one bit per field with presence, in the order of the fields, which the codecs test instead of the values
+        _variables["presencetype"] = words == 1 ? "UInt32" : "array [0 .. " + std::to_string(words - 1) + "] of UInt32";
+        _printer.Print(_variables, "  FPresence: $presencetype$;\n");
+    }
+    if (KeepsUnknown(desc)) {
+        // the fields that the record does not declare, as they were read, so that they are encoded back unchanged
+        _printer.Print(_variables, "  FUnknown: Bytes;\n");
+    }
+    if (_emitCodecs) {
+        _printer.Print(_variables, "  procedure EncodeTo(AWriter: TWriter);\n");
+    }
     _printer.Outdent();
     _printer.Print(_variables, "end;\n\n");
+    _messages.push_back(desc);
+    if (_emitViews) {
+        PrintView(desc);
+    }
     return recordname;
 }
 
+void DelphiUnitGenerator::PrintView(const Descriptor *desc)
+{
+    // the view of a message follows its record, so that the views of the messages it contains are declared first
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _printer.Print(_variables, "$recordname$View = record\n");
+    _printer.Indent();
+    _printer.Print(_variables, "FMessage: MessageView;\n");
+    _printer.Print(_variables, "class function Create(const AMessage: MessageView): $recordname$View; overload; static;\n");
+    _printer.Print(_variables, "class function Create(const AValue: FieldValue): $recordname$View; overload; static;\n");
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        if (field->type() == FieldDescriptor::TYPE_GROUP) {
+            continue;
+        }
+        _variables["fieldname"] = GetPascalCase(field->name());
+        _variables["viewtype"] = GetViewType(field);
+        if (!field->is_repeated()) {
+            _printer.Print(_variables, "function Has$fieldname$: Boolean;\n");
+        }
+        _printer.Print(_variables, "function Get$fieldname$: $viewtype$;\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+}
+
+std::string DelphiUnitGenerator::PrintLazy(const Descriptor *desc)
+{
+    // the value comes first and the encoding next, so that the table codecs can locate both from the message size
+    const auto recordname = Print(desc);
+    const auto lazyname = "TLazy" + recordname.substr(1);
+    if (!_types.emplace(lazyname).second)
+        return lazyname;
+
+    _variables["recordname"] = recordname;
+    _variables["lazyname"] = lazyname;
+    _printer.Print(_variables, "$lazyname$ = record\n");
+    _printer.Indent();
+    _printer.Print(_variables, "private\n");
+    _printer.Print(_variables, "  FValue: $recordname$;\n");
+    _printer.Print(_variables, "  FEncoded: Bytes; // the encoding of the value, until it is first accessed\n");
+    _printer.Print(_variables, "  FParsed: Boolean;\n");
+    _printer.Print(_variables, "  function GetValue: $recordname$;\n");
+    _printer.Print(_variables, "  procedure SetValue(const AValue: $recordname$);\n");
+    _printer.Print(_variables, "public\n");
+    _printer.Print(_variables, "  property Value: $recordname$ read GetValue write SetValue;\n");
+    _printer.Print(_variables, "  property Parsed: Boolean read FParsed;\n");
+    _printer.Print(_variables, "  function ComputeSize(AWriter: TWriter): Integer;\n");
+    _printer.Print(_variables, "  procedure EncodeTo(AWriter: TWriter);\n");
+    _printer.Print(_variables, "  procedure MergeFrom(AReader: TReader);\n");
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+    _lazyMessages.push_back(desc);
+    return lazyname;
+}
+
+std::string DelphiUnitGenerator::PrintBoxed(const Descriptor *desc)
+{
+    // the box is a dynamic array, which takes a single pointer while the message is absent and is released along with
+    // the record that holds it
+    const auto recordname = Print(desc);
+    const auto boxedname = "TBoxed" + recordname.substr(1);
+    if (!_types.emplace(boxedname).second)
+        return boxedname;
+
+    _variables["recordname"] = recordname;
+    _variables["boxedname"] = boxedname;
+    _printer.Print(_variables, "$boxedname$ = record\n");
+    _printer.Indent();
+    _printer.Print(_variables, "private\n");
+    _printer.Print(_variables, "  FBox: TArray<$recordname$>; // empty while the message is absent\n");
+    _printer.Print(_variables, "  function GetValue: $recordname$;\n");
+    _printer.Print(_variables, "  procedure SetValue(const AValue: $recordname$);\n");
+    _printer.Print(_variables, "public\n");
+    _printer.Print(_variables, "  property Value: $recordname$ read GetValue write SetValue;\n");
+    _printer.Print(_variables, "  function HasValue: Boolean; inline;\n");
+    _printer.Print(_variables, "  procedure Clear; inline;\n");
+    if (_emitCodecs) {
+        _printer.Print(_variables, "  function ComputeSize(AWriter: TWriter): Integer;\n");
+        _printer.Print(_variables, "  procedure EncodeTo(AWriter: TWriter);\n");
+        _printer.Print(_variables, "  procedure MergeFrom(AReader: TReader);\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+    _boxedMessages.push_back(desc);
+    return boxedname;
+}
+
+std::string DelphiUnitGenerator::PrintMap(const Descriptor *desc)
+{
+    // the entries stay in a dynamic array, which the table-driven and native codecs decode as a repeated message, and
+    // the slots are rebuilt when the count of entries they index no longer matches
+    const auto entryname = Print(desc);
+    const auto mapname = GetMapName(desc);
+    if (!_types.emplace(mapname).second)
+        return mapname;
+
+    _variables["entryname"] = entryname;
+    _variables["mapname"] = mapname;
+    _variables["keytype"] = GetFieldType(desc->map_key());
+    _variables["valuetype"] = GetFieldType(desc->map_value());
+    _printer.Print(_variables, "$mapname$ = record\n");
+    _printer.Indent();
+    _printer.Print(_variables, "private\n");
+    _printer.Print(_variables, "  FEntries: TArray<$entryname$>; // in the order their keys were added\n");
+    _printer.Print(_variables, "  FSlots: TArray<Int32>; // one plus the index of the entry whose key hashes to each slot, or zero\n");
+    _printer.Print(_variables, "  FIndexed: Integer; // the count of entries in the slots\n");
+    _printer.Print(_variables, "  procedure Reindex;\n");
+    _printer.Print(_variables, "  procedure EnsureIndexed; inline;\n");
+    _printer.Print(_variables, "  function Find(const AKey: $keytype$; out ASlot: Integer): Boolean;\n");
+    _printer.Print(_variables, "  function GetItem(const AKey: $keytype$): $valuetype$;\n");
+    _printer.Print(_variables, "  procedure SetItem(const AKey: $keytype$; const AValue: $valuetype$);\n");
+    _printer.Print(_variables, "  function GetCount: Integer;\n");
+    _printer.Print(_variables, "  function GetEntries: TArray<$entryname$>;\n");
+    _printer.Print(_variables, "public\n");
+    _printer.Print(_variables, "  property Items[const AKey: $keytype$]: $valuetype$ read GetItem write SetItem; default;\n");
+    _printer.Print(_variables, "  property Count: Integer read GetCount;\n");
+    _printer.Print(_variables, "  property Entries: TArray<$entryname$> read GetEntries;\n");
+    _printer.Print(_variables, "  function ContainsKey(const AKey: $keytype$): Boolean;\n");
+    _printer.Print(_variables, "  function TryGetValue(const AKey: $keytype$; out AValue: $valuetype$): Boolean;\n");
+    _printer.Print(_variables, "  procedure AddOrSetValue(const AKey: $keytype$; const AValue: $valuetype$);\n");
+    _printer.Print(_variables, "  function Remove(const AKey: $keytype$): Boolean;\n");
+    _printer.Print(_variables, "  procedure Clear;\n");
+    if (_emitCodecs) {
+        _printer.Print(_variables, "  procedure MergeFrom(AReader: TReader);\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+    _mapEntries.push_back(desc);
+    return mapname;
+}
+
+std::string DelphiUnitGenerator::PrintBounded(const FieldDescriptor *desc)
+{
+    // the count comes first and the values next, so that the table codecs can locate both, and the values past the
+    // count are kept at their default, so that a decoder can append to them in place
+    const auto elementtype = GetFieldType(desc);
+    const auto boundedname = GetBoundedName(desc);
+    if (!_types.emplace(boundedname).second)
+        return boundedname;
+
+    _variables["elementtype"] = elementtype;
+    _variables["boundedname"] = boundedname;
+    _variables["high"] = std::to_string(GetMaxCount(desc) - 1);
+    _printer.Print(_variables, "$boundedname$ = record\n");
+    _printer.Indent();
+    _printer.Print(_variables, "private\n");
+    _printer.Print(_variables, "  FCount: Integer;\n");
+    _printer.Print(_variables, "  FItems: array [0 .. $high$] of $elementtype$;\n");
+    _printer.Print(_variables, "  function GetItem(AIndex: Integer): $elementtype$;\n");
+    _printer.Print(_variables, "  procedure SetItem(AIndex: Integer; const AValue: $elementtype$);\n");
+    _printer.Print(_variables, "  procedure Grow;\n");
+    _printer.Print(_variables, "public\n");
+    _printer.Print(_variables, "  property Items[AIndex: Integer]: $elementtype$ read GetItem write SetItem; default;\n");
+    _printer.Print(_variables, "  property Count: Integer read FCount;\n");
+    _printer.Print(_variables, "  procedure Add(const AValue: $elementtype$);\n");
+    _printer.Print(_variables, "  procedure Clear;\n");
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+    _boundedFields.push_back(desc);
+    return boundedname;
+}
+
 std::string DelphiUnitGenerator::Print(const EnumDescriptor *desc)
 {
     const auto enumname = GetEnumName(desc->full_name());
     if (!_types.emplace(enumname).second)
         return enumname;
 
+    const auto values = GetEnumValues(desc);
+    if (IsSparse(values)) {
+        PrintSparse(desc, values);
+        return enumname;
+    }
     _variables["enumname"] = enumname;
     _printer.Print(_variables, "$enumname$ = (\n");
     _printer.Indent();
     EnumContext context;
     context.nameprefix = GetPascalCase(desc->name());
-    for (const auto &enumerator : GetEnumValues(desc)) {
+    for (const auto &enumerator : values) {
         Print(enumerator, context);
     }
     _printer.Outdent();
     _printer.Print(_variables, ");\n\n");
+    if (_emitJsonNames) {
+        _denseEnums.push_back({enumname, std::move(context.values), context.nextNumber});
+    }
     return enumname;
 }
 
+void DelphiUnitGenerator::PrintSparse(const EnumDescriptor *desc, const std::vector<EnumValue> &values)
+{
+    // a sparse enum becomes a distinct integer type, its values being constants of a helper instead of enumerators
+    SparseEnum sparse;
+    sparse.name = GetEnumName(desc->full_name());
+    const auto nameprefix = GetPascalCase(desc->name());
+    std::set<std::string> names;
+    for (const auto &value : values) {
+        const auto valuename = GetEnumValueName(value.name, nameprefix);
+        if (!names.emplace(ToLower(valuename)).second) {
+            GOOGLE_LOG(WARNING)
+                << "Enum name ignored because it would result in identifier redeclared: " << value.name;
+            continue;
+        }
+        sparse.values.push_back({valuename, value.number, false});
+    }
+    _variables["enumname"] = sparse.name;
+    _printer.Print(_variables, "$enumname$ = type Int32;\n\n");
+    _printer.Print(_variables, "$enumname$Helper = record helper for $enumname$\n");
+    _printer.Indent();
+    _printer.Print(_variables, "const\n");
+    _printer.Indent();
+    for (const auto &value : sparse.values) {
+        _variables["valuename"] = value.name;
+        _variables["valuenumber"] = std::to_string(value.number);
+        _printer.Print(_variables, "&$valuename$ = $enumname$($valuenumber$);\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "function TryGetName(out AName: string): Boolean;\n");
+    _printer.Print(_variables, "class function TryParse(const AName: string; out AValue: $enumname$): Boolean; static;\n");
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+    _sparseEnums.push_back(std::move(sparse));
+}
+
+void DelphiUnitGenerator::PrintSparseTables(const SparseEnum &sparse)
+{
+    // lookup tables sorted by value and by name, so that both directions can use a binary search
+    auto byValue = sparse.values;
+    auto byName = sparse.values;
+    std::stable_sort(byValue.begin(), byValue.end(), [](const EnumValue &lhs, const EnumValue &rhs) {
+        return lhs.number < rhs.number;
+    });
+    byValue.erase(std::unique(byValue.begin(), byValue.end(), [](const EnumValue &lhs, const EnumValue &rhs) {
+        return lhs.number == rhs.number; // aliases share the name of the first value
+    }), byValue.end());
+    std::sort(byName.begin(), byName.end(), [](const EnumValue &lhs, const EnumValue &rhs) {
+        return lhs.name < rhs.name;
+    });
+    _variables["enumname"] = sparse.name;
+    _variables["tablename"] = "C" + sparse.name.substr(1);
+    _printer.Print(_variables, "const\n");
+    _printer.Indent();
+    for (const auto &table : {std::make_pair("ByValue", &byValue), std::make_pair("ByName", &byName)}) {
+        _variables["tablesuffix"] = table.first;
+        _variables["tablehigh"] = std::to_string(table.second->size() - 1);
+        _printer.Print(_variables, "$tablename$$tablesuffix$: array [0 .. $tablehigh$] of NamedValue = (\n");
+        _printer.Indent();
+        for (const auto &value : *table.second) {
+            _variables["valuename"] = value.name;
+            _variables["valuenumber"] = std::to_string(value.number);
+            _variables["separator"] = &value == &table.second->back() ? "" : ",";
+            _printer.Print(_variables, "(FValue: $valuenumber$; FName: '$valuename$')$separator$\n");
+        }
+        _printer.Outdent();
+        _printer.Print(_variables, ");\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "\n");
+    _printer.Print(_variables, "function $enumname$Helper.TryGetName(out AName: string): Boolean;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result := SparseEnum.TryGetName($tablename$ByValue, Self, AName);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "class function $enumname$Helper.TryParse(const AName: string; out AValue: $enumname$): Boolean;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result := SparseEnum.TryGetValue($tablename$ByName, AName, Int32(AValue));\n");
+    _printer.Print(_variables, "end;\n\n");
+}
+
 void DelphiUnitGenerator::Print(const EnumValue &value, EnumContext &context)
 {
     const auto valuename = GetEnumValueName(value.name, context.nameprefix);
@@ -121,6 +692,7 @@ void DelphiUnitGenerator::Print(const EnumValue &value, EnumContext &context)
     } else {
         _printer.Print(_variables, "&$valuename$ = $valuenumber$,\n");
     }
+    context.values.push_back({valuename, value.number, false});
     context.nextNumber = value.number + 1;
 }
 
@@ -137,12 +709,23 @@ void DelphiUnitGenerator::Print(const EnumValue &value)
 
 void DelphiUnitGenerator::Print(const Field &field)
 {
-    const auto fieldoptions = GetFieldOptions(field.desc);
-    _variables["fieldname"] = GetFieldName(field.desc->name());
-    _variables["fieldtype"] = field.desc->is_repeated() ? GetArrayType(field.type) : field.type;
-    _variables["fieldtag"] = std::to_string(field.desc->number());
-    _variables["fieldoptions"] = fieldoptions;
-    _printer.Print(_variables, "[Tag($fieldtag$)$fieldoptions$] $fieldname$: $fieldtype$;\n");
+    _variables["declaration"] = GetFieldDeclaration(field);
+    _printer.Print(_variables, "$declaration$;\n");
+}
+
+void DelphiUnitGenerator::PrintVariant(const Field &field)
+{
+    _variables["declaration"] = GetFieldDeclaration(field);
+    _variables["casenumber"] = std::to_string(GetCaseValue(field.desc));
+    _printer.Print(_variables, "$casenumber$: ($declaration$);\n");
+}
+
+std::string DelphiUnitGenerator::GetFieldDeclaration(const Field &field)
+{
+    const auto isArray = field.desc->is_repeated() && !IsMap(field.desc) && !IsBounded(field.desc);
+    const auto fieldtype = isArray ? GetArrayType(field.type) : field.type;
+    return "[Tag(" + std::to_string(field.desc->number()) + ")" + GetFieldOptions(field.desc) + "] "
+         + GetFieldName(field.desc->name()) + ": " + fieldtype;
 }
 
 std::string DelphiUnitGenerator::GetFieldOptions(const FieldDescriptor *desc)
@@ -171,101 +754,1981 @@ void DelphiUnitGenerator::Print(const OneofDescriptor *oneof, bool closePrevious
     }
     if (oneof) {
         _variables["fieldname"] = GetFieldName(oneof->name());
+        _variables["casename"] = GetCaseName(oneof->full_name());
         _printer.Print(_variables, "[Oneof] $fieldname$: record\n");
         _printer.Indent();
-        _printer.Print(_variables, "[Oneof] FCase: (\n");
-        _printer.Indent();
-        for (const auto &enumerator : GetEnumValues(oneof)) {
-            Print(enumerator);
+        _printer.Print(_variables, "[Oneof] FCase: $casename$;\n");
+    }
+}
+
+void DelphiUnitGenerator::PrintCase(const OneofDescriptor *oneof)
+{
+    // the case of a oneof is a named enumeration, so that its members can be selected by name under scoped enums
+    _variables["casename"] = GetCaseName(oneof->full_name());
+    _printer.Print(_variables, "$casename$ = (\n");
+    _printer.Indent();
+    for (const auto &enumerator : GetEnumValues(oneof)) {
+        Print(enumerator);
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, ");\n\n");
+}
+
+void DelphiUnitGenerator::PrintEnumNames(const DenseEnum &dense)
+{
+    // the names indexed by value, left empty for the missing values so that the serializers fall back to RTTI for them
+    std::vector<std::string> byValue(dense.count);
+    for (auto value = dense.values.rbegin(); value != dense.values.rend(); ++value) {
+        byValue[value->number] = value->name; // aliases share the name of the first value
+    }
+    _variables["tablename"] = "C" + dense.name.substr(1);
+    _variables["tablehigh"] = std::to_string(dense.count - 1);
+    _printer.Print(_variables, "const\n");
+    _printer.Indent();
+    _printer.Print(_variables, "$tablename$ByValue: array [0 .. $tablehigh$] of string = (\n");
+    _printer.Indent();
+    for (int k = 0; k < dense.count; ++k) {
+        _variables["valuename"] = byValue[k];
+        _variables["separator"] = k + 1 < dense.count ? "," : "";
+        _printer.Print(_variables, "'$valuename$'$separator$\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, ");\n");
+    _printer.Outdent();
+    _printer.Print(_variables, "\n");
+}
+
+void DelphiUnitGenerator::PrintFieldNames(const Descriptor *desc)
+{
+    // both the JSON name and the original name of a field are accepted, as protobuf does when parsing JSON, and a JSON
+    // name wins over the original name of another field, which a json_name option can make identical
+    std::vector<NamedValue> names;
+    std::set<std::string> unique;
+    for (const auto original : {false, true}) {
+        for (int i = 0; i < desc->field_count(); ++i) {
+            const auto field = desc->field(i);
+            const auto &name = original ? field->name() : field->json_name();
+            if (unique.insert(name).second) {
+                names.push_back({name, field->number()});
+            }
         }
+    }
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _variables["tablename"] = "C" + GetFullName(desc->full_name()) + "Field";
+    if (!names.empty()) {
+        _printer.Print(_variables, "const\n");
+        _printer.Indent();
+        PrintPerfectHash(names);
         _printer.Outdent();
-        _printer.Print(_variables, ");\n");
+        _printer.Print(_variables, "\n");
+    }
+    _printer.Print(_variables, "class function $recordname$.FindFieldTag(const AName: string): Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    if (names.empty()) {
+        _printer.Print(_variables, "  Result := 0;\n");
+    } else {
+        _printer.Print(_variables, "  if not PerfectHash.TryGetValue($tablename$Seeds, $tablename$Names, AName, Result) then\n");
+        _printer.Print(_variables, "    Result := 0;\n");
     }
+    _printer.Print(_variables, "end;\n\n");
 }
 
-auto DelphiUnitGenerator::GetEnumValues(const EnumDescriptor *desc) -> std::vector<EnumValue>
+void DelphiUnitGenerator::PrintPerfectHash(const std::vector<NamedValue> &values)
 {
-    std::vector<EnumValue> result;
-    result.reserve(desc->value_count());
-    for (int i = 0; i < desc->value_count(); ++i) {
-        const auto value = desc->value(i);
-        result.push_back({value->name(), value->number(), false});
+    std::vector<std::string> keys;
+    for (const auto &value : values) {
+        keys.push_back(value.name);
     }
-    std::sort(result.begin(), result.end(), [](const EnumValue &lhs, const EnumValue &rhs) {
-        return lhs.number < rhs.number;
-    });
-    result.back().isLast = true;
-    return result;
+    std::vector<int32_t> seeds;
+    std::vector<int> slots;
+    if (!GetPerfectHash(keys, seeds, slots)) {
+        throw std::runtime_error("No perfect hash found for " + _variables["tablename"]);
+    }
+    _variables["tablehigh"] = std::to_string(values.size() - 1);
+    _printer.Print(_variables, "$tablename$Seeds: array [0 .. $tablehigh$] of Int32 = (\n");
+    _printer.Indent();
+    for (std::size_t i = 0; i < seeds.size(); i += 16) {
+        std::string line;
+        for (auto k = i; k < std::min(i + 16, seeds.size()); ++k) {
+            line += (k > i ? ", " : "") + std::to_string(seeds[k]);
+        }
+        _variables["seeds"] = line;
+        _variables["separator"] = i + 16 < seeds.size() ? "," : "";
+        _printer.Print(_variables, "$seeds$$separator$\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, ");\n");
+    _printer.Print(_variables, "$tablename$Names: array [0 .. $tablehigh$] of NamedValue = (\n");
+    _printer.Indent();
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        _variables["valuename"] = values[slots[i]].name;
+        _variables["valuenumber"] = std::to_string(values[slots[i]].number);
+        _variables["separator"] = i + 1 < slots.size() ? "," : "";
+        _printer.Print(_variables, "(FValue: $valuenumber$; FName: '$valuename$')$separator$\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, ");\n");
 }
 
-auto DelphiUnitGenerator::GetEnumValues(const OneofDescriptor *desc) -> std::vector<EnumValue>
+void DelphiUnitGenerator::PrintTable(const Descriptor *desc)
 {
-    std::vector<EnumValue> result;
-    result.reserve(desc->field_count() + 1);
-    result.push_back({desc->full_name() + "Unspecified", 0, false});
+    // offsets are not constant expressions in Delphi, so the tables are filled in when the unit is initialized
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _variables["unknown"] = KeepsUnknown(desc) ? ", NativeInt(@" + _variables["recordname"] + "(nil^).FUnknown)" : "";
+    if (desc->field_count() == 0) {
+        _printer.Print(_variables, "$recordname$.Table := MessageTable.Create(TypeInfo($recordname$), []$unknown$);\n");
+        return;
+    }
+    _printer.Print(_variables, "$recordname$.Table := MessageTable.Create(TypeInfo($recordname$), [\n");
+    _printer.Indent();
     for (int i = 0; i < desc->field_count(); ++i) {
         const auto field = desc->field(i);
-        assert(i == field->index_in_oneof());
-        result.push_back({field->full_name(), i + 1, false});
+        const auto oneof = field->real_containing_oneof();
+        std::string arguments = std::to_string(field->number()) + ", " + GetTableKind(field) + ", "
+                              + GetTableFlags(field) + ", @" + _variables["recordname"] + "(nil^)."
+                              + GetFieldAccess(field) + (IsBounded(field) ? ".FItems" : "");
+        if (field->is_repeated() || field->message_type() || oneof || HasPresenceBit(field)) {
+            if (IsBounded(field)) {
+                // the values are held by the record, so there is no dynamic array to resize
+                arguments += ", nil";
+            } else if (IsMap(field)) {
+                // the entries of a map record come first, so that it is decoded as a repeated message
+                arguments += ", TypeInfo(TArray<" + GetRecordName(field->message_type()->full_name()) + ">)";
+            } else if (field->is_repeated()) {
+                arguments += ", TypeInfo(TArray<" + GetFieldType(field) + ">)";
+            } else if (IsBoxed(field)) {
+                arguments += ", TypeInfo(TArray<" + GetRecordName(field->message_type()->full_name()) + ">)";
+            } else {
+                arguments += ", nil";
+            }
+            arguments += field->message_type() ? ", @" + GetRecordName(field->message_type()->full_name()) + ".Table"
+                                               : ", nil";
+        }
+        if (oneof) {
+            if (GetOrdinalSize(oneof->field_count()) > 1) {
+                throw std::runtime_error("Too many members in oneof for a table: " + oneof->full_name());
+            }
+            arguments += ", @" + _variables["recordname"] + "(nil^)." + GetFieldName(oneof->name()) + ".FCase, "
+                       + std::to_string(GetCaseValue(field));
+        } else if (HasPresenceBit(field)) {
+            arguments += ", @" + _variables["recordname"] + "(nil^)." + GetPresenceWord(field) + ", "
+                       + std::to_string(GetPresenceBit(field) % 32);
+        } else if (IsBounded(field)) {
+            // the count of a bounded field is located like the case of a oneof, and its capacity takes the case value
+            arguments += ", @" + _variables["recordname"] + "(nil^)." + GetFieldAccess(field) + ".FCount, "
+                       + std::to_string(GetMaxCount(field));
+        }
+        _variables["arguments"] = arguments;
+        _variables["separator"] = i + 1 < desc->field_count() ? "," : "]" + _variables["unknown"] + ");";
+        _printer.Print(_variables, "FieldEntry.Create($arguments$)$separator$\n");
     }
-    result.back().isLast = true;
-    return result;
+    _printer.Outdent();
 }
 
-auto DelphiUnitGenerator::GetFields(const Descriptor *desc) -> std::vector<Field>
+void DelphiUnitGenerator::PrintBoxedMethods(const Descriptor *desc)
 {
-    std::vector<Field> result;
-    result.reserve(desc->field_count());
-    for (int i = 0; i < desc->field_count(); ++i) {
-        const auto field = desc->field(i);
-        result.push_back({GetFieldType(field), field});
+    const auto recordname = GetRecordName(desc->full_name());
+    _variables["recordname"] = recordname;
+    _variables["boxedname"] = "TBoxed" + recordname.substr(1);
+    _printer.Print(_variables, "function $boxedname$.GetValue: $recordname$;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FBox <> nil then\n");
+    _printer.Print(_variables, "    Result := FBox[0]\n");
+    _printer.Print(_variables, "  else\n");
+    _printer.Print(_variables, "    Result := Default($recordname$);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boxedname$.SetValue(const AValue: $recordname$);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  FBox := [AValue];\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $boxedname$.HasValue: Boolean;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result := FBox <> nil;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boxedname$.Clear;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  FBox := nil;\n");
+    _printer.Print(_variables, "end;\n\n");
+    if (!_emitCodecs) {
+        return;
     }
-    return result;
+    _printer.Print(_variables, "function $boxedname$.ComputeSize(AWriter: TWriter): Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result := FBox[0].ComputeSize(AWriter);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boxedname$.EncodeTo(AWriter: TWriter);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  FBox[0].EncodeTo(AWriter);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boxedname$.MergeFrom(AReader: TReader);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  SetLength(FBox, 1); // allocates the box, or copies it if it is shared\n");
+    _printer.Print(_variables, "  AReader.BeginLengthPrefixed;\n");
+    _printer.Print(_variables, "  FBox[0].ParseFrom(AReader);\n");
+    _printer.Print(_variables, "  AReader.EndLengthPrefixed;\n");
+    _printer.Print(_variables, "end;\n\n");
 }
 
-std::string DelphiUnitGenerator::GetFieldType(const FieldDescriptor *desc)
+void DelphiUnitGenerator::PrintMapMethods(const Descriptor *desc)
 {
-    switch (desc->type()) {
-    case FieldDescriptor::TYPE_ENUM:
-        return Print(desc->enum_type());
-    case FieldDescriptor::TYPE_GROUP:
-    case FieldDescriptor::TYPE_MESSAGE:
-        return Print(desc->message_type());
-    default:
-        return desc->type_name();
+    _variables["entryname"] = GetRecordName(desc->full_name());
+    _variables["mapname"] = GetMapName(desc);
+    _variables["keytype"] = GetFieldType(desc->map_key());
+    _variables["valuetype"] = GetFieldType(desc->map_value());
+    _variables["keyhash"] = GetKeyHash(desc->map_key());
+    _printer.Print(_variables, "procedure $mapname$.Reindex;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  I: Integer;\n");
+    _printer.Print(_variables, "  Count: Integer;\n");
+    _printer.Print(_variables, "  Slot: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  // a key found twice keeps the position of its first entry and the value of its last one, as in protobuf\n");
+    _printer.Print(_variables, "  SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared\n");
+    _printer.Print(_variables, "  FSlots := nil;\n");
+    _printer.Print(_variables, "  SetLength(FSlots, MapHash.SlotCount(Length(FEntries)));\n");
+    _printer.Print(_variables, "  Count := 0;\n");
+    _printer.Print(_variables, "  for I := 0 to High(FEntries) do\n");
+    _printer.Print(_variables, "    if Find(FEntries[I].FKey, Slot) then\n");
+    _printer.Print(_variables, "      FEntries[FSlots[Slot] - 1].FValue := FEntries[I].FValue\n");
+    _printer.Print(_variables, "    else\n");
+    _printer.Print(_variables, "      begin\n");
+    _printer.Print(_variables, "        if Count < I then\n");
+    _printer.Print(_variables, "          FEntries[Count] := FEntries[I];\n");
+    _printer.Print(_variables, "        Inc(Count);\n");
+    _printer.Print(_variables, "        FSlots[Slot] := Count;\n");
+    _printer.Print(_variables, "      end;\n");
+    _printer.Print(_variables, "  SetLength(FEntries, Count);\n");
+    _printer.Print(_variables, "  FIndexed := Count;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $mapname$.EnsureIndexed;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FIndexed <> Length(FEntries) then\n");
+    _printer.Print(_variables, "    Reindex; // entries were appended by a table-driven or native decoder\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.Find(const AKey: $keytype$; out ASlot: Integer): Boolean;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Index: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FSlots = nil then\n");
+    _printer.Print(_variables, "    Exit(False);\n");
+    _printer.Print(_variables, "  ASlot := $keyhash$ and High(FSlots);\n");
+    _printer.Print(_variables, "  Index := FSlots[ASlot];\n");
+    _printer.Print(_variables, "  while Index <> 0 do\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      if FEntries[Index - 1].FKey = AKey then\n");
+    _printer.Print(_variables, "        Exit(True);\n");
+    _printer.Print(_variables, "      ASlot := (ASlot + 1) and High(FSlots);\n");
+    _printer.Print(_variables, "      Index := FSlots[ASlot];\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "  Result := False;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.GetItem(const AKey: $keytype$): $valuetype$;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  TryGetValue(AKey, Result); // an absent key reads as the default value, as in protobuf\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $mapname$.SetItem(const AKey: $keytype$; const AValue: $valuetype$);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  AddOrSetValue(AKey, AValue);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.GetCount: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  Result := Length(FEntries);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.GetEntries: TArray<$entryname$>;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  Result := FEntries;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.ContainsKey(const AKey: $keytype$): Boolean;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Slot: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  Result := Find(AKey, Slot);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.TryGetValue(const AKey: $keytype$; out AValue: $valuetype$): Boolean;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Slot: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  Result := Find(AKey, Slot);\n");
+    _printer.Print(_variables, "  if Result then\n");
+    _printer.Print(_variables, "    AValue := FEntries[FSlots[Slot] - 1].FValue\n");
+    _printer.Print(_variables, "  else\n");
+    _printer.Print(_variables, "    AValue := Default($valuetype$);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $mapname$.AddOrSetValue(const AKey: $keytype$; const AValue: $valuetype$);\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Slot: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  if Find(AKey, Slot) then\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared\n");
+    _printer.Print(_variables, "      FEntries[FSlots[Slot] - 1].FValue := AValue;\n");
+    _printer.Print(_variables, "      Exit;\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "  SetLength(FEntries, Length(FEntries) + 1);\n");
+    _printer.Print(_variables, "  FEntries[High(FEntries)].FKey := AKey;\n");
+    _printer.Print(_variables, "  FEntries[High(FEntries)].FValue := AValue;\n");
+    _printer.Print(_variables, "  if 2 * Length(FEntries) > Length(FSlots) then\n");
+    _printer.Print(_variables, "    Reindex // grows the slots, so that at most half of them are in use\n");
+    _printer.Print(_variables, "  else\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      SetLength(FSlots, Length(FSlots)); // copies the slots if they are shared\n");
+    _printer.Print(_variables, "      FSlots[Slot] := Length(FEntries);\n");
+    _printer.Print(_variables, "      FIndexed := Length(FEntries);\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $mapname$.Remove(const AKey: $keytype$): Boolean;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Slot: Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  EnsureIndexed;\n");
+    _printer.Print(_variables, "  Result := Find(AKey, Slot);\n");
+    _printer.Print(_variables, "  if Result then\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      // the other entries keep their order, and the slots are rebuilt since their indexes change\n");
+    _printer.Print(_variables, "      SetLength(FEntries, Length(FEntries));\n");
+    _printer.Print(_variables, "      Delete(FEntries, FSlots[Slot] - 1, 1);\n");
+    _printer.Print(_variables, "      Reindex;\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $mapname$.Clear;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  FEntries := nil;\n");
+    _printer.Print(_variables, "  FSlots := nil;\n");
+    _printer.Print(_variables, "  FIndexed := 0;\n");
+    _printer.Print(_variables, "end;\n\n");
+    if (!_emitCodecs) {
+        return;
     }
+    _printer.Print(_variables, "procedure $mapname$.MergeFrom(AReader: TReader);\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Entry: $entryname$;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Entry := Default($entryname$);\n");
+    _printer.Print(_variables, "  AReader.BeginLengthPrefixed;\n");
+    _printer.Print(_variables, "  Entry.ParseFrom(AReader);\n");
+    _printer.Print(_variables, "  AReader.EndLengthPrefixed;\n");
+    _printer.Print(_variables, "  AddOrSetValue(Entry.FKey, Entry.FValue);\n");
+    _printer.Print(_variables, "end;\n\n");
 }
 
-std::string DelphiUnitGenerator::GetFieldDefault(const FieldDescriptor *desc)
+void DelphiUnitGenerator::PrintBoundedMethods(const FieldDescriptor *desc)
 {
-    switch (desc->type()) {
-    case FieldDescriptor::TYPE_INT32:
-    case FieldDescriptor::TYPE_SINT32:
-    case FieldDescriptor::TYPE_SFIXED32:
-        return std::to_string(desc->default_value_int32());
-    case FieldDescriptor::TYPE_INT64:
-    case FieldDescriptor::TYPE_SINT64:
-    case FieldDescriptor::TYPE_SFIXED64:
-        return std::to_string(desc->default_value_int64());
-    case FieldDescriptor::TYPE_UINT32:
-    case FieldDescriptor::TYPE_FIXED32:
-        return std::to_string(desc->default_value_uint32());
+    _variables["elementtype"] = GetFieldType(desc);
+    _variables["boundedname"] = GetBoundedName(desc);
+    _printer.Print(_variables, "function $boundedname$.GetItem(AIndex: Integer): $elementtype$;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if Cardinal(AIndex) >= Cardinal(FCount) then\n");
+    _printer.Print(_variables, "    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);\n");
+    _printer.Print(_variables, "  Result := FItems[AIndex];\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boundedname$.SetItem(AIndex: Integer; const AValue: $elementtype$);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if Cardinal(AIndex) >= Cardinal(FCount) then\n");
+    _printer.Print(_variables, "    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);\n");
+    _printer.Print(_variables, "  FItems[AIndex] := AValue;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boundedname$.Grow;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FCount = Length(FItems) then\n");
+    _printer.Print(_variables, "    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);\n");
+    _printer.Print(_variables, "  Inc(FCount);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boundedname$.Add(const AValue: $elementtype$);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Grow;\n");
+    _printer.Print(_variables, "  FItems[FCount - 1] := AValue;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $boundedname$.Clear;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Self := Default($boundedname$); // releases the values, so that the decoders can append in place again\n");
+    _printer.Print(_variables, "end;\n\n");
+}
+
+void DelphiUnitGenerator::PrintLazyMethods(const Descriptor *desc)
+{
+    const auto recordname = GetRecordName(desc->full_name());
+    _variables["recordname"] = recordname;
+    _variables["lazyname"] = "TLazy" + recordname.substr(1);
+    _printer.Print(_variables, "function $lazyname$.GetValue: $recordname$;\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Stream: TBytesStream;\n");
+    _printer.Print(_variables, "  Reader: TReader;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if not FParsed then\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      Stream := TBytesStream.Create(FEncoded);\n");
+    _printer.Print(_variables, "      try\n");
+    _printer.Print(_variables, "        Reader := TReader.Create(Stream);\n");
+    _printer.Print(_variables, "        try\n");
+    _printer.Print(_variables, "          FValue.ParseFrom(Reader);\n");
+    _printer.Print(_variables, "        finally\n");
+    _printer.Print(_variables, "          Reader.Free;\n");
+    _printer.Print(_variables, "        end;\n");
+    _printer.Print(_variables, "      finally\n");
+    _printer.Print(_variables, "        Stream.Free;\n");
+    _printer.Print(_variables, "      end;\n");
+    _printer.Print(_variables, "      FEncoded := nil;\n");
+    _printer.Print(_variables, "      FParsed := True;\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "  Result := FValue;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $lazyname$.SetValue(const AValue: $recordname$);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  FValue := AValue;\n");
+    _printer.Print(_variables, "  FEncoded := nil;\n");
+    _printer.Print(_variables, "  FParsed := True;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "function $lazyname$.ComputeSize(AWriter: TWriter): Integer;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FParsed then\n");
+    _printer.Print(_variables, "    Result := FValue.ComputeSize(AWriter)\n");
+    _printer.Print(_variables, "  else\n");
+    _printer.Print(_variables, "    Result := Length(FEncoded);\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $lazyname$.EncodeTo(AWriter: TWriter);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FParsed then\n");
+    _printer.Print(_variables, "    FValue.EncodeTo(AWriter)\n");
+    _printer.Print(_variables, "  else if Length(FEncoded) > 0 then\n");
+    _printer.Print(_variables, "    AWriter.Write(FEncoded[0], Length(FEncoded)); // copied as it was parsed\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $lazyname$.MergeFrom(AReader: TReader);\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  Encoded: Bytes;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  if FParsed then\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      AReader.BeginLengthPrefixed;\n");
+    _printer.Print(_variables, "      FValue.ParseFrom(AReader);\n");
+    _printer.Print(_variables, "      AReader.EndLengthPrefixed;\n");
+    _printer.Print(_variables, "    end\n");
+    _printer.Print(_variables, "  else\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      // parsing the concatenation of several encodings merges the messages they hold\n");
+    _printer.Print(_variables, "      AReader.Parse(Encoded);\n");
+    _printer.Print(_variables, "      FEncoded := FEncoded + Encoded;\n");
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "end;\n\n");
+}
+
+void DelphiUnitGenerator::PrintViewMethods(const Descriptor *desc)
+{
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _printer.Print(_variables, "class function $recordname$View.Create(const AMessage: MessageView): $recordname$View;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result.FMessage := AMessage;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "class function $recordname$View.Create(const AValue: FieldValue): $recordname$View;\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result.FMessage := MessageView.Create(AValue.AsSlice);\n");
+    _printer.Print(_variables, "end;\n\n");
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        if (field->type() == FieldDescriptor::TYPE_GROUP) {
+            continue;
+        }
+        _variables["fieldname"] = GetPascalCase(field->name());
+        _variables["fieldtag"] = std::to_string(field->number());
+        _variables["wiretype"] = GetWireType(field);
+        _variables["viewtype"] = GetViewType(field);
+        if (field->is_repeated()) {
+            _printer.Print(_variables, "function $recordname$View.Get$fieldname$: $viewtype$;\n");
+            _printer.Print(_variables, "begin\n");
+            _printer.Print(_variables, "  Result := FMessage.Values($fieldtag$, $wiretype$);\n");
+            _printer.Print(_variables, "end;\n\n");
+            continue;
+        }
+        _variables["viewvalue"] = GetViewValue(field, "FMessage.Find(" + _variables["fieldtag"] + ", "
+                                                          + _variables["wiretype"] + ")");
+        _printer.Print(_variables, "function $recordname$View.Has$fieldname$: Boolean;\n");
+        _printer.Print(_variables, "begin\n");
+        _printer.Print(_variables, "  Result := FMessage.Contains($fieldtag$, $wiretype$);\n");
+        _printer.Print(_variables, "end;\n\n");
+        _printer.Print(_variables, "function $recordname$View.Get$fieldname$: $viewtype$;\n");
+        _printer.Print(_variables, "begin\n");
+        _printer.Print(_variables, "  Result := $viewvalue$;\n");
+        _printer.Print(_variables, "end;\n\n");
+    }
+}
+
+void DelphiUnitGenerator::PrintPresenceMethods(const Descriptor *desc)
+{
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        if (!HasPresenceBit(field)) {
+            continue;
+        }
+        _variables["fieldname"] = GetPascalCase(field->name());
+        _variables["fieldaccess"] = GetFieldAccess(field);
+        _variables["fieldtype"] = GetFieldType(field);
+        _variables["presenceword"] = GetPresenceWord(field);
+        _variables["presencemask"] = GetPresenceMask(field);
+        _printer.Print(_variables, "function $recordname$.Has$fieldname$: Boolean;\n");
+        _printer.Print(_variables, "begin\n");
+        _printer.Print(_variables, "  Result := $presenceword$ and $presencemask$ <> 0;\n");
+        _printer.Print(_variables, "end;\n\n");
+        _printer.Print(_variables, "procedure $recordname$.Set$fieldname$(const AValue: $fieldtype$);\n");
+        _printer.Print(_variables, "begin\n");
+        _printer.Print(_variables, "  $fieldaccess$ := AValue;\n");
+        _printer.Print(_variables, "  $presenceword$ := $presenceword$ or $presencemask$;\n");
+        _printer.Print(_variables, "end;\n\n");
+        _printer.Print(_variables, "procedure $recordname$.Clear$fieldname$;\n");
+        _printer.Print(_variables, "begin\n");
+        _printer.Print(_variables, "  $fieldaccess$ := Default($fieldtype$);\n");
+        _printer.Print(_variables, "  $presenceword$ := $presenceword$ and not UInt32($presencemask$);\n");
+        _printer.Print(_variables, "end;\n\n");
+    }
+}
+
+void DelphiUnitGenerator::PrintTagConstants()
+{
+    // every tag written by the encoders, with its wire type, encoded ahead of time so that it can be copied at once
+    std::set<std::pair<int, internal::WireFormatLite::WireType>> tags;
+    for (const auto message : _messages) {
+        for (int i = 0; i < message->field_count(); ++i) {
+            const auto field = message->field(i);
+            tags.emplace(field->number(), GetEncodedWireType(field));
+        }
+    }
+    if (tags.empty()) {
+        return;
+    }
+    _printer.Print(_variables, "const\n");
+    _printer.Indent();
+    for (const auto &tag : tags) {
+        const auto bytes = GetVarIntBytes(internal::WireFormatLite::MakeTag(tag.first, tag.second));
+        _variables["tagconstant"] = GetTagConstant(tag.first, tag.second);
+        _variables["tagbytes"] = GetHexLiteral(bytes.first);
+        _variables["tagcount"] = std::to_string(bytes.second);
+        _printer.Print(_variables, "$tagconstant$: EncodedTag = (FBytes: $tagbytes$; FCount: $tagcount$);\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "\n");
+}
+
+void DelphiUnitGenerator::PrintFields(const Descriptor *desc, FieldPrinter print)
+{
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        const auto oneof = field->real_containing_oneof();
+        if (!oneof) {
+            (this->*print)(field);
+        } else if (field->index_in_oneof() == 0) {
+            // the whole oneof is handled at the position of its first member
+            _variables["fieldname"] = GetFieldName(oneof->name());
+            _printer.Print(_variables, "case Ord($fieldname$.FCase) of\n");
+            _printer.Indent();
+            for (const auto member : GetMembers(oneof)) {
+                _variables["casenumber"] = std::to_string(GetCaseValue(member));
+                _printer.Print(_variables, "$casenumber$:\n");
+                _printer.Indent();
+                _printer.Print(_variables, "begin\n");
+                _printer.Indent();
+                (this->*print)(member);
+                _printer.Outdent();
+                _printer.Print(_variables, "end;\n");
+                _printer.Outdent();
+            }
+            _printer.Outdent();
+            _printer.Print(_variables, "end;\n");
+        }
+    }
+}
+
+void DelphiUnitGenerator::PrintEncoder(const Descriptor *desc)
+{
+    auto hasRepeated = false;
+    auto hasOptionalMessage = false;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        hasRepeated |= field->is_repeated();
+        hasOptionalMessage |= field->message_type() && !field->is_repeated() && !IsForced(field) && !IsBoxed(field);
+    }
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _printer.Print(_variables, "procedure $recordname$.SerializeTo(AWriter: TWriter);\n");
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  AWriter.ResetSizes;\n");
+    _printer.Print(_variables, "  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message\n");
+    _printer.Print(_variables, "  EncodeTo(AWriter);\n");
+    _printer.Print(_variables, "  AWriter.Truncate;\n");
+    _printer.Print(_variables, "end;\n\n");
+    _printer.Print(_variables, "procedure $recordname$.EncodeTo(AWriter: TWriter);\n");
+    if (hasRepeated || hasOptionalMessage) {
+        _printer.Print(_variables, "var\n");
+    }
+    if (hasRepeated) {
+        _printer.Print(_variables, "  I: Integer;\n");
+    }
+    if (hasOptionalMessage) {
+        _printer.Print(_variables, "  Size: Integer;\n");
+    }
+    _printer.Print(_variables, "begin\n");
+    _printer.Indent();
+    PrintFields(desc, &DelphiUnitGenerator::PrintEncoder);
+    if (KeepsUnknown(desc)) {
+        // the unknown fields follow the known ones, as they do in the output of other implementations
+        _printer.Print(_variables, "AWriter.Splice(FUnknown);\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+}
+
+void DelphiUnitGenerator::PrintEncoder(const FieldDescriptor *desc)
+{
+    const auto isForced = IsForced(desc);
+    const auto isMessage = desc->message_type() != nullptr;
+    // the entries of a map record are encoded as a repeated message, once the sizer has merged those with the same key
+    const auto fieldaccess = GetElements(desc);
+    const auto value = desc->is_repeated() ? fieldaccess + "[I]" : fieldaccess;
+    const auto fixedsize = GetFixedSize(desc);
+    _variables["fieldaccess"] = fieldaccess;
+    _variables["elementcount"] = GetElementCount(desc);
+    _variables["lastelement"] = GetLastElement(desc);
+    _variables["tagconstant"] = GetTagConstant(desc->number(), GetEncodedWireType(desc));
+    _variables["value"] = value;
+    _variables["packedvalue"] = GetPackedValue(desc, value);
+    if (desc->is_packed()) {
+        _variables["payloadsize"] = fixedsize ? GetElementCount(desc) + " * " + std::to_string(fixedsize)
+                                              : "AWriter.NextSize";
+        _printer.Print(_variables, "if $elementcount$ > 0 then\n");
+        _printer.Print(_variables, "  begin\n");
+        _printer.Print(_variables, "    AWriter.Pack($tagconstant$);\n");
+        _printer.Print(_variables, "    AWriter.Pack(VarInt($payloadsize$));\n");
+        _printer.Print(_variables, "    for I := 0 to $lastelement$ do\n");
+        _printer.Print(_variables, "      AWriter.Pack($packedvalue$);\n");
+        _printer.Print(_variables, "  end;\n");
+        return;
+    }
+    if (IsBoxed(desc)) {
+        // a boxed message is known to be present when it is allocated, even if it is empty
+        _printer.Print(_variables, "if $value$.HasValue then\n");
+        _printer.Print(_variables, "  begin\n");
+        _printer.Print(_variables, "    AWriter.Pack($tagconstant$);\n");
+        _printer.Print(_variables, "    AWriter.Pack(VarInt(AWriter.NextSize));\n");
+        _printer.Print(_variables, "    $value$.EncodeTo(AWriter);\n");
+        _printer.Print(_variables, "  end;\n");
+        return;
+    }
+    if (isMessage && !isForced && !desc->is_repeated()) {
+        // empty sub-messages are omitted from the output unless they are known to be present
+        _printer.Print(_variables, "Size := AWriter.NextSize;\n");
+        _printer.Print(_variables, "if Size > 0 then\n");
+        _printer.Print(_variables, "  begin\n");
+        _printer.Print(_variables, "    AWriter.Pack($tagconstant$);\n");
+        _printer.Print(_variables, "    AWriter.Pack(VarInt(Size));\n");
+        _printer.Print(_variables, "    $value$.EncodeTo(AWriter);\n");
+        _printer.Print(_variables, "  end;\n");
+        return;
+    }
+    const auto isBlock = desc->is_repeated() || (!isForced && !isMessage);
+    if (desc->is_repeated()) {
+        _printer.Print(_variables, "for I := 0 to $lastelement$ do\n");
+    } else if (isBlock) {
+        _variables["nondefaulttest"] = HasPresenceBit(desc)
+                                         ? GetPresenceWord(desc) + " and " + GetPresenceMask(desc) + " <> 0"
+                                         : GetNonDefaultTest(desc, value);
+        _printer.Print(_variables, "if $nondefaulttest$ then\n");
+    }
+    if (isBlock) {
+        _printer.Indent();
+        _printer.Print(_variables, "begin\n");
+        _printer.Indent();
+    }
+    _printer.Print(_variables, "AWriter.Pack($tagconstant$);\n");
+    if (isMessage) {
+        _printer.Print(_variables, "AWriter.Pack(VarInt(AWriter.NextSize));\n");
+        _printer.Print(_variables, "$value$.EncodeTo(AWriter);\n");
+    } else if (desc->type() == FieldDescriptor::TYPE_STRING) {
+        _printer.Print(_variables, "AWriter.Pack($value$, AWriter.NextSize);\n");
+    } else {
+        _printer.Print(_variables, "AWriter.Pack($packedvalue$);\n");
+    }
+    if (isBlock) {
+        _printer.Outdent();
+        _printer.Print(_variables, "end;\n");
+        _printer.Outdent();
+    }
+}
+
+void DelphiUnitGenerator::PrintSizer(const Descriptor *desc)
+{
+    auto hasRepeated = false;
+    auto hasMessage = false;
+    auto hasSize = false;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        hasRepeated |= field->is_repeated();
+        hasMessage |= field->message_type() != nullptr;
+        hasSize |= field->message_type() || field->type() == FieldDescriptor::TYPE_STRING || field->is_packed();
+    }
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    _printer.Print(_variables, "function $recordname$.ComputeSize(AWriter: TWriter): Integer;\n");
+    if (hasRepeated || hasSize) {
+        _printer.Print(_variables, "var\n");
+    }
+    if (hasRepeated) {
+        _printer.Print(_variables, "  I: Integer;\n");
+    }
+    if (hasMessage) {
+        _printer.Print(_variables, "  Slot: Integer;\n");
+    }
+    if (hasSize) {
+        _printer.Print(_variables, "  Size: Integer;\n");
+    }
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  Result := 0;\n");
+    _printer.Indent();
+    PrintFields(desc, &DelphiUnitGenerator::PrintSizer);
+    if (KeepsUnknown(desc)) {
+        _printer.Print(_variables, "Inc(Result, Length(FUnknown));\n");
+    }
+    _printer.Outdent();
+    _printer.Print(_variables, "end;\n\n");
+}
+
+void DelphiUnitGenerator::PrintSizer(const FieldDescriptor *desc)
+{
+    const auto isForced = IsForced(desc);
+    const auto isMessage = desc->message_type() != nullptr;
+    const auto fieldaccess = GetElements(desc);
+    const auto value = desc->is_repeated() ? fieldaccess + "[I]" : fieldaccess;
+    const auto fixedsize = GetFixedSize(desc);
+    _variables["fieldaccess"] = fieldaccess;
+    _variables["elementcount"] = GetElementCount(desc);
+    _variables["lastelement"] = GetLastElement(desc);
+    _variables["tagsize"] = std::to_string(GetVarIntSize(static_cast<uint64_t>(desc->number()) << 3));
+    _variables["value"] = value;
+    _variables["valuesize"] = GetValueSize(desc, value);
+    if (desc->is_packed()) {
+        _printer.Print(_variables, "if $elementcount$ > 0 then\n");
+        _printer.Print(_variables, "  begin\n");
+        if (fixedsize) {
+            _variables["fixedsize"] = std::to_string(fixedsize);
+            _printer.Print(_variables, "    Size := $elementcount$ * $fixedsize$;\n");
+        } else {
+            // keep the payload size of varint arrays, so that the encoder does not have to compute it again
+            _printer.Print(_variables, "    Size := 0;\n");
+            _printer.Print(_variables, "    for I := 0 to $lastelement$ do\n");
+            _printer.Print(_variables, "      Inc(Size, $valuesize$);\n");
+            _printer.Print(_variables, "    AWriter.StoreSize(Size);\n");
+        }
+        _printer.Print(_variables, "    Inc(Result, $tagsize$ + VarInt.ByteCount(Size) + Size);\n");
+        _printer.Print(_variables, "  end;\n");
+        return;
+    }
+    if (IsBoxed(desc)) {
+        _printer.Print(_variables, "if $value$.HasValue then\n");
+        _printer.Print(_variables, "  begin\n");
+        _printer.Print(_variables, "    Slot := AWriter.ReserveSize;\n");
+        _printer.Print(_variables, "    Size := AWriter.StoreSize(Slot, $value$.ComputeSize(AWriter));\n");
+        _printer.Print(_variables, "    Inc(Result, $tagsize$ + VarInt.ByteCount(Size) + Size);\n");
+        _printer.Print(_variables, "  end;\n");
+        return;
+    }
+    if (isMessage && !isForced && !desc->is_repeated()) {
+        // the slot is kept even for an empty sub-message, so that the encoder can find out it must be omitted
+        _printer.Print(_variables, "Slot := AWriter.ReserveSize;\n");
+        _printer.Print(_variables, "Size := AWriter.StoreSize(Slot, $value$.ComputeSize(AWriter));\n");
+        _printer.Print(_variables, "if Size > 0 then\n");
+        _printer.Print(_variables, "  Inc(Result, $tagsize$ + VarInt.ByteCount(Size) + Size)\n");
+        _printer.Print(_variables, "else\n");
+        _printer.Print(_variables, "  AWriter.ReleaseSizes(Slot);\n");
+        return;
+    }
+    if (IsMap(desc)) {
+        _variables["mapaccess"] = GetFieldAccess(desc);
+        _printer.Print(_variables, "$mapaccess$.EnsureIndexed;\n");
+    }
+    if (desc->is_repeated() && fixedsize) {
+        _variables["fixedsize"] = std::to_string(fixedsize);
+        _printer.Print(_variables, "Inc(Result, $elementcount$ * ($tagsize$ + $fixedsize$));\n");
+        return;
+    }
+    const auto isBlock = desc->is_repeated() || (!isForced && !isMessage);
+    if (desc->is_repeated()) {
+        _printer.Print(_variables, "for I := 0 to $lastelement$ do\n");
+    } else if (isBlock) {
+        _variables["nondefaulttest"] = HasPresenceBit(desc)
+                                         ? GetPresenceWord(desc) + " and " + GetPresenceMask(desc) + " <> 0"
+                                         : GetNonDefaultTest(desc, value);
+        _printer.Print(_variables, "if $nondefaulttest$ then\n");
+    }
+    if (isBlock) {
+        _printer.Indent();
+        _printer.Print(_variables, "begin\n");
+        _printer.Indent();
+    }
+    if (isMessage) {
+        _printer.Print(_variables, "Slot := AWriter.ReserveSize;\n");
+        _printer.Print(_variables, "Size := AWriter.StoreSize(Slot, $value$.ComputeSize(AWriter));\n");
+        _printer.Print(_variables, "Inc(Result, $tagsize$ + VarInt.ByteCount(Size) + Size);\n");
+    } else if (desc->type() == FieldDescriptor::TYPE_STRING) {
+        _printer.Print(_variables, "Size := AWriter.StoreSize(TWriter.ByteCount($value$));\n");
+        _printer.Print(_variables, "Inc(Result, $tagsize$ + VarInt.ByteCount(Size) + Size);\n");
+    } else if (desc->type() == FieldDescriptor::TYPE_BYTES) {
+        _printer.Print(_variables, "Inc(Result, $tagsize$ + VarInt.ByteCount(Length($value$)) + Length($value$));\n");
+    } else {
+        _printer.Print(_variables, "Inc(Result, $tagsize$ + $valuesize$);\n");
+    }
+    if (isBlock) {
+        _printer.Outdent();
+        _printer.Print(_variables, "end;\n");
+        _printer.Outdent();
+    }
+}
+
+void DelphiUnitGenerator::PrintDecoder(const Descriptor *desc)
+{
+    std::set<std::string> variables;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto variable = GetParsedVariable(desc->field(i));
+        if (!variable.empty()) {
+            variables.insert(variable);
+        }
+    }
+    _variables["recordname"] = GetRecordName(desc->full_name());
+    // fields with unknown numbers or unexpected wire types are kept by the record, or skipped
+    _variables["skipfield"] = KeepsUnknown(desc) ? "AReader.SkipField(WireType, FUnknown)"
+                                                 : "AReader.SkipField(WireType)";
+    _printer.Print(_variables, "procedure $recordname$.ParseFrom(AReader: TReader);\n");
+    _printer.Print(_variables, "var\n");
+    _printer.Print(_variables, "  WireType: TWireType;\n");
+    _printer.Print(_variables, "  Tag: FieldTag;\n");
+    for (const auto &variable : variables) {
+        _variables["variable"] = variable;
+        _printer.Print(_variables, "  $variable$;\n");
+    }
+    _printer.Print(_variables, "begin\n");
+    _printer.Print(_variables, "  while not AReader.AtEnd do\n");
+    _printer.Print(_variables, "    begin\n");
+    _printer.Print(_variables, "      AReader.Parse(WireType, Tag);\n");
+    _printer.Indent();
+    _printer.Indent();
+    _printer.Indent();
+    if (desc->field_count() == 0) {
+        _printer.Print(_variables, "$skipfield$;\n");
+    } else {
+        _printer.Print(_variables, "case Tag of\n");
+        _printer.Indent();
+        for (int i = 0; i < desc->field_count(); ++i) {
+            PrintDecoder(desc->field(i));
+        }
+        _printer.Outdent();
+        _printer.Print(_variables, "else\n");
+        _printer.Print(_variables, "  $skipfield$;\n");
+        _printer.Print(_variables, "end;\n");
+    }
+    _printer.Outdent();
+    _printer.Outdent();
+    _printer.Outdent();
+    _printer.Print(_variables, "    end;\n");
+    _printer.Print(_variables, "end;\n\n");
+}
+
+void DelphiUnitGenerator::PrintDecoder(const FieldDescriptor *desc)
+{
+    const auto fieldaccess = GetFieldAccess(desc);
+    _variables["fieldtag"] = std::to_string(desc->number());
+    _variables["wiretype"] = GetWireType(desc);
+    _variables["fieldaccess"] = fieldaccess;
+    _printer.Print(_variables, "$fieldtag$:\n");
+    _printer.Indent();
+    if (desc->is_packable()) {
+        // parsers must accept both packed and unpacked encodings of packable fields
+        _printer.Print(_variables, "if WireType = TWireType.LengthPrefixed then\n");
+        _printer.Print(_variables, "  begin\n");
+        _printer.Print(_variables, "    AReader.BeginLengthPrefixed;\n");
+        _printer.Print(_variables, "    while not AReader.AtEnd do\n");
+        _printer.Print(_variables, "      begin\n");
+        for (int k = 0; k < 4; ++k) {
+            _printer.Indent();
+        }
+        PrintDecodeStatements(desc, fieldaccess);
+        for (int k = 0; k < 4; ++k) {
+            _printer.Outdent();
+        }
+        _printer.Print(_variables, "      end;\n");
+        _printer.Print(_variables, "    AReader.EndLengthPrefixed;\n");
+        _printer.Print(_variables, "  end\n");
+        _printer.Print(_variables, "else ");
+    }
+    _printer.Print(_variables, "if WireType = $wiretype$ then\n");
+    _printer.Print(_variables, "  begin\n");
+    _printer.Indent();
+    _printer.Indent();
+    if (desc->real_containing_oneof()) {
+        const auto oneof = desc->real_containing_oneof();
+        _variables["oneofaccess"] = GetFieldName(oneof->name()) + ".FCase";
+        _variables["casevalue"] = GetCaseName(oneof->full_name()) + ".&" + GetFullName(desc->full_name());
+        // the members with storage of their own are released when another one is selected, so that a message parsed
+        // again into one of them is not merged with the value it held before
+        std::vector<const FieldDescriptor *> previous;
+        for (const auto member : GetMembers(oneof)) {
+            if (member != desc && !IsOverlaid(member)) {
+                previous.push_back(member);
+            }
+        }
+        // the storage of an overlaid member is shared with the others, so it only holds a message to merge into when
+        // selected
+        const auto resetsMessage = IsOverlaid(desc) && desc->message_type();
+        const auto block = !previous.empty() && resetsMessage;
+        if (!previous.empty() || resetsMessage) {
+            _printer.Print(_variables, "if $oneofaccess$ <> $casevalue$ then\n");
+            _printer.Print(_variables, block ? "  begin\n" : "");
+            _printer.Indent();
+            if (block) {
+                _printer.Indent();
+            }
+        }
+        if (!previous.empty()) {
+            _printer.Print(_variables, "case $oneofaccess$ of\n");
+            for (const auto member : previous) {
+                _variables["membercase"] = GetCaseName(oneof->full_name()) + ".&" + GetFullName(member->full_name());
+                _variables["memberaccess"] = GetFieldAccess(member);
+                _variables["membertype"] = GetFieldType(member);
+                _printer.Print(_variables, "  $membercase$:\n");
+                _printer.Print(_variables, "    $memberaccess$ := Default($membertype$);\n");
+            }
+            _printer.Print(_variables, "end;\n");
+        }
+        if (resetsMessage) {
+            _variables["membertype"] = GetRecordName(desc->message_type()->full_name());
+            _printer.Print(_variables, "$fieldaccess$ := Default($membertype$);\n");
+        }
+        if (!previous.empty() || resetsMessage) {
+            _printer.Outdent();
+            if (block) {
+                _printer.Outdent();
+            }
+            _printer.Print(_variables, block ? "  end;\n" : "");
+        }
+        _printer.Print(_variables, "$oneofaccess$ := $casevalue$;\n");
+    }
+    PrintDecodeStatements(desc, fieldaccess);
+    if (HasPresenceBit(desc)) {
+        _variables["presenceword"] = GetPresenceWord(desc);
+        _variables["presencemask"] = GetPresenceMask(desc);
+        _printer.Print(_variables, "$presenceword$ := $presenceword$ or $presencemask$;\n");
+    }
+    _printer.Outdent();
+    _printer.Outdent();
+    _printer.Print(_variables, "  end\n");
+    _printer.Print(_variables, "else\n");
+    _printer.Print(_variables, "  $skipfield$;\n");
+    _printer.Outdent();
+}
+
+void DelphiUnitGenerator::PrintDecodeStatements(const FieldDescriptor *desc, const std::string &target)
+{
+    _variables["target"] = target;
+    if (IsMap(desc)) {
+        _printer.Print(_variables, "$target$.MergeFrom(AReader);\n");
+        return;
+    }
+    if (IsBounded(desc)) {
+        // raises an error instead of growing past the capacity of the field
+        _printer.Print(_variables, "$target$.Grow;\n");
+        _variables["target"] = target + ".FItems[" + target + ".FCount - 1]";
+    } else if (desc->is_repeated()) {
+        _printer.Print(_variables, "SetLength($target$, Length($target$) + 1);\n");
+        _variables["target"] = target + "[High(" + target + ")]";
+    }
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+        _printer.Print(_variables, "AReader.Parse($target$);\n");
+        break;
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        if (IsLazy(desc) || IsBoxed(desc)) {
+            _printer.Print(_variables, "$target$.MergeFrom(AReader);\n");
+            break;
+        }
+        _printer.Print(_variables, "AReader.BeginLengthPrefixed;\n");
+        _printer.Print(_variables, "$target$.ParseFrom(AReader);\n");
+        _printer.Print(_variables, "AReader.EndLengthPrefixed;\n");
+        break;
+    default:
+        const auto variable = GetParsedVariable(desc);
+        _variables["variablename"] = variable.substr(0, variable.find(':'));
+        _variables["parsedvalue"] = GetParsedValue(desc);
+        _printer.Print(_variables, "AReader.Parse($variablename$);\n");
+        _printer.Print(_variables, "$target$ := $parsedvalue$;\n");
+        break;
+    }
+}
+
+auto DelphiUnitGenerator::GetEnumValues(const EnumDescriptor *desc) -> std::vector<EnumValue>
+{
+    std::vector<EnumValue> result;
+    result.reserve(desc->value_count());
+    for (int i = 0; i < desc->value_count(); ++i) {
+        const auto value = desc->value(i);
+        result.push_back({value->name(), value->number(), false});
+    }
+    std::sort(result.begin(), result.end(), [](const EnumValue &lhs, const EnumValue &rhs) {
+        return lhs.number < rhs.number;
+    });
+    result.back().isLast = true;
+    return result;
+}
+
+bool DelphiUnitGenerator::IsSparse(const std::vector<EnumValue> &values)
+{
+    // dense enums need a placeholder for every gap between their values, and must start at zero to have RTTI
+    const int64_t minSparseSpan = 256;
+    const int64_t maxGapsPerValue = 3;
+    const auto span = int64_t(values.back().number) + 1;
+    return values.front().number < 0
+        || span > std::max(minSparseSpan, (maxGapsPerValue + 1) * int64_t(values.size()));
+}
+
+auto DelphiUnitGenerator::GetEnumValues(const OneofDescriptor *desc) -> std::vector<EnumValue>
+{
+    std::vector<EnumValue> result;
+    result.reserve(desc->field_count() + 1);
+    result.push_back({desc->full_name() + "Unspecified", 0, false});
+    for (const auto field : GetMembers(desc)) {
+        result.push_back({field->full_name(), GetCaseValue(field), false});
+    }
+    result.back().isLast = true;
+    return result;
+}
+
+auto DelphiUnitGenerator::GetFields(const Descriptor *desc) -> std::vector<Field>
+{
+    std::vector<Field> result;
+    result.reserve(desc->field_count());
+    for (const auto &group : GetOrderedFieldGroups(desc)) {
+        for (const auto field : group) {
+            result.push_back({IsBounded(field) ? PrintBounded(field) : GetFieldType(field), field});
+        }
+    }
+    return result;
+}
+
+auto DelphiUnitGenerator::GetFieldGroups(const Descriptor *desc) -> std::vector<FieldGroup>
+{
+    // the fields of a oneof stay together, since they make up a nested record
+    std::vector<FieldGroup> result;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        const auto field = desc->field(i);
+        if (!field->real_containing_oneof()) {
+            result.push_back({field});
+        } else if (field->index_in_oneof() == 0) {
+            result.push_back(GetMembers(field->real_containing_oneof()));
+        }
+    }
+    return result;
+}
+
+auto DelphiUnitGenerator::GetOrderedFieldGroups(const Descriptor *desc) -> std::vector<FieldGroup>
+{
+    auto result = GetFieldGroups(desc);
+    if (_optimizeLayout) {
+        // fields are identified by their tag, so they can be placed in decreasing alignment to avoid most padding
+        std::stable_sort(result.begin(), result.end(), [this](const FieldGroup &lhs, const FieldGroup &rhs) {
+            return GetLayout(lhs).alignment > GetLayout(rhs).alignment;
+        });
+    }
+    return result;
+}
+
+auto DelphiUnitGenerator::GetLayout(const Descriptor *desc) -> Layout
+{
+    const auto it = _layouts.find(desc);
+    if (it != _layouts.end()) {
+        return it->second;
+    }
+    _layouts[desc] = {PointerSize, PointerSize}; // a record cannot contain itself, but avoid recursing forever anyway
+    std::vector<Layout> layouts;
+    for (const auto &group : GetOrderedFieldGroups(desc)) {
+        layouts.push_back(GetLayout(group));
+    }
+    const auto words = GetPresenceWordCount(desc);
+    if (words > 0) {
+        layouts.push_back({4 * words, 4});
+    }
+    if (KeepsUnknown(desc)) {
+        layouts.push_back({PointerSize, PointerSize});
+    }
+    return _layouts[desc] = GetRecordLayout(layouts);
+}
+
+auto DelphiUnitGenerator::GetLayout(const FieldGroup &group) -> Layout
+{
+    if (!group.front()->real_containing_oneof()) {
+        return GetLayout(group.front());
+    }
+    return GetOneofLayout(group);
+}
+
+auto DelphiUnitGenerator::GetLayout(const FieldDescriptor *desc) -> Layout
+{
+    if (IsMap(desc)) {
+        return GetRecordLayout({{PointerSize, PointerSize}, {PointerSize, PointerSize}, {4, 4}});
+    }
+    if (IsBounded(desc)) {
+        return GetBoundedLayout(desc);
+    }
+    if (desc->is_repeated()) {
+        return {PointerSize, PointerSize};
+    }
+    return GetValueLayout(desc);
+}
+
+auto DelphiUnitGenerator::GetValueLayout(const FieldDescriptor *desc) -> Layout
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_INT64:
+    case FieldDescriptor::TYPE_UINT64:
+    case FieldDescriptor::TYPE_SINT64:
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return {8, 8};
+    case FieldDescriptor::TYPE_BOOL:
+        return {1, 1};
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+        return {PointerSize, PointerSize};
+    case FieldDescriptor::TYPE_ENUM: {
+        const auto values = GetEnumValues(desc->enum_type());
+        const auto size = IsSparse(values) ? 4 : GetOrdinalSize(values.back().number);
+        return {size, size};
+    }
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        if (IsLazy(desc)) {
+            return GetRecordLayout({GetLayout(desc->message_type()), {PointerSize, PointerSize}, {1, 1}});
+        }
+        if (IsBoxed(desc)) {
+            return {PointerSize, PointerSize};
+        }
+        return GetLayout(desc->message_type());
+    default:
+        return {4, 4};
+    }
+}
+
+auto DelphiUnitGenerator::GetBoundedLayout(const FieldDescriptor *desc, std::vector<int> *offsets) -> Layout
+{
+    const auto value = GetValueLayout(desc);
+    return GetRecordLayout({{4, 4}, {value.size * GetMaxCount(desc), value.alignment}}, offsets);
+}
+
+auto DelphiUnitGenerator::GetOneofLayout(const FieldGroup &group, std::vector<int> *offsets) -> Layout
+{
+    // the nested record of a oneof starts with its case, followed by the members that have their own storage
+    const auto casesize = GetOrdinalSize(group.front()->real_containing_oneof()->field_count());
+    std::vector<Layout> layouts{{casesize, casesize}};
+    auto variant = group.begin();
+    for (; variant != group.end() && !IsOverlaid(*variant); ++variant) {
+        layouts.push_back(GetLayout(*variant));
+    }
+    std::vector<int> fixedOffsets;
+    auto result = GetRecordLayout(layouts, &fixedOffsets);
+    if (offsets) {
+        offsets->insert(offsets->end(), fixedOffsets.begin(), fixedOffsets.end());
+    }
+    if (variant == group.end()) {
+        return result;
+    }
+    // the overlaid members make up the variant part, where each one is aligned on its own from the same offset
+    const auto start = fixedOffsets.back() + layouts.back().size;
+    auto end = start;
+    for (auto field = variant; field != group.end(); ++field) {
+        const auto layout = GetLayout(*field);
+        const auto alignment = std::min(layout.alignment, 8);
+        const auto offset = (start + alignment - 1) / alignment * alignment;
+        if (offsets) {
+            offsets->push_back(offset);
+        }
+        end = std::max(end, offset + layout.size);
+        result.alignment = std::max(result.alignment, alignment);
+    }
+    result.size = (end + result.alignment - 1) / result.alignment * result.alignment;
+    return result;
+}
+
+auto DelphiUnitGenerator::GetRecordLayout(const std::vector<Layout> &fields, std::vector<int> *offsets) -> Layout
+{
+    // fields are aligned as with the default {$A8}, and the record size is padded to its own alignment
+    Layout result = {0, 1};
+    for (const auto &field : fields) {
+        const auto alignment = std::min(field.alignment, 8);
+        result.size = (result.size + alignment - 1) / alignment * alignment;
+        if (offsets) {
+            offsets->push_back(result.size);
+        }
+        result.size += field.size;
+        result.alignment = std::max(result.alignment, alignment);
+    }
+    result.size = (result.size + result.alignment - 1) / result.alignment * result.alignment;
+    return result;
+}
+
+void DelphiUnitGenerator::GetOffsets(const Descriptor *desc,
+                                     std::map<const FieldDescriptor *, int> &offsets,
+                                     std::map<const OneofDescriptor *, int> &caseOffsets,
+                                     int &presenceOffset,
+                                     int &unknownOffset)
+{
+    const auto groups = GetOrderedFieldGroups(desc);
+    std::vector<Layout> layouts;
+    for (const auto &group : groups) {
+        layouts.push_back(GetLayout(group));
+    }
+    // the presence bitmap and the unknown fields are private, so they follow the fields
+    const auto words = GetPresenceWordCount(desc);
+    if (words > 0) {
+        layouts.push_back({4 * words, 4});
+    }
+    const auto keepsUnknown = KeepsUnknown(desc);
+    if (keepsUnknown) {
+        layouts.push_back({PointerSize, PointerSize});
+    }
+    std::vector<int> groupOffsets;
+    GetRecordLayout(layouts, &groupOffsets);
+    presenceOffset = words > 0 ? groupOffsets[groups.size()] : 0;
+    unknownOffset = keepsUnknown ? groupOffsets.back() : -1;
+    for (size_t i = 0; i < groups.size(); ++i) {
+        const auto oneof = groups[i].front()->real_containing_oneof();
+        if (!oneof) {
+            offsets[groups[i].front()] = groupOffsets[i];
+            continue;
+        }
+        std::vector<int> memberOffsets;
+        GetOneofLayout(groups[i], &memberOffsets);
+        caseOffsets[oneof] = groupOffsets[i] + memberOffsets[0];
+        for (size_t k = 0; k < groups[i].size(); ++k) {
+            offsets[groups[i][k]] = groupOffsets[i] + memberOffsets[k + 1];
+        }
+    }
+}
+
+int DelphiUnitGenerator::GetOrdinalSize(int64_t high)
+{
+    // enumerations take the smallest ordinal size that holds their values, as with the default {$Z1}
+    return high <= 0xFF ? 1 : high <= 0xFFFF ? 2 : 4;
+}
+
+std::string DelphiUnitGenerator::GetFieldType(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_ENUM:
+        return Print(desc->enum_type());
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        if (IsMap(desc)) {
+            return PrintMap(desc->message_type());
+        }
+        if (IsBoxed(desc)) {
+            return PrintBoxed(desc->message_type());
+        }
+        return IsLazy(desc) ? PrintLazy(desc->message_type()) : Print(desc->message_type());
+    default:
+        return desc->type_name();
+    }
+}
+
+std::string DelphiUnitGenerator::GetViewType(const FieldDescriptor *desc)
+{
+    if (desc->is_repeated()) {
+        return "FieldCursor";
+    }
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+        return "ByteSlice";
+    case FieldDescriptor::TYPE_MESSAGE:
+        return GetRecordName(desc->message_type()->full_name()) + "View";
+    default:
+        return GetFieldType(desc);
+    }
+}
+
+std::string DelphiUnitGenerator::GetViewValue(const FieldDescriptor *desc, const std::string &value)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+        return value + ".AsDouble";
+    case FieldDescriptor::TYPE_FLOAT:
+        return value + ".AsSingle";
+    case FieldDescriptor::TYPE_INT32:
+    case FieldDescriptor::TYPE_SFIXED32:
+        return value + ".AsInt32";
+    case FieldDescriptor::TYPE_INT64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return value + ".AsInt64";
+    case FieldDescriptor::TYPE_UINT32:
+    case FieldDescriptor::TYPE_FIXED32:
+        return value + ".AsUInt32";
+    case FieldDescriptor::TYPE_UINT64:
+    case FieldDescriptor::TYPE_FIXED64:
+        return value + ".AsUInt64";
+    case FieldDescriptor::TYPE_SINT32:
+        return value + ".AsSInt32";
+    case FieldDescriptor::TYPE_SINT64:
+        return value + ".AsSInt64";
+    case FieldDescriptor::TYPE_BOOL:
+        return value + ".AsBoolean";
+    case FieldDescriptor::TYPE_ENUM:
+        return GetEnumName(desc->enum_type()->full_name()) + "(" + value + ".AsInt32)";
+    case FieldDescriptor::TYPE_MESSAGE:
+        return GetRecordName(desc->message_type()->full_name()) + "View.Create(" + value + ")";
+    default:
+        return value + ".AsSlice";
+    }
+}
+
+std::string DelphiUnitGenerator::GetFieldDefault(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_INT32:
+    case FieldDescriptor::TYPE_SINT32:
+    case FieldDescriptor::TYPE_SFIXED32:
+        return std::to_string(desc->default_value_int32());
+    case FieldDescriptor::TYPE_INT64:
+    case FieldDescriptor::TYPE_SINT64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return std::to_string(desc->default_value_int64());
+    case FieldDescriptor::TYPE_UINT32:
+    case FieldDescriptor::TYPE_FIXED32:
+        return std::to_string(desc->default_value_uint32());
     case FieldDescriptor::TYPE_UINT64:
     case FieldDescriptor::TYPE_FIXED64:
-        return std::to_string(desc->default_value_uint64());
+        return std::to_string(desc->default_value_uint64());
+    case FieldDescriptor::TYPE_FLOAT:
+        return std::to_string(desc->default_value_float());
+    case FieldDescriptor::TYPE_DOUBLE:
+        return std::to_string(desc->default_value_double());
+    case FieldDescriptor::TYPE_BOOL:
+        return desc->default_value_bool() ? "true" : "false";
+    case FieldDescriptor::TYPE_ENUM:
+        return std::to_string(desc->default_value_enum()->number());
+    case FieldDescriptor::TYPE_STRING:
+        return "'" + desc->default_value_string() + "'";
+    case FieldDescriptor::TYPE_BYTES:
+        return GetBytesLiteral(desc->default_value_string());
+    default:
+        return "";
+    }
+}
+
+std::string DelphiUnitGenerator::GetFieldAccess(const FieldDescriptor *desc)
+{
+    const auto oneof = desc->real_containing_oneof();
+    if (oneof) {
+        return GetFieldName(oneof->name()) + "." + GetFieldName(desc->name());
+    }
+    return GetFieldName(desc->name());
+}
+
+std::string DelphiUnitGenerator::GetWireType(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return "TWireType.Fixed64";
+    case FieldDescriptor::TYPE_FLOAT:
+    case FieldDescriptor::TYPE_FIXED32:
+    case FieldDescriptor::TYPE_SFIXED32:
+        return "TWireType.Fixed32";
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        return "TWireType.LengthPrefixed";
+    default:
+        return "TWireType.VarInt";
+    }
+}
+
+std::string DelphiUnitGenerator::GetPackedValue(const FieldDescriptor *desc, const std::string &value)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_FLOAT:
+        return (desc->type() == FieldDescriptor::TYPE_DOUBLE ? "FixedInt64(" : "FixedInt32(") + value + ")";
+    case FieldDescriptor::TYPE_FIXED32:
+        return "FixedInt32(UInt32(" + value + "))";
+    case FieldDescriptor::TYPE_FIXED64:
+        return "FixedInt64(UInt64(" + value + "))";
+    case FieldDescriptor::TYPE_SFIXED32:
+        return "FixedInt32(Int32(" + value + "))";
+    case FieldDescriptor::TYPE_SFIXED64:
+        return "FixedInt64(Int64(" + value + "))";
+    case FieldDescriptor::TYPE_SINT32:
+        return "SignedInt(Int32(" + value + "))";
+    case FieldDescriptor::TYPE_SINT64:
+        return "SignedInt(Int64(" + value + "))";
+    case FieldDescriptor::TYPE_BOOL:
+    case FieldDescriptor::TYPE_ENUM:
+        return "VarInt(Ord(" + value + "))";
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+        return value;
+    default:
+        return "VarInt(" + value + ")";
+    }
+}
+
+std::string DelphiUnitGenerator::GetNonDefaultTest(const FieldDescriptor *desc, const std::string &value)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_BOOL:
+        return value;
+    case FieldDescriptor::TYPE_ENUM:
+        return "Ord(" + value + ") <> 0";
+    case FieldDescriptor::TYPE_STRING:
+        return value + " <> ''";
+    case FieldDescriptor::TYPE_BYTES:
+        return "Length(" + value + ") > 0";
+    default:
+        return value + " <> 0";
+    }
+}
+
+std::string DelphiUnitGenerator::GetParsedVariable(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return "Fixed64Value: FixedInt64";
     case FieldDescriptor::TYPE_FLOAT:
-        return std::to_string(desc->default_value_float());
+    case FieldDescriptor::TYPE_FIXED32:
+    case FieldDescriptor::TYPE_SFIXED32:
+        return "Fixed32Value: FixedInt32";
+    case FieldDescriptor::TYPE_SINT32:
+    case FieldDescriptor::TYPE_SINT64:
+        return "SignedIntValue: SignedInt";
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        return "";
+    default:
+        return "VarIntValue: VarInt";
+    }
+}
+
+std::string DelphiUnitGenerator::GetParsedValue(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
     case FieldDescriptor::TYPE_DOUBLE:
-        return std::to_string(desc->default_value_double());
+        return "Double(Fixed64Value)";
+    case FieldDescriptor::TYPE_FIXED64:
+        return "UInt64(Fixed64Value)";
+    case FieldDescriptor::TYPE_SFIXED64:
+        return "Int64(Fixed64Value)";
+    case FieldDescriptor::TYPE_FLOAT:
+        return "Single(Fixed32Value)";
+    case FieldDescriptor::TYPE_FIXED32:
+        return "UInt32(Fixed32Value)";
+    case FieldDescriptor::TYPE_SFIXED32:
+        return "Int32(Fixed32Value)";
+    case FieldDescriptor::TYPE_SINT32:
+        return "Int32(SignedIntValue)";
+    case FieldDescriptor::TYPE_SINT64:
+        return "Int64(SignedIntValue)";
+    case FieldDescriptor::TYPE_INT32:
+        return "Int32(VarIntValue)";
+    case FieldDescriptor::TYPE_UINT32:
+        return "UInt32(VarIntValue)";
+    case FieldDescriptor::TYPE_UINT64:
+        return "UInt64(VarIntValue)";
     case FieldDescriptor::TYPE_BOOL:
-        return desc->default_value_bool() ? "true" : "false";
+        return "UInt64(VarIntValue) <> 0";
     case FieldDescriptor::TYPE_ENUM:
-        return std::to_string(desc->default_value_enum()->number());
+        return GetEnumName(desc->enum_type()->full_name()) + "(Int32(VarIntValue))";
+    default:
+        return "Int64(VarIntValue)";
+    }
+}
+
+std::string DelphiUnitGenerator::GetTableKind(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_ENUM: {
+        const auto values = GetEnumValues(desc->enum_type());
+        const auto size = IsSparse(values) ? 4 : GetOrdinalSize(values.back().number);
+        return "TFieldKind.Enum" + std::to_string(8 * size);
+    }
     case FieldDescriptor::TYPE_STRING:
-        return "'" + desc->default_value_string() + "'";
+        return "TFieldKind.&String";
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        return "TFieldKind.Message";
+    case FieldDescriptor::TYPE_DOUBLE:
+        return "TFieldKind.Double";
+    case FieldDescriptor::TYPE_FLOAT:
+        return "TFieldKind.Float";
+    case FieldDescriptor::TYPE_INT64:
+        return "TFieldKind.Int64";
+    case FieldDescriptor::TYPE_UINT64:
+        return "TFieldKind.UInt64";
+    case FieldDescriptor::TYPE_FIXED64:
+        return "TFieldKind.Fixed64";
+    case FieldDescriptor::TYPE_FIXED32:
+        return "TFieldKind.Fixed32";
+    case FieldDescriptor::TYPE_BOOL:
+        return "TFieldKind.Bool";
     case FieldDescriptor::TYPE_BYTES:
-        return GetBytesLiteral(desc->default_value_string());
+        return "TFieldKind.Bytes";
+    case FieldDescriptor::TYPE_UINT32:
+        return "TFieldKind.UInt32";
+    case FieldDescriptor::TYPE_SFIXED32:
+        return "TFieldKind.SFixed32";
+    case FieldDescriptor::TYPE_SFIXED64:
+        return "TFieldKind.SFixed64";
+    case FieldDescriptor::TYPE_SINT32:
+        return "TFieldKind.SInt32";
+    case FieldDescriptor::TYPE_SINT64:
+        return "TFieldKind.SInt64";
     default:
-        return "";
+        return "TFieldKind.Int32";
+    }
+}
+
+std::string DelphiUnitGenerator::GetTableFlags(const FieldDescriptor *desc)
+{
+    std::vector<std::string> flags;
+    if (desc->is_repeated()) {
+        flags.push_back("TFieldFlag.Repeated");
+    }
+    if (desc->is_packed()) {
+        flags.push_back("TFieldFlag.&Packed");
+    }
+    if (desc->is_required()) {
+        flags.push_back("TFieldFlag.Required");
+    }
+    if (desc->real_containing_oneof()) {
+        flags.push_back("TFieldFlag.Oneof");
+    }
+    if (IsLazy(desc)) {
+        flags.push_back("TFieldFlag.Lazy");
+    }
+    if (HasPresenceBit(desc)) {
+        flags.push_back("TFieldFlag.Presence");
+    }
+    if (IsBoxed(desc)) {
+        flags.push_back("TFieldFlag.Boxed");
+    }
+    if (IsOverlaid(desc)) {
+        flags.push_back("TFieldFlag.Overlaid");
+    }
+    if (IsBounded(desc)) {
+        flags.push_back("TFieldFlag.Bounded");
+    }
+    std::string result;
+    for (const auto &flag : flags) {
+        result += (result.empty() ? "" : ", ") + flag;
+    }
+    return "[" + result + "]";
+}
+
+std::string DelphiUnitGenerator::GetLayoutKind(const FieldDescriptor *desc)
+{
+    // the kinds of the Delphi tables, as named by delphicodec.h
+    auto kind = GetTableKind(desc).substr(std::strlen("TFieldKind."));
+    kind.erase(std::remove(kind.begin(), kind.end(), '&'), kind.end());
+    return "DSC_" + ::ToUpper(kind);
+}
+
+std::string DelphiUnitGenerator::GetLayoutFlags(const FieldDescriptor *desc)
+{
+    std::vector<std::string> flags;
+    if (desc->is_repeated()) {
+        flags.push_back("DSC_REPEATED");
+    }
+    if (desc->is_packed()) {
+        flags.push_back("DSC_PACKED");
+    }
+    if (desc->is_required()) {
+        flags.push_back("DSC_REQUIRED");
+    }
+    if (desc->real_containing_oneof()) {
+        flags.push_back("DSC_ONEOF");
+    }
+    if (IsLazy(desc)) {
+        flags.push_back("DSC_LAZY");
+    }
+    if (HasPresenceBit(desc)) {
+        flags.push_back("DSC_PRESENCE");
+    }
+    if (IsBoxed(desc)) {
+        flags.push_back("DSC_BOXED");
+    }
+    if (IsOverlaid(desc)) {
+        flags.push_back("DSC_OVERLAID");
+    }
+    if (IsBounded(desc)) {
+        flags.push_back("DSC_BOUNDED");
+    }
+    std::string result;
+    for (const auto &flag : flags) {
+        result += (result.empty() ? "" : " | ") + flag;
+    }
+    return result.empty() ? "0" : result;
+}
+
+internal::WireFormatLite::WireType DelphiUnitGenerator::GetEncodedWireType(const FieldDescriptor *desc)
+{
+    // groups are encoded with a length prefix, as GetWireType has it for the decoders and sizers
+    if (desc->is_packed() || desc->type() == FieldDescriptor::TYPE_GROUP) {
+        return internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED;
+    }
+    return internal::WireFormat::WireTypeForField(desc);
+}
+
+std::string DelphiUnitGenerator::GetTagConstant(int number, internal::WireFormatLite::WireType wiretype)
+{
+    switch (wiretype) {
+    case internal::WireFormatLite::WIRETYPE_FIXED64:
+        return "CTag" + std::to_string(number) + "Fixed64";
+    case internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED:
+        return "CTag" + std::to_string(number) + "LengthPrefixed";
+    case internal::WireFormatLite::WIRETYPE_FIXED32:
+        return "CTag" + std::to_string(number) + "Fixed32";
+    case internal::WireFormatLite::WIRETYPE_START_GROUP:
+        return "CTag" + std::to_string(number) + "StartGroup";
+    case internal::WireFormatLite::WIRETYPE_END_GROUP:
+        return "CTag" + std::to_string(number) + "EndGroup";
+    default:
+        return "CTag" + std::to_string(number) + "VarInt";
+    }
+}
+
+bool DelphiUnitGenerator::IsForced(const FieldDescriptor *desc)
+{
+    // members of a oneof are always encoded when selected, as are required fields
+    return desc->is_required() || desc->real_containing_oneof();
+}
+
+bool DelphiUnitGenerator::IsLazy(const FieldDescriptor *desc) const
+{
+    // the wrapper is only useful along with the codecs, which keep the encoding of the message until it is accessed
+    return _emitCodecs && desc->type() == FieldDescriptor::TYPE_MESSAGE && (_lazyFields || desc->options().lazy())
+        && !IsMapEntry(desc) && !IsBounded(desc);
+}
+
+bool DelphiUnitGenerator::IsBoxed(const FieldDescriptor *desc) const
+{
+    // the members of a oneof share the nested record of the oneof, and required or repeated messages are always present
+    return _boxFields && desc->type() == FieldDescriptor::TYPE_MESSAGE && !desc->is_repeated() && !desc->is_required()
+        && !desc->real_containing_oneof() && !IsLazy(desc) && !IsMapEntry(desc);
+}
+
+bool DelphiUnitGenerator::IsMap(const FieldDescriptor *desc) const
+{
+    return _hashMaps && desc->is_map();
+}
+
+bool DelphiUnitGenerator::IsMapEntry(const FieldDescriptor *desc) const
+{
+    // the values of a map record are read and written as they are, without a wrapper
+    return _hashMaps && desc->containing_type()->options().map_entry();
+}
+
+std::string DelphiUnitGenerator::GetMapName(const Descriptor *desc)
+{
+    // the map record of a field is named after its synthetic entry message, with Map in place of Entry
+    auto name = GetRecordName(desc->full_name());
+    const std::string suffix = "Entry";
+    if (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+        name.erase(name.size() - suffix.size());
+    }
+    return name + "Map";
+}
+
+std::string DelphiUnitGenerator::GetKeyHash(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_STRING:
+        return "MapHash.Hash(AKey)";
+    case FieldDescriptor::TYPE_BOOL:
+        return "MapHash.Hash(UInt64(Ord(AKey)))";
+    default:
+        return "MapHash.Hash(UInt64(AKey))";
+    }
+}
+
+void DelphiUnitGenerator::GetSchemaFiles(const FileDescriptor *desc, std::vector<const FileDescriptor *> &files)
+{
+    // imports come first, so that the types a file refers to are registered before it
+    if (std::find(files.begin(), files.end(), desc) != files.end()) {
+        return;
+    }
+    for (int i = 0; i < desc->dependency_count(); ++i) {
+        GetSchemaFiles(desc->dependency(i), files);
+    }
+    files.push_back(desc);
+}
+
+void DelphiUnitGenerator::Strip(FileDescriptorProto *desc)
+{
+    desc->clear_options();
+    desc->clear_source_code_info();
+    desc->clear_service();
+    desc->clear_extension();
+    for (auto &message : *desc->mutable_message_type()) {
+        Strip(&message);
+    }
+    for (auto &enumeration : *desc->mutable_enum_type()) {
+        Strip(&enumeration);
+    }
+}
+
+void DelphiUnitGenerator::Strip(DescriptorProto *desc)
+{
+    desc->clear_options();
+    desc->clear_extension();
+    desc->clear_extension_range();
+    desc->clear_reserved_range();
+    desc->clear_reserved_name();
+    for (auto &field : *desc->mutable_field()) {
+        // only the packed option changes the encoding of a field
+        if (field.options().has_packed()) {
+            const auto packed = field.options().packed();
+            field.mutable_options()->Clear();
+            field.mutable_options()->set_packed(packed);
+        } else {
+            field.clear_options();
+        }
+    }
+    for (auto &oneof : *desc->mutable_oneof_decl()) {
+        oneof.clear_options();
+    }
+    for (auto &message : *desc->mutable_nested_type()) {
+        Strip(&message);
+    }
+    for (auto &enumeration : *desc->mutable_enum_type()) {
+        Strip(&enumeration);
+    }
+}
+
+void DelphiUnitGenerator::Strip(EnumDescriptorProto *desc)
+{
+    desc->clear_options();
+    desc->clear_reserved_range();
+    desc->clear_reserved_name();
+    for (auto &value : *desc->mutable_value()) {
+        value.clear_options();
+    }
+}
+
+int DelphiUnitGenerator::GetMaxCount(const FieldDescriptor *desc)
+{
+    // the option is not linked into the plugin, so it is found among the unknown fields of the options
+    const auto option = desc->file()->pool()->FindExtensionByName("delphi.max_count");
+    if (!option) {
+        return 0;
+    }
+    const auto &fields = desc->options().GetReflection()->GetUnknownFields(desc->options());
+    for (int i = 0; i < fields.field_count(); ++i) {
+        const auto &field = fields.field(i);
+        if (field.number() == option->number() && field.type() == UnknownField::TYPE_VARINT) {
+            return static_cast<int>(std::min<uint64_t>(field.varint(), INT32_MAX));
+        }
+    }
+    return 0;
+}
+
+bool DelphiUnitGenerator::IsBounded(const FieldDescriptor *desc)
+{
+    const auto count = GetMaxCount(desc);
+    if (count == 0) {
+        return false;
+    }
+    if (!desc->is_repeated() || desc->is_map()) {
+        throw std::runtime_error("Only repeated fields that are not maps can be bounded: " + desc->full_name());
+    }
+    if (count > MaxBoundedCount) {
+        throw std::runtime_error("Too many values for a bounded field: " + desc->full_name());
+    }
+    return true;
+}
+
+std::string DelphiUnitGenerator::GetBoundedName(const FieldDescriptor *desc)
+{
+    // the fields with the same values and capacity share their record, which is named after both
+    std::string element;
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_ENUM:
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        element = GetFieldType(desc).substr(1);
+        break;
+    default:
+        // named as the kinds of the tables, which are also the Delphi types of the values
+        element = GetTableKind(desc).substr(std::strlen("TFieldKind."));
+        element.erase(std::remove(element.begin(), element.end(), '&'), element.end());
+        break;
+    }
+    return "TBounded" + std::to_string(GetMaxCount(desc)) + element;
+}
+
+std::string DelphiUnitGenerator::GetElements(const FieldDescriptor *desc) const
+{
+    // the values of a repeated field, which the codecs index from zero
+    if (IsMap(desc)) {
+        return GetFieldAccess(desc) + ".FEntries";
+    }
+    if (IsBounded(desc)) {
+        return GetFieldAccess(desc) + ".FItems";
+    }
+    return GetFieldAccess(desc);
+}
+
+std::string DelphiUnitGenerator::GetElementCount(const FieldDescriptor *desc) const
+{
+    return IsBounded(desc) ? GetFieldAccess(desc) + ".FCount" : "Length(" + GetElements(desc) + ")";
+}
+
+std::string DelphiUnitGenerator::GetLastElement(const FieldDescriptor *desc) const
+{
+    return IsBounded(desc) ? GetFieldAccess(desc) + ".FCount - 1" : "High(" + GetElements(desc) + ")";
+}
+
+bool DelphiUnitGenerator::IsManaged(const Descriptor *desc)
+{
+    const auto it = _managed.find(desc);
+    if (it != _managed.end()) {
+        return it->second;
+    }
+    _managed[desc] = true; // a record cannot contain itself, but avoid recursing forever anyway
+    auto result = KeepsUnknown(desc);
+    for (int i = 0; i < desc->field_count() && !result; ++i) {
+        result = IsManaged(desc->field(i));
+    }
+    return _managed[desc] = result;
+}
+
+bool DelphiUnitGenerator::IsManaged(const FieldDescriptor *desc)
+{
+    // managed values are finalized by the compiler, which a variant part of a record cannot do
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+        return true;
+    case FieldDescriptor::TYPE_GROUP:
+    case FieldDescriptor::TYPE_MESSAGE:
+        return (desc->is_repeated() && !IsBounded(desc)) || IsLazy(desc) || IsBoxed(desc)
+            || IsManaged(desc->message_type());
+    default:
+        return desc->is_repeated() && !IsBounded(desc);
+    }
+}
+
+bool DelphiUnitGenerator::IsOverlaid(const FieldDescriptor *desc)
+{
+    return _overlapOneofs && desc->real_containing_oneof() && !IsManaged(desc);
+}
+
+auto DelphiUnitGenerator::GetMembers(const OneofDescriptor *desc) -> FieldGroup
+{
+    // the overlaid members come last, since the variant part of a record must follow its other fields
+    FieldGroup result;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        result.push_back(desc->field(i));
+    }
+    std::stable_partition(result.begin(), result.end(), [this](const FieldDescriptor *field) {
+        return !IsOverlaid(field);
+    });
+    return result;
+}
+
+int DelphiUnitGenerator::GetCaseValue(const FieldDescriptor *desc)
+{
+    // the case values follow the order of the members in the nested record, which the RTTI serializers rely on
+    const auto members = GetMembers(desc->real_containing_oneof());
+    return static_cast<int>(std::find(members.begin(), members.end(), desc) - members.begin()) + 1;
+}
+
+bool DelphiUnitGenerator::KeepsUnknown(const Descriptor *desc) const
+{
+    // the entries of a map are rebuilt from their key and value, like other implementations do
+    return _keepUnknown && !desc->options().map_entry();
+}
+
+bool DelphiUnitGenerator::HasPresenceBit(const FieldDescriptor *desc) const
+{
+    // sub-messages and oneof members already tell whether they are set, so only the other optional fields get a bit
+    return _emitPresence && desc->has_presence() && !desc->is_required() && !desc->message_type()
+        && !desc->real_containing_oneof();
+}
+
+int DelphiUnitGenerator::GetPresenceBit(const FieldDescriptor *desc) const
+{
+    auto bit = 0;
+    for (int i = 0; i < desc->index(); ++i) {
+        bit += HasPresenceBit(desc->containing_type()->field(i));
+    }
+    return bit;
+}
+
+int DelphiUnitGenerator::GetPresenceWordCount(const Descriptor *desc) const
+{
+    auto count = 0;
+    for (int i = 0; i < desc->field_count(); ++i) {
+        count += HasPresenceBit(desc->field(i));
+    }
+    return (count + 31) / 32;
+}
+
+std::string DelphiUnitGenerator::GetPresenceWord(const FieldDescriptor *desc) const
+{
+    if (GetPresenceWordCount(desc->containing_type()) == 1) {
+        return "FPresence";
+    }
+    return "FPresence[" + std::to_string(GetPresenceBit(desc) / 32) + "]";
+}
+
+std::string DelphiUnitGenerator::GetPresenceMask(const FieldDescriptor *desc) const
+{
+    char mask[16];
+    std::snprintf(mask, sizeof(mask), "$%X", 1u << GetPresenceBit(desc) % 32);
+    return mask;
+}
+
+int DelphiUnitGenerator::GetFixedSize(const FieldDescriptor *desc)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_DOUBLE:
+    case FieldDescriptor::TYPE_FIXED64:
+    case FieldDescriptor::TYPE_SFIXED64:
+        return 8;
+    case FieldDescriptor::TYPE_FLOAT:
+    case FieldDescriptor::TYPE_FIXED32:
+    case FieldDescriptor::TYPE_SFIXED32:
+        return 4;
+    case FieldDescriptor::TYPE_BOOL:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+std::string DelphiUnitGenerator::GetValueSize(const FieldDescriptor *desc, const std::string &value)
+{
+    switch (desc->type()) {
+    case FieldDescriptor::TYPE_SINT32:
+        return "SignedInt.ByteCount(Int32(" + value + "))";
+    case FieldDescriptor::TYPE_SINT64:
+        return "SignedInt.ByteCount(Int64(" + value + "))";
+    case FieldDescriptor::TYPE_ENUM:
+        return "VarInt.ByteCount(Ord(" + value + "))";
+    default:
+        const auto fixedsize = GetFixedSize(desc);
+        return fixedsize ? std::to_string(fixedsize) : "VarInt.ByteCount(" + value + ")";
     }
 }
@@ -4,6 +4,7 @@
 #include <google/protobuf/compiler/code_generator.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/io/printer.h>
+#include <google/protobuf/wire_format.h>
 
 using namespace google::protobuf;
 
@@ -15,6 +16,7 @@ public:
                         io::ZeroCopyOutputStream *stream);
 
     void Generate(const FileDescriptor *desc);
+    void GenerateLayout(io::ZeroCopyOutputStream *stream);
 
 private:
     struct Field
@@ -32,30 +34,170 @@ private:
     {
         std::string nameprefix;
         std::map<std::string, int> names;
+        std::vector<EnumValue> values;
         int nextNumber = 0;
     };
+    struct DenseEnum
+    {
+        std::string name;
+        std::vector<EnumValue> values;
+        int count;
+    };
+    struct NamedValue
+    {
+        std::string name;
+        int number;
+    };
+    struct Layout
+    {
+        int size;
+        int alignment;
+    };
+    typedef std::vector<const FieldDescriptor *> FieldGroup;
+    struct SparseEnum
+    {
+        std::string name;
+        std::vector<EnumValue> values;
+    };
 
     void Print(const FileDescriptor *desc);
     std::string Print(const Descriptor *desc);
     std::string Print(const EnumDescriptor *desc);
+    std::string PrintLazy(const Descriptor *desc);
+    std::string PrintBoxed(const Descriptor *desc);
+    std::string PrintMap(const Descriptor *desc);
+    std::string PrintBounded(const FieldDescriptor *desc);
+    void PrintView(const Descriptor *desc);
     void Print(const EnumValue &enumerator, EnumContext &context);
     void Print(const EnumValue &enumerator);
+    void PrintSparse(const EnumDescriptor *desc, const std::vector<EnumValue> &values);
+    void PrintSparseTables(const SparseEnum &sparse);
     void Print(const Field &field);
+    void PrintVariant(const Field &field);
+    std::string GetFieldDeclaration(const Field &field);
     void Print(const OneofDescriptor *oneof, bool closePrevious);
+    void PrintCase(const OneofDescriptor *oneof);
 
+    typedef void (DelphiUnitGenerator::*FieldPrinter)(const FieldDescriptor *desc);
+
+    void PrintEnumNames(const DenseEnum &dense);
+    void PrintFieldNames(const Descriptor *desc);
+    void PrintPerfectHash(const std::vector<NamedValue> &values);
+    void PrintTable(const Descriptor *desc);
+    void PrintTagConstants();
+    void PrintSchema(const FileDescriptor *desc);
+    void PrintLazyMethods(const Descriptor *desc);
+    void PrintBoxedMethods(const Descriptor *desc);
+    void PrintMapMethods(const Descriptor *desc);
+    void PrintBoundedMethods(const FieldDescriptor *desc);
+    void PrintViewMethods(const Descriptor *desc);
+    void PrintPresenceMethods(const Descriptor *desc);
+    void PrintFields(const Descriptor *desc, FieldPrinter print);
+    void PrintEncoder(const Descriptor *desc);
+    void PrintEncoder(const FieldDescriptor *desc);
+    void PrintSizer(const Descriptor *desc);
+    void PrintSizer(const FieldDescriptor *desc);
+    void PrintDecoder(const Descriptor *desc);
+    void PrintDecoder(const FieldDescriptor *desc);
+    void PrintDecodeStatements(const FieldDescriptor *desc, const std::string &target);
+
+    static bool IsSparse(const std::vector<EnumValue> &values);
     std::vector<EnumValue> GetEnumValues(const EnumDescriptor *desc);
     std::vector<EnumValue> GetEnumValues(const OneofDescriptor *desc);
     std::vector<Field> GetFields(const Descriptor *desc);
+    std::vector<FieldGroup> GetFieldGroups(const Descriptor *desc);
+    std::vector<FieldGroup> GetOrderedFieldGroups(const Descriptor *desc);
+    Layout GetLayout(const Descriptor *desc);
+    Layout GetLayout(const FieldGroup &group);
+    Layout GetLayout(const FieldDescriptor *desc);
+    Layout GetValueLayout(const FieldDescriptor *desc);
+    Layout GetBoundedLayout(const FieldDescriptor *desc, std::vector<int> *offsets = nullptr);
+    Layout GetOneofLayout(const FieldGroup &group, std::vector<int> *offsets = nullptr);
+    static Layout GetRecordLayout(const std::vector<Layout> &fields, std::vector<int> *offsets = nullptr);
+    void GetOffsets(const Descriptor *desc,
+                    std::map<const FieldDescriptor *, int> &offsets,
+                    std::map<const OneofDescriptor *, int> &caseOffsets,
+                    int &presenceOffset,
+                    int &unknownOffset);
+    static int GetOrdinalSize(int64_t high);
     std::string GetFieldType(const FieldDescriptor *desc);
     std::string GetFieldOptions(const FieldDescriptor *desc);
     static std::string GetFieldDefault(const FieldDescriptor *desc);
+    static std::string GetFieldAccess(const FieldDescriptor *desc);
+    static std::string GetWireType(const FieldDescriptor *desc);
+    static std::string GetPackedValue(const FieldDescriptor *desc, const std::string &value);
+    static std::string GetNonDefaultTest(const FieldDescriptor *desc, const std::string &value);
+    std::string GetTableKind(const FieldDescriptor *desc);
+    std::string GetTableFlags(const FieldDescriptor *desc);
+    std::string GetLayoutKind(const FieldDescriptor *desc);
+    std::string GetLayoutFlags(const FieldDescriptor *desc);
+    static internal::WireFormatLite::WireType GetEncodedWireType(const FieldDescriptor *desc);
+    static std::string GetTagConstant(int number, internal::WireFormatLite::WireType wiretype);
+    static bool IsForced(const FieldDescriptor *desc);
+    bool IsLazy(const FieldDescriptor *desc) const;
+    bool IsBoxed(const FieldDescriptor *desc) const;
+    bool IsMap(const FieldDescriptor *desc) const;
+    bool IsMapEntry(const FieldDescriptor *desc) const;
+    static std::string GetMapName(const Descriptor *desc);
+    static std::string GetKeyHash(const FieldDescriptor *desc);
+    static int GetMaxCount(const FieldDescriptor *desc);
+    static bool IsBounded(const FieldDescriptor *desc);
+    std::string GetBoundedName(const FieldDescriptor *desc);
+    std::string GetElements(const FieldDescriptor *desc) const;
+    std::string GetElementCount(const FieldDescriptor *desc) const;
+    std::string GetLastElement(const FieldDescriptor *desc) const;
+    bool IsManaged(const Descriptor *desc);
+    bool IsManaged(const FieldDescriptor *desc);
+    bool IsOverlaid(const FieldDescriptor *desc);
+    FieldGroup GetMembers(const OneofDescriptor *desc);
+    int GetCaseValue(const FieldDescriptor *desc);
+    bool KeepsUnknown(const Descriptor *desc) const;
+    bool HasPresenceBit(const FieldDescriptor *desc) const;
+    int GetPresenceBit(const FieldDescriptor *desc) const;
+    int GetPresenceWordCount(const Descriptor *desc) const;
+    std::string GetPresenceWord(const FieldDescriptor *desc) const;
+    std::string GetPresenceMask(const FieldDescriptor *desc) const;
+    static void GetSchemaFiles(const FileDescriptor *desc, std::vector<const FileDescriptor *> &files);
+    static void Strip(FileDescriptorProto *desc);
+    static void Strip(DescriptorProto *desc);
+    static void Strip(EnumDescriptorProto *desc);
+    static int GetFixedSize(const FieldDescriptor *desc);
+    static std::string GetValueSize(const FieldDescriptor *desc, const std::string &value);
+    static std::string GetParsedVariable(const FieldDescriptor *desc);
+    static std::string GetParsedValue(const FieldDescriptor *desc);
+    std::string GetViewType(const FieldDescriptor *desc);
+    static std::string GetViewValue(const FieldDescriptor *desc, const std::string &value);
 
     std::map<std::string, std::string> _variables;
     std::set<std::string> _types;
+    std::vector<const Descriptor *> _messages;
+    std::vector<const Descriptor *> _lazyMessages; // messages held by lazy fields, in the order of their wrappers
+    std::vector<const Descriptor *> _boxedMessages; // messages held by boxed fields, in the order of their boxes
+    std::vector<const Descriptor *> _mapEntries; // entries of the map fields, in the order of their map records
+    std::vector<const FieldDescriptor *> _boundedFields; // the first field of each bounded record, in their order
+    std::vector<SparseEnum> _sparseEnums;
+    std::vector<DenseEnum> _denseEnums;
+    std::map<const Descriptor *, Layout> _layouts;
+    std::map<const Descriptor *, bool> _managed; // whether each record holds strings, dynamic arrays or wrappers
     io::Printer _printer;
 
     bool _emitJsonNames = false;
     bool _emitUnusedTypes = false;
+    bool _emitCodecs = false;
+    bool _optimizeLayout = false;
+    bool _emitTables = false;
+    bool _lazyFields = false;
+    bool _boxFields = false;
+    bool _emitViews = false;
+    bool _emitPresence = false;
+    bool _overlapOneofs = false;
+    bool _emitSchema = false;
+    bool _hashMaps = false;
+    bool _keepUnknown = false;
+    bool _emitLayout = false;
+
+    static const int PointerSize = 8; // layouts are computed for 64-bit targets
+    static const int MaxBoundedCount = 255; // the capacity of a bounded field is held by a byte in the tables
 };
 
 #endif // DELPHIUNITGENERATOR_H
@@ -1,5 +1,7 @@
 #include "delphiutils.h"
 
+#include <algorithm>
+
 std::string GetPascalCase(const std::string &name)
 {
     auto isAlpha = false;
@@ -39,3 +41,60 @@ bool StartsWith(const std::string &value, const std::string &prefix, bool ignore
     }
     return true;
 }
+
+bool GetPerfectHash(const std::vector<std::string> &keys, std::vector<int32_t> &seeds, std::vector<int> &slots)
+{
+    // hash and displace: the keys are spread into buckets with seed 0, then the buckets are placed from the largest
+    // down, each with the first seed that moves all of its keys to free slots; a bucket holding a single key is
+    // placed directly into a remaining slot, which is encoded as the negative seed -(slot + 1)
+    const auto count = static_cast<uint32_t>(keys.size());
+    std::vector<std::vector<int>> buckets(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        buckets[GetPerfectHashSlot(GetPerfectHashValue(keys[i], 0), count)].push_back(i);
+    }
+    std::vector<uint32_t> order(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t lhs, uint32_t rhs) {
+        return buckets[lhs].size() > buckets[rhs].size();
+    });
+    const int32_t maxSeed = 1 << 20;
+    seeds.assign(count, 0);
+    slots.assign(count, -1);
+    auto next = order.begin();
+    for (; next != order.end() && buckets[*next].size() > 1; ++next) {
+        const auto &bucket = buckets[*next];
+        std::vector<uint32_t> candidates;
+        int32_t seed = 1;
+        for (; seed < maxSeed; ++seed) {
+            candidates.clear();
+            for (const auto key : bucket) {
+                const auto slot = GetPerfectHashSlot(GetPerfectHashValue(keys[key], seed), count);
+                if (slots[slot] >= 0 || std::find(candidates.begin(), candidates.end(), slot) != candidates.end()) {
+                    break;
+                }
+                candidates.push_back(slot);
+            }
+            if (candidates.size() == bucket.size()) {
+                break;
+            }
+        }
+        if (seed == maxSeed) {
+            return false;
+        }
+        for (std::size_t k = 0; k < bucket.size(); ++k) {
+            slots[candidates[k]] = bucket[k];
+        }
+        seeds[*next] = seed;
+    }
+    uint32_t free = 0;
+    for (; next != order.end() && !buckets[*next].empty(); ++next) {
+        while (slots[free] >= 0) {
+            ++free;
+        }
+        slots[free] = buckets[*next].front();
+        seeds[*next] = -static_cast<int32_t>(free) - 1;
+    }
+    return true;
+}
@@ -2,10 +2,14 @@
 #define DELPHIUTILS_H
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 std::string GetPascalCase(const std::string &name);
 bool StartsWith(const std::string &value, const std::string &prefix, bool ignoreCase = false);
+bool GetPerfectHash(const std::vector<std::string> &keys, std::vector<int32_t> &seeds, std::vector<int> &slots);
 
 inline std::string ToLower(const std::string &name)
 {
@@ -45,6 +49,11 @@ inline std::string GetEnumName(const std::string &name)
     return "T" + GetFullName(name);
 }
 
+inline std::string GetCaseName(const std::string &name)
+{
+    return GetEnumName(name) + "Case";
+}
+
 inline std::string GetEnumValueName(const std::string &name, const std::string &prefix)
 {
     auto result = GetPascalCase(ToLower(name));
@@ -72,4 +81,62 @@ inline std::string GetBytesLiteral(const std::string &value)
     return result;
 }
 
+inline int GetVarIntSize(uint64_t value)
+{
+    auto result = 1;
+    for (; value >= 0x80; value >>= 7) {
+        ++result;
+    }
+    return result;
+}
+
+// the bytes of a VarInt packed into an integer in little-endian order, along with their count
+inline std::pair<uint64_t, int> GetVarIntBytes(uint64_t value)
+{
+    uint64_t result = 0;
+    auto count = 0;
+    for (; value >= 0x80; value >>= 7) {
+        result |= ((value & 0x7F) | 0x80) << (8 * count++);
+    }
+    result |= value << (8 * count++);
+    return {result, count};
+}
+
+inline std::string GetHexLiteral(uint64_t value)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    std::string result;
+    do {
+        result.insert(0, 1, digits[value & 0xF]);
+        result.insert(0, 1, digits[(value >> 4) & 0xF]);
+        value >>= 8;
+    } while (value);
+    return "$" + result;
+}
+
+inline uint64_t GetFnv1aHash(const std::string &value, uint64_t hash = 0xCBF29CE484222325)
+{
+    for (unsigned char ch : value) {
+        hash = (hash ^ ch) * 0x100000001B3;
+    }
+    return hash;
+}
+
+// must be kept in sync with PerfectHash.Hash in Delphi.Serial, which hashes the UTF-16 code units of ASCII names
+inline uint32_t GetPerfectHashValue(const std::string &key, uint32_t seed)
+{
+    uint32_t hash = 0x811C9DC5 ^ seed;
+    for (unsigned char ch : key) {
+        hash = (hash ^ ch) * 0x01000193;
+    }
+    return hash;
+}
+
+// must be kept in sync with PerfectHash.Reduce; the high bits are used, as the low bits of FNV-1a barely depend on the
+// seed
+inline uint32_t GetPerfectHashSlot(uint32_t hash, uint32_t count)
+{
+    return static_cast<uint32_t>((static_cast<uint64_t>(hash) * count) >> 32);
+}
+
 #endif // DELPHIUTILS_H
@@ -1,1154 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: schema/addressbook.proto
-
-#ifndef GOOGLE_PROTOBUF_INCLUDED_schema_2faddressbook_2eproto
-#define GOOGLE_PROTOBUF_INCLUDED_schema_2faddressbook_2eproto
-
-#include <limits>
-#include <string>
-
-#include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
-#error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please update
-#error your headers.
-#endif
-#if 3012004 < PROTOBUF_MIN_PROTOC_VERSION
-#error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers. Please
-#error regenerate this file with a newer version of protoc.
-#endif
-
-#include <google/protobuf/port_undef.inc>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/arena.h>
-#include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
-#include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
-#include <google/protobuf/metadata_lite.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
-#include <google/protobuf/extension_set.h>  // IWYU pragma: export
-#include <google/protobuf/generated_enum_reflection.h>
-#include <google/protobuf/unknown_field_set.h>
-#include <google/protobuf/timestamp.pb.h>
-// @@protoc_insertion_point(includes)
-#include <google/protobuf/port_def.inc>
-#define PROTOBUF_INTERNAL_EXPORT_schema_2faddressbook_2eproto
-PROTOBUF_NAMESPACE_OPEN
-namespace internal {
-class AnyMetadata;
-}  // namespace internal
-PROTOBUF_NAMESPACE_CLOSE
-
-// Internal implementation detail -- do not use these members.
-struct TableStruct_schema_2faddressbook_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
-};
-extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_schema_2faddressbook_2eproto;
-class AddressBook;
-class AddressBookDefaultTypeInternal;
-extern AddressBookDefaultTypeInternal _AddressBook_default_instance_;
-class Person;
-class PersonDefaultTypeInternal;
-extern PersonDefaultTypeInternal _Person_default_instance_;
-class Person_PhoneNumber;
-class Person_PhoneNumberDefaultTypeInternal;
-extern Person_PhoneNumberDefaultTypeInternal _Person_PhoneNumber_default_instance_;
-PROTOBUF_NAMESPACE_OPEN
-template<> ::AddressBook* Arena::CreateMaybeMessage<::AddressBook>(Arena*);
-template<> ::Person* Arena::CreateMaybeMessage<::Person>(Arena*);
-template<> ::Person_PhoneNumber* Arena::CreateMaybeMessage<::Person_PhoneNumber>(Arena*);
-PROTOBUF_NAMESPACE_CLOSE
-
-enum Person_PhoneType : int {
-  Person_PhoneType_MOBILE = 0,
-  Person_PhoneType_HOME = 1,
-  Person_PhoneType_WORK = 2,
-  Person_PhoneType_Person_PhoneType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::min(),
-  Person_PhoneType_Person_PhoneType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<::PROTOBUF_NAMESPACE_ID::int32>::max()
-};
-bool Person_PhoneType_IsValid(int value);
-constexpr Person_PhoneType Person_PhoneType_PhoneType_MIN = Person_PhoneType_MOBILE;
-constexpr Person_PhoneType Person_PhoneType_PhoneType_MAX = Person_PhoneType_WORK;
-constexpr int Person_PhoneType_PhoneType_ARRAYSIZE = Person_PhoneType_PhoneType_MAX + 1;
-
-const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Person_PhoneType_descriptor();
-template<typename T>
-inline const std::string& Person_PhoneType_Name(T enum_t_value) {
-  static_assert(::std::is_same<T, Person_PhoneType>::value ||
-    ::std::is_integral<T>::value,
-    "Incorrect type passed to function Person_PhoneType_Name.");
-  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
-    Person_PhoneType_descriptor(), enum_t_value);
-}
-inline bool Person_PhoneType_Parse(
-    const std::string& name, Person_PhoneType* value) {
-  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Person_PhoneType>(
-    Person_PhoneType_descriptor(), name, value);
-}
-// ===================================================================
-
-class Person_PhoneNumber PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Person.PhoneNumber) */ {
- public:
-  inline Person_PhoneNumber() : Person_PhoneNumber(nullptr) {};
-  virtual ~Person_PhoneNumber();
-
-  Person_PhoneNumber(const Person_PhoneNumber& from);
-  Person_PhoneNumber(Person_PhoneNumber&& from) noexcept
-    : Person_PhoneNumber() {
-    *this = ::std::move(from);
-  }
-
-  inline Person_PhoneNumber& operator=(const Person_PhoneNumber& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Person_PhoneNumber& operator=(Person_PhoneNumber&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Person_PhoneNumber& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Person_PhoneNumber* internal_default_instance() {
-    return reinterpret_cast<const Person_PhoneNumber*>(
-               &_Person_PhoneNumber_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    0;
-
-  friend void swap(Person_PhoneNumber& a, Person_PhoneNumber& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Person_PhoneNumber* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Person_PhoneNumber* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Person_PhoneNumber* New() const final {
-    return CreateMaybeMessage<Person_PhoneNumber>(nullptr);
-  }
-
-  Person_PhoneNumber* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Person_PhoneNumber>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Person_PhoneNumber& from);
-  void MergeFrom(const Person_PhoneNumber& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Person_PhoneNumber* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Person.PhoneNumber";
-  }
-  protected:
-  explicit Person_PhoneNumber(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_schema_2faddressbook_2eproto);
-    return ::descriptor_table_schema_2faddressbook_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kNumberFieldNumber = 1,
-    kTypeFieldNumber = 2,
-  };
-  // string number = 1;
-  void clear_number();
-  const std::string& number() const;
-  void set_number(const std::string& value);
-  void set_number(std::string&& value);
-  void set_number(const char* value);
-  void set_number(const char* value, size_t size);
-  std::string* mutable_number();
-  std::string* release_number();
-  void set_allocated_number(std::string* number);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_number();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_number(
-      std::string* number);
-  private:
-  const std::string& _internal_number() const;
-  void _internal_set_number(const std::string& value);
-  std::string* _internal_mutable_number();
-  public:
-
-  // .Person.PhoneType type = 2;
-  void clear_type();
-  ::Person_PhoneType type() const;
-  void set_type(::Person_PhoneType value);
-  private:
-  ::Person_PhoneType _internal_type() const;
-  void _internal_set_type(::Person_PhoneType value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:Person.PhoneNumber)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr number_;
-  int type_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_schema_2faddressbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Person PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:Person) */ {
- public:
-  inline Person() : Person(nullptr) {};
-  virtual ~Person();
-
-  Person(const Person& from);
-  Person(Person&& from) noexcept
-    : Person() {
-    *this = ::std::move(from);
-  }
-
-  inline Person& operator=(const Person& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Person& operator=(Person&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const Person& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const Person* internal_default_instance() {
-    return reinterpret_cast<const Person*>(
-               &_Person_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(Person& a, Person& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Person* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Person* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline Person* New() const final {
-    return CreateMaybeMessage<Person>(nullptr);
-  }
-
-  Person* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<Person>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const Person& from);
-  void MergeFrom(const Person& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Person* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "Person";
-  }
-  protected:
-  explicit Person(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_schema_2faddressbook_2eproto);
-    return ::descriptor_table_schema_2faddressbook_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  typedef Person_PhoneNumber PhoneNumber;
-
-  typedef Person_PhoneType PhoneType;
-  static constexpr PhoneType MOBILE =
-    Person_PhoneType_MOBILE;
-  static constexpr PhoneType HOME =
-    Person_PhoneType_HOME;
-  static constexpr PhoneType WORK =
-    Person_PhoneType_WORK;
-  static inline bool PhoneType_IsValid(int value) {
-    return Person_PhoneType_IsValid(value);
-  }
-  static constexpr PhoneType PhoneType_MIN =
-    Person_PhoneType_PhoneType_MIN;
-  static constexpr PhoneType PhoneType_MAX =
-    Person_PhoneType_PhoneType_MAX;
-  static constexpr int PhoneType_ARRAYSIZE =
-    Person_PhoneType_PhoneType_ARRAYSIZE;
-  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
-  PhoneType_descriptor() {
-    return Person_PhoneType_descriptor();
-  }
-  template<typename T>
-  static inline const std::string& PhoneType_Name(T enum_t_value) {
-    static_assert(::std::is_same<T, PhoneType>::value ||
-      ::std::is_integral<T>::value,
-      "Incorrect type passed to function PhoneType_Name.");
-    return Person_PhoneType_Name(enum_t_value);
-  }
-  static inline bool PhoneType_Parse(const std::string& name,
-      PhoneType* value) {
-    return Person_PhoneType_Parse(name, value);
-  }
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kPhonesFieldNumber = 4,
-    kNameFieldNumber = 1,
-    kEmailFieldNumber = 3,
-    kLastUpdatedFieldNumber = 5,
-    kIdFieldNumber = 2,
-  };
-  // repeated .Person.PhoneNumber phones = 4;
-  int phones_size() const;
-  private:
-  int _internal_phones_size() const;
-  public:
-  void clear_phones();
-  ::Person_PhoneNumber* mutable_phones(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person_PhoneNumber >*
-      mutable_phones();
-  private:
-  const ::Person_PhoneNumber& _internal_phones(int index) const;
-  ::Person_PhoneNumber* _internal_add_phones();
-  public:
-  const ::Person_PhoneNumber& phones(int index) const;
-  ::Person_PhoneNumber* add_phones();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person_PhoneNumber >&
-      phones() const;
-
-  // string name = 1;
-  void clear_name();
-  const std::string& name() const;
-  void set_name(const std::string& value);
-  void set_name(std::string&& value);
-  void set_name(const char* value);
-  void set_name(const char* value, size_t size);
-  std::string* mutable_name();
-  std::string* release_name();
-  void set_allocated_name(std::string* name);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_name();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_name(
-      std::string* name);
-  private:
-  const std::string& _internal_name() const;
-  void _internal_set_name(const std::string& value);
-  std::string* _internal_mutable_name();
-  public:
-
-  // string email = 3;
-  void clear_email();
-  const std::string& email() const;
-  void set_email(const std::string& value);
-  void set_email(std::string&& value);
-  void set_email(const char* value);
-  void set_email(const char* value, size_t size);
-  std::string* mutable_email();
-  std::string* release_email();
-  void set_allocated_email(std::string* email);
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  std::string* unsafe_arena_release_email();
-  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
-  "    string fields are deprecated and will be removed in a"
-  "    future release.")
-  void unsafe_arena_set_allocated_email(
-      std::string* email);
-  private:
-  const std::string& _internal_email() const;
-  void _internal_set_email(const std::string& value);
-  std::string* _internal_mutable_email();
-  public:
-
-  // .google.protobuf.Timestamp last_updated = 5;
-  bool has_last_updated() const;
-  private:
-  bool _internal_has_last_updated() const;
-  public:
-  void clear_last_updated();
-  const PROTOBUF_NAMESPACE_ID::Timestamp& last_updated() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* release_last_updated();
-  PROTOBUF_NAMESPACE_ID::Timestamp* mutable_last_updated();
-  void set_allocated_last_updated(PROTOBUF_NAMESPACE_ID::Timestamp* last_updated);
-  private:
-  const PROTOBUF_NAMESPACE_ID::Timestamp& _internal_last_updated() const;
-  PROTOBUF_NAMESPACE_ID::Timestamp* _internal_mutable_last_updated();
-  public:
-  void unsafe_arena_set_allocated_last_updated(
-      PROTOBUF_NAMESPACE_ID::Timestamp* last_updated);
-  PROTOBUF_NAMESPACE_ID::Timestamp* unsafe_arena_release_last_updated();
-
-  // int32 id = 2;
-  void clear_id();
-  ::PROTOBUF_NAMESPACE_ID::int32 id() const;
-  void set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
-  private:
-  ::PROTOBUF_NAMESPACE_ID::int32 _internal_id() const;
-  void _internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:Person)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person_PhoneNumber > phones_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr email_;
-  PROTOBUF_NAMESPACE_ID::Timestamp* last_updated_;
-  ::PROTOBUF_NAMESPACE_ID::int32 id_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_schema_2faddressbook_2eproto;
-};
-// -------------------------------------------------------------------
-
-class AddressBook PROTOBUF_FINAL :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:AddressBook) */ {
- public:
-  inline AddressBook() : AddressBook(nullptr) {};
-  virtual ~AddressBook();
-
-  AddressBook(const AddressBook& from);
-  AddressBook(AddressBook&& from) noexcept
-    : AddressBook() {
-    *this = ::std::move(from);
-  }
-
-  inline AddressBook& operator=(const AddressBook& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline AddressBook& operator=(AddressBook&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return GetMetadataStatic().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return GetMetadataStatic().reflection;
-  }
-  static const AddressBook& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
-  static inline const AddressBook* internal_default_instance() {
-    return reinterpret_cast<const AddressBook*>(
-               &_AddressBook_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    2;
-
-  friend void swap(AddressBook& a, AddressBook& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(AddressBook* other) {
-    if (other == this) return;
-    if (GetArena() == other->GetArena()) {
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(AddressBook* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  inline AddressBook* New() const final {
-    return CreateMaybeMessage<AddressBook>(nullptr);
-  }
-
-  AddressBook* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
-    return CreateMaybeMessage<AddressBook>(arena);
-  }
-  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
-  void CopyFrom(const AddressBook& from);
-  void MergeFrom(const AddressBook& from);
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  inline void SharedCtor();
-  inline void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(AddressBook* other);
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "AddressBook";
-  }
-  protected:
-  explicit AddressBook(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  public:
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-  private:
-  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
-    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_schema_2faddressbook_2eproto);
-    return ::descriptor_table_schema_2faddressbook_2eproto.file_level_metadata[kIndexInFileMessages];
-  }
-
-  public:
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kPeopleFieldNumber = 1,
-  };
-  // repeated .Person people = 1;
-  int people_size() const;
-  private:
-  int _internal_people_size() const;
-  public:
-  void clear_people();
-  ::Person* mutable_people(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person >*
-      mutable_people();
-  private:
-  const ::Person& _internal_people(int index) const;
-  ::Person* _internal_add_people();
-  public:
-  const ::Person& people(int index) const;
-  ::Person* add_people();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person >&
-      people() const;
-
-  // @@protoc_insertion_point(class_scope:AddressBook)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person > people_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_schema_2faddressbook_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Person_PhoneNumber
-
-// string number = 1;
-inline void Person_PhoneNumber::clear_number() {
-  number_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Person_PhoneNumber::number() const {
-  // @@protoc_insertion_point(field_get:Person.PhoneNumber.number)
-  return _internal_number();
-}
-inline void Person_PhoneNumber::set_number(const std::string& value) {
-  _internal_set_number(value);
-  // @@protoc_insertion_point(field_set:Person.PhoneNumber.number)
-}
-inline std::string* Person_PhoneNumber::mutable_number() {
-  // @@protoc_insertion_point(field_mutable:Person.PhoneNumber.number)
-  return _internal_mutable_number();
-}
-inline const std::string& Person_PhoneNumber::_internal_number() const {
-  return number_.Get();
-}
-inline void Person_PhoneNumber::_internal_set_number(const std::string& value) {
-  
-  number_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Person_PhoneNumber::set_number(std::string&& value) {
-  
-  number_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Person.PhoneNumber.number)
-}
-inline void Person_PhoneNumber::set_number(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  number_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Person.PhoneNumber.number)
-}
-inline void Person_PhoneNumber::set_number(const char* value,
-    size_t size) {
-  
-  number_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Person.PhoneNumber.number)
-}
-inline std::string* Person_PhoneNumber::_internal_mutable_number() {
-  
-  return number_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* Person_PhoneNumber::release_number() {
-  // @@protoc_insertion_point(field_release:Person.PhoneNumber.number)
-  return number_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Person_PhoneNumber::set_allocated_number(std::string* number) {
-  if (number != nullptr) {
-    
-  } else {
-    
-  }
-  number_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), number,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Person.PhoneNumber.number)
-}
-inline std::string* Person_PhoneNumber::unsafe_arena_release_number() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Person.PhoneNumber.number)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return number_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void Person_PhoneNumber::unsafe_arena_set_allocated_number(
-    std::string* number) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (number != nullptr) {
-    
-  } else {
-    
-  }
-  number_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      number, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Person.PhoneNumber.number)
-}
-
-// .Person.PhoneType type = 2;
-inline void Person_PhoneNumber::clear_type() {
-  type_ = 0;
-}
-inline ::Person_PhoneType Person_PhoneNumber::_internal_type() const {
-  return static_cast< ::Person_PhoneType >(type_);
-}
-inline ::Person_PhoneType Person_PhoneNumber::type() const {
-  // @@protoc_insertion_point(field_get:Person.PhoneNumber.type)
-  return _internal_type();
-}
-inline void Person_PhoneNumber::_internal_set_type(::Person_PhoneType value) {
-  
-  type_ = value;
-}
-inline void Person_PhoneNumber::set_type(::Person_PhoneType value) {
-  _internal_set_type(value);
-  // @@protoc_insertion_point(field_set:Person.PhoneNumber.type)
-}
-
-// -------------------------------------------------------------------
-
-// Person
-
-// string name = 1;
-inline void Person::clear_name() {
-  name_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Person::name() const {
-  // @@protoc_insertion_point(field_get:Person.name)
-  return _internal_name();
-}
-inline void Person::set_name(const std::string& value) {
-  _internal_set_name(value);
-  // @@protoc_insertion_point(field_set:Person.name)
-}
-inline std::string* Person::mutable_name() {
-  // @@protoc_insertion_point(field_mutable:Person.name)
-  return _internal_mutable_name();
-}
-inline const std::string& Person::_internal_name() const {
-  return name_.Get();
-}
-inline void Person::_internal_set_name(const std::string& value) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Person::set_name(std::string&& value) {
-  
-  name_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Person.name)
-}
-inline void Person::set_name(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Person.name)
-}
-inline void Person::set_name(const char* value,
-    size_t size) {
-  
-  name_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Person.name)
-}
-inline std::string* Person::_internal_mutable_name() {
-  
-  return name_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* Person::release_name() {
-  // @@protoc_insertion_point(field_release:Person.name)
-  return name_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Person::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  name_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), name,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Person.name)
-}
-inline std::string* Person::unsafe_arena_release_name() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Person.name)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return name_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void Person::unsafe_arena_set_allocated_name(
-    std::string* name) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  name_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      name, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Person.name)
-}
-
-// int32 id = 2;
-inline void Person::clear_id() {
-  id_ = 0;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Person::_internal_id() const {
-  return id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::int32 Person::id() const {
-  // @@protoc_insertion_point(field_get:Person.id)
-  return _internal_id();
-}
-inline void Person::_internal_set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  
-  id_ = value;
-}
-inline void Person::set_id(::PROTOBUF_NAMESPACE_ID::int32 value) {
-  _internal_set_id(value);
-  // @@protoc_insertion_point(field_set:Person.id)
-}
-
-// string email = 3;
-inline void Person::clear_email() {
-  email_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& Person::email() const {
-  // @@protoc_insertion_point(field_get:Person.email)
-  return _internal_email();
-}
-inline void Person::set_email(const std::string& value) {
-  _internal_set_email(value);
-  // @@protoc_insertion_point(field_set:Person.email)
-}
-inline std::string* Person::mutable_email() {
-  // @@protoc_insertion_point(field_mutable:Person.email)
-  return _internal_mutable_email();
-}
-inline const std::string& Person::_internal_email() const {
-  return email_.Get();
-}
-inline void Person::_internal_set_email(const std::string& value) {
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
-}
-inline void Person::set_email(std::string&& value) {
-  
-  email_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:Person.email)
-}
-inline void Person::set_email(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:Person.email)
-}
-inline void Person::set_email(const char* value,
-    size_t size) {
-  
-  email_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:Person.email)
-}
-inline std::string* Person::_internal_mutable_email() {
-  
-  return email_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline std::string* Person::release_email() {
-  // @@protoc_insertion_point(field_release:Person.email)
-  return email_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Person::set_allocated_email(std::string* email) {
-  if (email != nullptr) {
-    
-  } else {
-    
-  }
-  email_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), email,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:Person.email)
-}
-inline std::string* Person::unsafe_arena_release_email() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:Person.email)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return email_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
-}
-inline void Person::unsafe_arena_set_allocated_email(
-    std::string* email) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (email != nullptr) {
-    
-  } else {
-    
-  }
-  email_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      email, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Person.email)
-}
-
-// repeated .Person.PhoneNumber phones = 4;
-inline int Person::_internal_phones_size() const {
-  return phones_.size();
-}
-inline int Person::phones_size() const {
-  return _internal_phones_size();
-}
-inline void Person::clear_phones() {
-  phones_.Clear();
-}
-inline ::Person_PhoneNumber* Person::mutable_phones(int index) {
-  // @@protoc_insertion_point(field_mutable:Person.phones)
-  return phones_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person_PhoneNumber >*
-Person::mutable_phones() {
-  // @@protoc_insertion_point(field_mutable_list:Person.phones)
-  return &phones_;
-}
-inline const ::Person_PhoneNumber& Person::_internal_phones(int index) const {
-  return phones_.Get(index);
-}
-inline const ::Person_PhoneNumber& Person::phones(int index) const {
-  // @@protoc_insertion_point(field_get:Person.phones)
-  return _internal_phones(index);
-}
-inline ::Person_PhoneNumber* Person::_internal_add_phones() {
-  return phones_.Add();
-}
-inline ::Person_PhoneNumber* Person::add_phones() {
-  // @@protoc_insertion_point(field_add:Person.phones)
-  return _internal_add_phones();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person_PhoneNumber >&
-Person::phones() const {
-  // @@protoc_insertion_point(field_list:Person.phones)
-  return phones_;
-}
-
-// .google.protobuf.Timestamp last_updated = 5;
-inline bool Person::_internal_has_last_updated() const {
-  return this != internal_default_instance() && last_updated_ != nullptr;
-}
-inline bool Person::has_last_updated() const {
-  return _internal_has_last_updated();
-}
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& Person::_internal_last_updated() const {
-  const PROTOBUF_NAMESPACE_ID::Timestamp* p = last_updated_;
-  return p != nullptr ? *p : *reinterpret_cast<const PROTOBUF_NAMESPACE_ID::Timestamp*>(
-      &PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
-}
-inline const PROTOBUF_NAMESPACE_ID::Timestamp& Person::last_updated() const {
-  // @@protoc_insertion_point(field_get:Person.last_updated)
-  return _internal_last_updated();
-}
-inline void Person::unsafe_arena_set_allocated_last_updated(
-    PROTOBUF_NAMESPACE_ID::Timestamp* last_updated) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_updated_);
-  }
-  last_updated_ = last_updated;
-  if (last_updated) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:Person.last_updated)
-}
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Person::release_last_updated() {
-  auto temp = unsafe_arena_release_last_updated();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Person::unsafe_arena_release_last_updated() {
-  // @@protoc_insertion_point(field_release:Person.last_updated)
-  
-  PROTOBUF_NAMESPACE_ID::Timestamp* temp = last_updated_;
-  last_updated_ = nullptr;
-  return temp;
-}
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Person::_internal_mutable_last_updated() {
-  
-  if (last_updated_ == nullptr) {
-    auto* p = CreateMaybeMessage<PROTOBUF_NAMESPACE_ID::Timestamp>(GetArena());
-    last_updated_ = p;
-  }
-  return last_updated_;
-}
-inline PROTOBUF_NAMESPACE_ID::Timestamp* Person::mutable_last_updated() {
-  // @@protoc_insertion_point(field_mutable:Person.last_updated)
-  return _internal_mutable_last_updated();
-}
-inline void Person::set_allocated_last_updated(PROTOBUF_NAMESPACE_ID::Timestamp* last_updated) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_updated_);
-  }
-  if (last_updated) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_updated)->GetArena();
-    if (message_arena != submessage_arena) {
-      last_updated = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, last_updated, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  last_updated_ = last_updated;
-  // @@protoc_insertion_point(field_set_allocated:Person.last_updated)
-}
-
-// -------------------------------------------------------------------
-
-// AddressBook
-
-// repeated .Person people = 1;
-inline int AddressBook::_internal_people_size() const {
-  return people_.size();
-}
-inline int AddressBook::people_size() const {
-  return _internal_people_size();
-}
-inline void AddressBook::clear_people() {
-  people_.Clear();
-}
-inline ::Person* AddressBook::mutable_people(int index) {
-  // @@protoc_insertion_point(field_mutable:AddressBook.people)
-  return people_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person >*
-AddressBook::mutable_people() {
-  // @@protoc_insertion_point(field_mutable_list:AddressBook.people)
-  return &people_;
-}
-inline const ::Person& AddressBook::_internal_people(int index) const {
-  return people_.Get(index);
-}
-inline const ::Person& AddressBook::people(int index) const {
-  // @@protoc_insertion_point(field_get:AddressBook.people)
-  return _internal_people(index);
-}
-inline ::Person* AddressBook::_internal_add_people() {
-  return people_.Add();
-}
-inline ::Person* AddressBook::add_people() {
-  // @@protoc_insertion_point(field_add:AddressBook.people)
-  return _internal_add_people();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::Person >&
-AddressBook::people() const {
-  // @@protoc_insertion_point(field_list:AddressBook.people)
-  return people_;
-}
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-
-PROTOBUF_NAMESPACE_OPEN
-
-template <> struct is_proto_enum< ::Person_PhoneType> : ::std::true_type {};
-template <>
-inline const EnumDescriptor* GetEnumDescriptor< ::Person_PhoneType>() {
-  return ::Person_PhoneType_descriptor();
-}
-
-PROTOBUF_NAMESPACE_CLOSE
-
-// @@protoc_insertion_point(global_scope)
-
-#include <google/protobuf/port_undef.inc>
-#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_schema_2faddressbook_2eproto
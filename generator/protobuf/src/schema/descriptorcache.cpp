@@ -0,0 +1,117 @@
+#include "descriptorcache.h"
+
+#include <fstream>
+#include <sstream>
+
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/stubs/logging.h>
+
+#include "delphiutils.h"
+
+namespace {
+
+class ImportErrorCollector : public compiler::MultiFileErrorCollector
+{
+public:
+    void AddError(const std::string &filename, int line, int column, const std::string &message) override
+    {
+        GOOGLE_LOG(ERROR) << filename << ":" << line + 1 << ":" << column + 1 << ": " << message;
+    }
+};
+
+ImportErrorCollector errorCollector;
+
+bool EndsWith(const std::string &value, const std::string &suffix)
+{
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // namespace
+
+DescriptorCache::DescriptorCache(const std::vector<std::string> &importPaths)
+    : _importPaths(importPaths)
+{
+}
+
+const google::protobuf::Message *DescriptorCache::GetPrototype(const std::string &schemaPath, const std::string &typeName)
+{
+    std::ifstream input(schemaPath, std::ios::binary);
+    std::ostringstream content;
+    if (!(content << input.rdbuf())) {
+        GOOGLE_LOG(ERROR) << "Could not read the schema file: " << schemaPath;
+        return nullptr;
+    }
+    // a .proto file resolves its imports relative to its own path, which is then part of its identity
+    const auto isProto = EndsWith(schemaPath, ".proto");
+    auto hash = GetFnv1aHash(content.str());
+    if (isProto) {
+        hash = GetFnv1aHash(schemaPath, hash);
+    }
+    auto &schema = _schemas[hash];
+    if (!schema) {
+        std::unique_ptr<Schema> loaded(new Schema);
+        if (!(isProto ? LoadProtoFile(schemaPath, *loaded) : LoadDescriptorSet(schemaPath, content.str(), *loaded))) {
+            _schemas.erase(hash);
+            return nullptr;
+        }
+        loaded->factory.reset(new DynamicMessageFactory(loaded->descriptors));
+        schema = std::move(loaded);
+    }
+    const auto descriptor = schema->descriptors->FindMessageTypeByName(typeName);
+    if (!descriptor) {
+        GOOGLE_LOG(ERROR) << "The schema declares no message named " << typeName << ": " << schemaPath;
+        return nullptr;
+    }
+    return schema->factory->GetPrototype(descriptor);
+}
+
+bool DescriptorCache::LoadDescriptorSet(const std::string &schemaPath, const std::string &content, Schema &schema)
+{
+    FileDescriptorSet files;
+    if (!files.ParseFromString(content)) {
+        GOOGLE_LOG(ERROR) << "Could not parse the descriptor set: " << schemaPath;
+        return false;
+    }
+    schema.database.reset(new SimpleDescriptorDatabase);
+    for (const auto &file : files.file()) {
+        if (!schema.database->Add(file)) {
+            return false;
+        }
+    }
+    // the files are built on demand, so that a set produced without --include_imports still resolves the well-known
+    // types
+    schema.generatedDatabase.reset(new DescriptorPoolDatabase(*DescriptorPool::generated_pool()));
+    schema.mergedDatabase.reset(new MergedDescriptorDatabase(schema.database.get(), schema.generatedDatabase.get()));
+    schema.pool.reset(new DescriptorPool(schema.mergedDatabase.get()));
+    schema.descriptors = schema.pool.get();
+    return true;
+}
+
+bool DescriptorCache::LoadProtoFile(const std::string &schemaPath, Schema &schema)
+{
+    // like protoc, the file has to be found under one of the import paths, which default to its own directory
+    schema.sourceTree.reset(new compiler::DiskSourceTree);
+    auto importPaths = _importPaths;
+    if (importPaths.empty()) {
+        const auto separator = schemaPath.find_last_of("/\\"); // either separator, as given on Windows
+        importPaths.push_back(separator == std::string::npos ? "." : schemaPath.substr(0, separator + 1));
+    }
+    for (const auto &path : importPaths) {
+        schema.sourceTree->MapPath("", path);
+    }
+    std::string virtualFile;
+    std::string shadowingFile;
+    if (schema.sourceTree->DiskFileToVirtualFile(schemaPath, &virtualFile, &shadowingFile)
+        != compiler::DiskSourceTree::SUCCESS) {
+        GOOGLE_LOG(ERROR) << "The schema file is not found under the import paths, or is shadowed by "
+                          << (shadowingFile.empty() ? "another file" : shadowingFile) << ": " << schemaPath;
+        return false;
+    }
+    schema.importer.reset(new compiler::Importer(schema.sourceTree.get(), &errorCollector));
+    const auto file = schema.importer->Import(virtualFile);
+    if (!file) {
+        return false;
+    }
+    schema.descriptors = file->pool();
+    return true;
+}
@@ -0,0 +1,49 @@
+#ifndef DESCRIPTORCACHE_H
+#define DESCRIPTORCACHE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/compiler/importer.h>
+#include <google/protobuf/descriptor_database.h>
+#include <google/protobuf/dynamic_message.h>
+
+using namespace google::protobuf;
+
+// Descriptor pools built at runtime from descriptor sets or .proto files, and shared by the schema files with the same
+// content, so that a single tool converts the messages of any schema
+class DescriptorCache
+{
+public:
+    explicit DescriptorCache(const std::vector<std::string> &importPaths);
+
+    // returns the prototype of a message declared by the schema file or its imports, or nullptr once the cause is
+    // logged; a path ending with .proto is parsed, and any other one is read as a serialized FileDescriptorSet
+    const google::protobuf::Message *GetPrototype(const std::string &schemaPath, const std::string &typeName);
+
+private:
+    struct Schema
+    {
+        // a descriptor set is looked up before the files linked into the tool, which provide the well-known types
+        std::unique_ptr<SimpleDescriptorDatabase> database;
+        std::unique_ptr<DescriptorPoolDatabase> generatedDatabase;
+        std::unique_ptr<MergedDescriptorDatabase> mergedDatabase;
+        // a .proto file is parsed along with its imports, which are found under the import paths
+        std::unique_ptr<compiler::DiskSourceTree> sourceTree;
+        std::unique_ptr<compiler::Importer> importer;
+        std::unique_ptr<DescriptorPool> pool;
+        const DescriptorPool *descriptors = nullptr;
+        // declared last, so that its prototypes are destroyed before the descriptors they refer to
+        std::unique_ptr<DynamicMessageFactory> factory;
+    };
+
+    bool LoadDescriptorSet(const std::string &schemaPath, const std::string &content, Schema &schema);
+    bool LoadProtoFile(const std::string &schemaPath, Schema &schema);
+
+    std::vector<std::string> _importPaths;
+    std::map<uint64_t, std::unique_ptr<Schema>> _schemas; // keyed by the hash of the content of their file
+};
+
+#endif // DESCRIPTORCACHE_H
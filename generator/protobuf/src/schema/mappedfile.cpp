@@ -0,0 +1,171 @@
+#include "mappedfile.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <google/protobuf/stubs/logging.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// the pages are dropped a chunk at a time, so that a pass over small messages does not make a system call for each
+const size_t kReleaseSize = 1 << 20;
+
+} // namespace
+
+#if defined(_WIN32)
+
+bool MappedFile::IsRegularFile(const std::string &path)
+{
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                  OPEN_EXISTING, 0, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    const auto type = GetFileType(file);
+    CloseHandle(file);
+    return type == FILE_TYPE_DISK;
+}
+
+MappedFile::~MappedFile()
+{
+    if (_mapping && _data) {
+        UnmapViewOfFile(_data);
+    }
+    if (_mapping) {
+        CloseHandle(_mapping);
+    }
+}
+
+bool MappedFile::Open(const std::string &path)
+{
+    // the sequential scan flag stands for the advice, which Windows takes when the file is opened
+    const auto file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        GOOGLE_LOG(ERROR) << "Could not open the input file (error " << GetLastError() << "): " << path;
+        return false;
+    }
+    if (GetFileType(file) != FILE_TYPE_DISK) {
+        char chunk[65536];
+        DWORD count;
+        auto success = true;
+        while ((success = ReadFile(file, chunk, sizeof(chunk), &count, nullptr) != 0) && count > 0) {
+            _buffer.append(chunk, count);
+        }
+        // a pipe whose writer is done reports that it is broken rather than an empty read
+        success = success || GetLastError() == ERROR_BROKEN_PIPE;
+        if (success) {
+            _data = _buffer.data();
+            _size = _buffer.size();
+        } else {
+            GOOGLE_LOG(ERROR) << "Could not read the input file (error " << GetLastError() << "): " << path;
+        }
+        CloseHandle(file);
+        return success;
+    }
+    LARGE_INTEGER size;
+    auto success = GetFileSizeEx(file, &size) != 0;
+    // an empty file cannot be mapped, and needs no mapping either
+    if (success && size.QuadPart > 0) {
+        _mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        _data = _mapping ? static_cast<const char *>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+        success = _data != nullptr;
+    }
+    if (success) {
+        _size = static_cast<size_t>(size.QuadPart);
+    } else {
+        GOOGLE_LOG(ERROR) << "Could not map the input file (error " << GetLastError() << "): " << path;
+    }
+    CloseHandle(file);
+    return success;
+}
+
+void MappedFile::Release(const char *)
+{
+    // the pages of a view cannot be dropped while it is mapped, but the sequential scan flag already has the cache
+    // recycle them first
+}
+
+#else
+
+bool MappedFile::IsRegularFile(const std::string &path)
+{
+    struct stat status;
+    return stat(path.c_str(), &status) == 0 && S_ISREG(status.st_mode);
+}
+
+MappedFile::~MappedFile()
+{
+    if (_data && _buffer.empty()) {
+        munmap(const_cast<char *>(_data), _size);
+    }
+}
+
+bool MappedFile::Open(const std::string &path)
+{
+    const auto file = open(path.c_str(), O_RDONLY);
+    if (file < 0) {
+        GOOGLE_LOG(ERROR) << "Could not open the input file (" << std::strerror(errno) << "): " << path;
+        return false;
+    }
+    struct stat status;
+    auto success = fstat(file, &status) == 0;
+    if (success && !S_ISREG(status.st_mode)) {
+        // a pipe or a device reports no size, so it is read to its end instead
+        char chunk[65536];
+        ssize_t count;
+        while ((count = read(file, chunk, sizeof(chunk))) > 0) {
+            _buffer.append(chunk, static_cast<size_t>(count));
+        }
+        success = count == 0;
+        if (success) {
+            _data = _buffer.data();
+            _size = _buffer.size();
+        } else {
+            GOOGLE_LOG(ERROR) << "Could not read the input file (" << std::strerror(errno) << "): " << path;
+        }
+        close(file);
+        return success;
+    }
+    // an empty file cannot be mapped, and needs no mapping either
+    if (success && status.st_size > 0) {
+        const auto data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        success = data != MAP_FAILED;
+        if (success) {
+            _data = static_cast<const char *>(data);
+            _size = static_cast<size_t>(status.st_size);
+            // the pages are read once, in order, so that the kernel reads ahead and drops those behind
+            madvise(data, _size, MADV_SEQUENTIAL);
+        }
+    }
+    if (!success) {
+        GOOGLE_LOG(ERROR) << "Could not map the input file (" << std::strerror(errno) << "): " << path;
+    }
+    close(file);
+    return success;
+}
+
+void MappedFile::Release(const char *position)
+{
+    if (!_buffer.empty()) {
+        return;
+    }
+    static const auto pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    // the mapping starts on a page boundary, so that the offset rounded down is one as well
+    const auto end = static_cast<size_t>(position - _data) / pageSize * pageSize;
+    if (end - _released >= kReleaseSize) {
+        madvise(const_cast<char *>(_data) + _released, end - _released, MADV_DONTNEED);
+        _released = end;
+    }
+}
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// A read-only mapping of a whole file, advised for a single sequential pass, so that its content is parsed in place
+// instead of being copied into buffers first. Pipes and devices cannot be mapped, so they are read into a buffer instead
+class MappedFile
+{
+public:
+    // tells whether the file can be mapped, as opposed to a pipe or a device, which can only be read once in order
+    static bool IsRegularFile(const std::string &path);
+
+    MappedFile() = default;
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    ~MappedFile();
+
+    // returns false once the cause is logged
+    bool Open(const std::string &path);
+
+    const char *Data() const
+    {
+        return _data;
+    }
+
+    size_t Size() const
+    {
+        return _size;
+    }
+
+    // drops the pages that lie wholly before the given position of a sequential pass, once they add up to a chunk, so
+    // that the pages resident stay bounded however large the file; they are read again if touched later
+    void Release(const char *position);
+
+private:
+    const char *_data = nullptr;
+    size_t _size = 0;
+    size_t _released = 0; // the size of the leading pages already dropped
+    std::string _buffer;  // the content of a file that could not be mapped
+#if defined(_WIN32)
+    void *_mapping = nullptr;
+#endif
+};
+
+#endif // MAPPEDFILE_H
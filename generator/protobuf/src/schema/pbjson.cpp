@@ -1,41 +1,75 @@
 #include "pbjson.h"
 
+#include <algorithm>
+#include <cctype>
+#include <climits>
 #include <fstream>
-#include <sstream>
+#include <memory>
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/util/delimited_message_util.h>
 #include <google/protobuf/util/json_util.h>
 
+#include "mappedfile.h"
+
+namespace {
+
+// messages are printed into a buffer kept by each thread, so that converting a batch of files reuses its capacity
+std::string &GetJsonBuffer()
+{
+    thread_local std::string buffer;
+    buffer.clear();
+    return buffer;
+}
+
+} // namespace
+
 int convert_binary_to_json(google::protobuf::Message &message,
                            const char *inputPath,
                            const char *outputPath)
 {
-    std::ifstream istream(inputPath, std::ios::binary);
-    if (!message.ParseFromIstream(&istream)) {
+    MappedFile input;
+    if (!input.Open(inputPath)) {
+        return -1;
+    }
+    if (input.Size() > INT_MAX) {
+        GOOGLE_LOG(ERROR) << "The input file exceeds the size limit of a message: " << inputPath;
+        return -1;
+    }
+    google::protobuf::io::ArrayInputStream stream(input.Data(), static_cast<int>(input.Size()));
+    if (!message.ParseFromZeroCopyStream(&stream)) {
         GOOGLE_LOG(ERROR) << "Could not parse the input file: " << inputPath;
         return -1;
     }
-    std::string json;
+    auto &json = GetJsonBuffer();
     google::protobuf::util::JsonPrintOptions options;
     options.add_whitespace = true;
     const auto status = google::protobuf::util::MessageToJsonString(message, &json, options);
     if (status.ok()) {
-        std::ofstream(outputPath) << json;
+        if (!(std::ofstream(outputPath) << json)) {
+            GOOGLE_LOG(ERROR) << "Could not write to the output file: " << outputPath;
+            return -1;
+        }
     } else {
-        GOOGLE_LOG(ERROR) << status.error_message();
+        GOOGLE_LOG(ERROR) << status.message();
     }
-    return status.error_code();
+    return static_cast<int>(status.code());
 }
 
 int convert_json_to_binary(google::protobuf::Message &message,
                            const char *inputPath,
                            const char *outputPath)
 {
-    std::stringstream json;
-    json << std::ifstream(inputPath).rdbuf();
+    MappedFile input;
+    if (!input.Open(inputPath)) {
+        return -1;
+    }
     google::protobuf::util::JsonParseOptions options;
     options.case_insensitive_enum_parsing = true;
-    const auto status = google::protobuf::util::JsonStringToMessage(json.str(), &message, options);
+    const auto status = google::protobuf::util::JsonStringToMessage(
+        google::protobuf::StringPiece(input.Data(), input.Size()), &message, options);
     if (status.ok()) {
         std::ofstream ostream(outputPath, std::ios::binary);
         if (!message.SerializeToOstream(&ostream)) {
@@ -43,7 +77,311 @@ int convert_json_to_binary(google::protobuf::Message &message,
             return -1;
         }
     } else {
-        GOOGLE_LOG(ERROR) << status.error_message();
+        GOOGLE_LOG(ERROR) << status.message();
+    }
+    return static_cast<int>(status.code());
+}
+
+namespace {
+
+const size_t kMaxPrefixSize = 5; // the longest varint encoding of a 32-bit length
+
+// Splits the text of a JSON array, or of JSON Lines, into the text of its top-level values, which stay where they are
+// in the input
+class JsonValueReader
+{
+public:
+    JsonValueReader(const char *data, size_t size)
+        : _position(data),
+          _end(data + size)
+    {
+    }
+
+    bool Next(google::protobuf::StringPiece &value)
+    {
+        auto c = SkipWhitespace();
+        if (_first) {
+            _first = false;
+            if (c == '[') {
+                _inArray = true;
+                ++_position;
+                c = SkipWhitespace();
+            }
+        }
+        if (_inArray) {
+            if (c == ']') {
+                ++_position;
+                _inArray = false;
+                c = SkipWhitespace();
+                return c == EOF ? false : Fail("Unexpected content after the array");
+            }
+            if (_count > 0) {
+                if (c != ',') {
+                    return Fail("Expected a comma between the array elements");
+                }
+                ++_position;
+                c = SkipWhitespace();
+            }
+        }
+        if (c == EOF) {
+            return _inArray ? Fail("The input ends within the array") : false;
+        }
+        const auto start = _position;
+        auto depth = 0;
+        auto inString = false;
+        do {
+            ++_position;
+            if (inString) {
+                if (c == '\\') {
+                    if (_position == _end) {
+                        break;
+                    }
+                    ++_position;
+                } else if (c == '"') {
+                    inString = false;
+                }
+            } else if (c == '"') {
+                inString = true;
+            } else if (c == '{' || c == '[') {
+                ++depth;
+            } else if (c == '}' || c == ']') {
+                --depth;
+            }
+            c = Peek();
+        } while (c != EOF && (depth > 0 || inString || !IsDelimiter(c)));
+        if (depth > 0 || inString) {
+            return Fail("The input ends within a value");
+        }
+        value = google::protobuf::StringPiece(start, _position - start);
+        ++_count;
+        return true;
+    }
+
+    bool Failed() const
+    {
+        return _failed;
+    }
+
+    int Count() const
+    {
+        return _count;
+    }
+
+private:
+    static bool IsDelimiter(int c)
+    {
+        return std::isspace(c) || c == ',' || c == ']' || c == '{' || c == '[';
+    }
+
+    int Peek() const
+    {
+        return _position == _end ? EOF : static_cast<unsigned char>(*_position);
+    }
+
+    int SkipWhitespace()
+    {
+        auto c = Peek();
+        while (c != EOF && std::isspace(c)) {
+            ++_position;
+            c = Peek();
+        }
+        return c;
+    }
+
+    bool Fail(const char *message)
+    {
+        GOOGLE_LOG(ERROR) << message << " after value " << _count;
+        _failed = true;
+        return false;
+    }
+
+    const char *_position;
+    const char *_end;
+    bool _first = true;
+    bool _inArray = false;
+    bool _failed = false;
+    int _count = 0;
+};
+
+} // namespace
+
+namespace {
+
+// Writes messages one at a time as the values of a JSON array, or as JSON Lines
+class JsonValueWriter
+{
+public:
+    JsonValueWriter(const char *outputPath, bool jsonLines)
+        : _ostream(outputPath),
+          _json(GetJsonBuffer()),
+          _jsonLines(jsonLines)
+    {
+        _options.add_whitespace = !jsonLines;
+        if (!jsonLines) {
+            _ostream << "[";
+        }
+    }
+
+    // returns the status code of the conversion, which is logged if not zero
+    int Write(const google::protobuf::Message &message)
+    {
+        _json.clear();
+        const auto status = google::protobuf::util::MessageToJsonString(message, &_json, _options);
+        if (!status.ok()) {
+            GOOGLE_LOG(ERROR) << "Message " << _count << ": " << status.message();
+            return static_cast<int>(status.code());
+        }
+        if (_jsonLines) {
+            _ostream << _json << '\n';
+        } else {
+            // the printer ends each message with a line break, which is moved after the comma
+            if (!_json.empty() && _json.back() == '\n') {
+                _json.pop_back();
+            }
+            _ostream << (_count == 0 ? "\n" : ",\n") << _json;
+        }
+        ++_count;
+        return 0;
+    }
+
+    // returns false once the cause is logged
+    bool Close(const char *outputPath)
+    {
+        if (!_jsonLines) {
+            _ostream << (_count == 0 ? "]\n" : "\n]\n");
+        }
+        if (!_ostream.flush()) {
+            GOOGLE_LOG(ERROR) << "Could not write to the output file: " << outputPath;
+            return false;
+        }
+        return true;
+    }
+
+    int Count() const
+    {
+        return _count;
+    }
+
+private:
+    std::ofstream _ostream;
+    std::string &_json;
+    google::protobuf::util::JsonPrintOptions _options;
+    bool _jsonLines;
+    int _count = 0;
+};
+
+// a pipe or a device cannot be mapped, so its messages are parsed as they are read, one coded stream each
+int convert_streamed_binary_to_json(google::protobuf::Message &message,
+                                    const char *inputPath,
+                                    const char *outputPath,
+                                    bool jsonLines)
+{
+    std::ifstream istream(inputPath, std::ios::binary);
+    if (!istream) {
+        GOOGLE_LOG(ERROR) << "Could not open the input file: " << inputPath;
+        return -1;
+    }
+    google::protobuf::io::IstreamInputStream stream(&istream);
+    JsonValueWriter writer(outputPath, jsonLines);
+    for (;;) {
+        message.Clear();
+        auto cleanEof = false;
+        if (!google::protobuf::util::ParseDelimitedFromZeroCopyStream(&message, &stream, &cleanEof)) {
+            if (cleanEof) {
+                break;
+            }
+            GOOGLE_LOG(ERROR) << "Could not parse message " << writer.Count() << " of the input file: " << inputPath;
+            return -1;
+        }
+        const auto result = writer.Write(message);
+        if (result != 0) {
+            return result;
+        }
+    }
+    return writer.Close(outputPath) ? 0 : -1;
+}
+
+} // namespace
+
+int convert_delimited_binary_to_json(google::protobuf::Message &message,
+                                     const char *inputPath,
+                                     const char *outputPath,
+                                     bool jsonLines)
+{
+    if (!MappedFile::IsRegularFile(inputPath)) {
+        return convert_streamed_binary_to_json(message, inputPath, outputPath, jsonLines);
+    }
+    MappedFile input;
+    if (!input.Open(inputPath)) {
+        return -1;
+    }
+    JsonValueWriter writer(outputPath, jsonLines);
+    // each message is parsed straight from the mapping, which the kernel reads ahead of it, and the pages behind it are
+    // released as it advances, so that neither memory nor the byte limits of a coded stream grow with the file
+    auto position = input.Data();
+    const auto end = position + input.Size();
+    while (position != end) {
+        const auto available = static_cast<size_t>(end - position);
+        google::protobuf::io::CodedInputStream prefix(reinterpret_cast<const uint8_t *>(position),
+                                                      static_cast<int>(std::min<size_t>(available, kMaxPrefixSize)));
+        uint32_t size;
+        if (!prefix.ReadVarint32(&size) || size > available - prefix.CurrentPosition() || size > INT_MAX) {
+            GOOGLE_LOG(ERROR) << "Could not read the length of message " << writer.Count()
+                              << " of the input file: " << inputPath;
+            return -1;
+        }
+        position += prefix.CurrentPosition();
+        google::protobuf::io::ArrayInputStream stream(position, static_cast<int>(size));
+        if (!message.ParseFromZeroCopyStream(&stream)) {
+            GOOGLE_LOG(ERROR) << "Could not parse message " << writer.Count() << " of the input file: " << inputPath;
+            return -1;
+        }
+        position += size;
+        input.Release(position);
+        const auto result = writer.Write(message);
+        if (result != 0) {
+            return result;
+        }
+    }
+    return writer.Close(outputPath) ? 0 : -1;
+}
+
+int convert_delimited_json_to_binary(google::protobuf::Message &message,
+                                     const char *inputPath,
+                                     const char *outputPath)
+{
+    MappedFile input;
+    if (!input.Open(inputPath)) {
+        return -1;
+    }
+    JsonValueReader reader(input.Data(), input.Size());
+    std::ofstream ostream(outputPath, std::ios::binary);
+    std::unique_ptr<google::protobuf::io::OstreamOutputStream> output(
+        new google::protobuf::io::OstreamOutputStream(&ostream));
+    google::protobuf::StringPiece json;
+    google::protobuf::util::JsonParseOptions options;
+    options.case_insensitive_enum_parsing = true;
+    while (reader.Next(json)) {
+        message.Clear();
+        const auto status = google::protobuf::util::JsonStringToMessage(json, &message, options);
+        if (!status.ok()) {
+            GOOGLE_LOG(ERROR) << "Message " << reader.Count() - 1 << ": " << status.message();
+            return static_cast<int>(status.code());
+        }
+        if (!google::protobuf::util::SerializeDelimitedToZeroCopyStream(message, output.get())) {
+            GOOGLE_LOG(ERROR) << "Could not write to the output file: " << outputPath;
+            return -1;
+        }
+    }
+    if (reader.Failed()) {
+        GOOGLE_LOG(ERROR) << "Could not split the input file into messages: " << inputPath;
+        return -1;
+    }
+    // the stream hands over the bytes it buffers when destroyed
+    output.reset();
+    if (!ostream.flush()) {
+        GOOGLE_LOG(ERROR) << "Could not write to the output file: " << outputPath;
+        return -1;
     }
-    return status.error_code();
+    return 0;
 }
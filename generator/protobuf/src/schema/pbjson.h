@@ -10,4 +10,14 @@ int convert_json_to_binary(google::protobuf::Message &message,
                            const char *inputPath,
                            const char *outputPath);
 
+// convert a sequence of varint length-prefixed messages one at a time, so that memory is bounded by the largest of
+// them; the JSON is an array, or JSON Lines, either of which is read back
+int convert_delimited_binary_to_json(google::protobuf::Message &message,
+                                     const char *inputPath,
+                                     const char *outputPath,
+                                     bool jsonLines);
+int convert_delimited_json_to_binary(google::protobuf::Message &message,
+                                     const char *inputPath,
+                                     const char *outputPath);
+
 #endif // PBJSON_H
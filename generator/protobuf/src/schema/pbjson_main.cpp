@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "descriptorcache.h"
+#include "pbjson.h"
+#include "pbjsonbatch.h"
+
+int print_usage()
+{
+    std::cerr << "Usage:" << std::endl;
+    std::cerr << "  pbjson [-r] [--delimited[=lines]] [-I<path>]... <schema> <message> <binary> <json>" << std::endl;
+    std::cerr << "  pbjson [-r] [--delimited[=lines]] [-I<path>]... [-j<jobs>] --batch=<output dir> <schema> <message>"
+              << " <input>..." << std::endl;
+    std::cerr << "The schema is a .proto file, found under the import paths, or a FileDescriptorSet as written by"
+              << std::endl;
+    std::cerr << "protoc --include_imports --descriptor_set_out. The message is given by its full name." << std::endl;
+    std::cerr << "With --delimited, the binary holds varint length-prefixed messages, which are converted one at a time"
+              << std::endl;
+    std::cerr << "to a JSON array, or to JSON Lines with --delimited=lines; -r reads back either form." << std::endl;
+    std::cerr << "With --batch, each input is a file, a directory, a wildcard pattern or @ followed by a manifest that"
+              << std::endl;
+    std::cerr << "lists one input per line. The files are converted on <jobs> threads, which default to the number of"
+              << std::endl;
+    std::cerr << "hardware threads, into files of the same name in the output directory." << std::endl;
+    return -1;
+}
+
+int convert_files(const google::protobuf::Message &prototype,
+                  const Conversion &conversion,
+                  unsigned jobCount,
+                  const std::vector<std::string> &inputs,
+                  const std::string &outputDirectory,
+                  const std::string &extension)
+{
+    std::vector<std::string> paths;
+    if (!expand_inputs(inputs, paths)) {
+        return -1;
+    }
+    auto files = get_batch_files(paths, outputDirectory, extension);
+    convert_batch(prototype, conversion, jobCount, files);
+    // the status of each file is printed once all are done, so that it is not interleaved with the logged errors
+    size_t converted = 0;
+    for (const auto &file : files) {
+        if (file.result == 0) {
+            std::cout << "converted " << file.inputPath << " to " << file.outputPath << std::endl;
+            ++converted;
+        } else {
+            std::cout << "failed    " << file.inputPath << " (" << file.result << ")" << std::endl;
+        }
+    }
+    std::cout << converted << " of " << files.size() << " files converted" << std::endl;
+    return converted == files.size() ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    auto reverse = false;
+    auto delimited = false;
+    auto jsonLines = false;
+    auto jobCount = std::max(std::thread::hardware_concurrency(), 1u);
+    const char *outputDirectory = nullptr;
+    std::vector<std::string> importPaths;
+    std::vector<const char *> arguments;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "-r") == 0) {
+            reverse = true;
+        } else if (std::strcmp(argv[i], "--delimited") == 0) {
+            delimited = true;
+        } else if (std::strcmp(argv[i], "--delimited=lines") == 0) {
+            delimited = true;
+            jsonLines = true;
+        } else if (std::strncmp(argv[i], "--batch=", 8) == 0) {
+            outputDirectory = argv[i] + 8;
+        } else if (std::strncmp(argv[i], "-j", 2) == 0) {
+            jobCount = std::max(std::atoi(argv[i] + 2), 1);
+        } else if (std::strncmp(argv[i], "-I", 2) == 0) {
+            // the path either follows the option directly or comes as the next argument, as with protoc
+            auto path = argv[i] + 2;
+            if (*path == '\0') {
+                if (++i == argc) {
+                    return print_usage();
+                }
+                path = argv[i];
+            }
+            importPaths.push_back(path);
+        } else {
+            arguments.push_back(argv[i]);
+        }
+    }
+    if (outputDirectory ? arguments.size() < 3 : arguments.size() != 4) {
+        return print_usage();
+    }
+    Conversion conversion;
+    if (delimited && reverse) {
+        conversion = convert_delimited_json_to_binary;
+    } else if (delimited) {
+        conversion = [jsonLines](google::protobuf::Message &message, const char *inputPath, const char *outputPath) {
+            return convert_delimited_binary_to_json(message, inputPath, outputPath, jsonLines);
+        };
+    } else if (reverse) {
+        conversion = convert_json_to_binary;
+    } else {
+        conversion = convert_binary_to_json;
+    }
+    try {
+        DescriptorCache cache(importPaths);
+        const auto prototype = cache.GetPrototype(arguments[0], arguments[1]);
+        if (!prototype) {
+            return -1;
+        }
+        if (outputDirectory) {
+            const auto extension = reverse ? ".bin" : jsonLines ? ".jsonl" : ".json";
+            const std::vector<std::string> inputs(arguments.begin() + 2, arguments.end());
+            return convert_files(*prototype, conversion, jobCount, inputs, outputDirectory, extension);
+        }
+        std::unique_ptr<google::protobuf::Message> message(prototype->New());
+        // the binary file comes first on the command line, whichever the direction
+        return reverse ? conversion(*message, arguments[3], arguments[2])
+                       : conversion(*message, arguments[2], arguments[3]);
+    } catch (std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return -1;
+    }
+}
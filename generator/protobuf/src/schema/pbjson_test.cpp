@@ -0,0 +1,371 @@
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/util/delimited_message_util.h>
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/util/message_differencer.h>
+
+#include "addressbook.pb.h"
+#include "message.pb.h"
+#include "schema/descriptorcache.h"
+#include "schema/mappedfile.h"
+#include "schema/pbjson.h"
+#include "schema/pbjsonbatch.h"
+
+#if defined(_WIN32)
+#include <direct.h>
+#define mkdir(path, mode) _mkdir(path)
+#else
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+int failures = 0;
+
+#define CHECK(condition)                                                                    \
+    do {                                                                                    \
+        if (!(condition)) {                                                                 \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                                     \
+        }                                                                                   \
+    } while (0)
+
+std::string sourceDir;
+std::string includeDir;
+std::string outputDir;
+
+std::string ReadFile(const std::string &path)
+{
+    std::ifstream input(path, std::ios::binary);
+    std::ostringstream content;
+    content << input.rdbuf();
+    return content.str();
+}
+
+void WriteFile(const std::string &path, const std::string &content)
+{
+    std::ofstream(path, std::ios::binary) << content;
+}
+
+AddressBook GetAddressBook()
+{
+    AddressBook addressbook;
+    auto person = addressbook.add_people();
+    person->set_name("abc");
+    person->set_id(1);
+    person->mutable_last_updated()->set_seconds(-1);
+    auto phone = person->add_phones();
+    phone->set_number("123");
+    phone->set_type(Person::WORK);
+    addressbook.add_people()->set_id(300);
+    return addressbook;
+}
+
+void TestProtoFile()
+{
+    // the schema is parsed at runtime, so that the dynamic message converts the data of the compiled one
+    DescriptorCache cache({sourceDir, includeDir});
+    const auto prototype = cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook");
+    CHECK(prototype != nullptr);
+    if (!prototype) {
+        return;
+    }
+    CHECK(prototype->GetDescriptor()->file()->pool() != DescriptorPool::generated_pool());
+    CHECK(cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook") == prototype);
+    CHECK(cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "Person") != nullptr);
+
+    const auto expected = GetAddressBook();
+    const auto binary = outputDir + "/pbjson-test.bin";
+    const auto json = outputDir + "/pbjson-test.json";
+    WriteFile(binary, expected.SerializeAsString());
+    std::unique_ptr<google::protobuf::Message> message(prototype->New());
+    CHECK(convert_binary_to_json(*message, binary.c_str(), json.c_str()) == 0);
+    AddressBook parsed;
+    CHECK(util::JsonStringToMessage(ReadFile(json), &parsed).ok());
+    CHECK(util::MessageDifferencer::Equals(parsed, expected));
+
+    message.reset(prototype->New());
+    CHECK(convert_json_to_binary(*message, json.c_str(), binary.c_str()) == 0);
+    CHECK(ReadFile(binary) == expected.SerializeAsString());
+}
+
+void TestDescriptorSet()
+{
+    // a set without its imports still finds the well-known types among the files linked into the tool
+    FileDescriptorSet files;
+    ::Message::descriptor()->file()->CopyTo(files.add_file());
+    AddressBook::descriptor()->file()->CopyTo(files.add_file());
+    const auto set = outputDir + "/pbjson-test.desc";
+    WriteFile(set, files.SerializeAsString());
+    DescriptorCache cache({});
+    const auto prototype = cache.GetPrototype(set, "AddressBook");
+    CHECK(prototype != nullptr);
+    CHECK(cache.GetPrototype(set, "Message") != nullptr);
+    if (!prototype) {
+        return;
+    }
+    const auto expected = GetAddressBook();
+    std::unique_ptr<google::protobuf::Message> message(prototype->New());
+    CHECK(message->ParseFromString(expected.SerializeAsString()));
+    CHECK(message->SerializeAsString() == expected.SerializeAsString());
+}
+
+void TestDelimited()
+{
+    DescriptorCache cache({sourceDir, includeDir});
+    const auto prototype = cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook");
+    CHECK(prototype != nullptr);
+    if (!prototype) {
+        return;
+    }
+    // the names hold the characters that delimit the values, which the splitter has to skip within strings
+    std::vector<AddressBook> expected(3, GetAddressBook());
+    expected[1].mutable_people(0)->set_name("],{\"[}\\");
+    expected[2].Clear();
+    const auto binary = outputDir + "/pbjson-test-delimited.bin";
+    {
+        std::ofstream ostream(binary, std::ios::binary);
+        for (const auto &addressbook : expected) {
+            CHECK(util::SerializeDelimitedToOstream(addressbook, &ostream));
+        }
+    }
+    const auto content = ReadFile(binary);
+    for (const auto jsonLines : {false, true}) {
+        const auto json = outputDir + (jsonLines ? "/pbjson-test-delimited.jsonl" : "/pbjson-test-delimited.json");
+        std::unique_ptr<google::protobuf::Message> message(prototype->New());
+        CHECK(convert_delimited_binary_to_json(*message, binary.c_str(), json.c_str(), jsonLines) == 0);
+        if (jsonLines) {
+            std::ifstream lines(json);
+            size_t i = 0;
+            for (std::string line; std::getline(lines, line); ++i) {
+                AddressBook parsed;
+                CHECK(i < expected.size() && util::JsonStringToMessage(line, &parsed).ok());
+                CHECK(i < expected.size() && util::MessageDifferencer::Equals(parsed, expected[i]));
+            }
+            CHECK(i == expected.size());
+        } else {
+            const auto array = ReadFile(json);
+            CHECK(array.compare(0, 2, "[\n") == 0 && array.compare(array.size() - 2, 2, "]\n") == 0);
+        }
+        // the array is checked by reading it back, which has to restore the same bytes
+        const auto roundTrip = outputDir + "/pbjson-test-delimited.out";
+        CHECK(convert_delimited_json_to_binary(*message, json.c_str(), roundTrip.c_str()) == 0);
+        CHECK(ReadFile(roundTrip) == content);
+    }
+
+    // a truncated message is reported, while an empty file is an empty sequence
+    std::unique_ptr<google::protobuf::Message> message(prototype->New());
+    const auto json = outputDir + "/pbjson-test-delimited.json";
+    WriteFile(binary, content.substr(0, content.size() / 2));
+    CHECK(convert_delimited_binary_to_json(*message, binary.c_str(), json.c_str(), false) != 0);
+    WriteFile(binary, "");
+    CHECK(convert_delimited_binary_to_json(*message, binary.c_str(), json.c_str(), false) == 0);
+    CHECK(ReadFile(json) == "[]\n");
+    CHECK(convert_delimited_json_to_binary(*message, json.c_str(), binary.c_str()) == 0);
+    CHECK(ReadFile(binary).empty());
+    WriteFile(json, "[{\"people\": []} {}]");
+    CHECK(convert_delimited_json_to_binary(*message, json.c_str(), binary.c_str()) != 0);
+    WriteFile(json, "[{\"people\": [}]");
+    CHECK(convert_delimited_json_to_binary(*message, json.c_str(), binary.c_str()) != 0);
+}
+
+void TestMappedFile()
+{
+    const auto path = outputDir + "/pbjson-test-mapped.bin";
+    const auto content = GetAddressBook().SerializeAsString();
+    WriteFile(path, content);
+    {
+        MappedFile file;
+        CHECK(file.Open(path));
+        CHECK(std::string(file.Data(), file.Size()) == content);
+    }
+    // the pages released behind a sequential pass are read again from the file if touched later
+    const std::string large(3 << 20, 'x');
+    WriteFile(path, large);
+    {
+        MappedFile file;
+        CHECK(file.Open(path));
+        file.Release(file.Data() + file.Size() / 2);
+        file.Release(file.Data() + file.Size());
+        CHECK(std::string(file.Data(), file.Size()) == large);
+    }
+    // an empty file is left unmapped, and reads as an empty message
+    WriteFile(path, "");
+    MappedFile empty;
+    CHECK(empty.Open(path));
+    CHECK(empty.Size() == 0);
+    MappedFile missing;
+    CHECK(!missing.Open(outputDir + "/pbjson-test-missing.bin"));
+    DescriptorCache cache({sourceDir, includeDir});
+    const auto prototype = cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook");
+    CHECK(prototype != nullptr);
+    if (!prototype) {
+        return;
+    }
+    const auto json = outputDir + "/pbjson-test-mapped.json";
+    std::unique_ptr<google::protobuf::Message> message(prototype->New());
+    CHECK(convert_binary_to_json(*message, path.c_str(), json.c_str()) == 0);
+    CHECK(ReadFile(json) == "{}\n");
+    CHECK(convert_json_to_binary(*message, (outputDir + "/pbjson-test-missing.json").c_str(), path.c_str()) != 0);
+}
+
+#if !defined(_WIN32)
+
+// writes the content into a FIFO on another thread, while the conversion reads it on this one
+int ConvertFromPipe(const std::string &content, const std::function<int(const char *)> &conversion)
+{
+    const auto path = outputDir + "/pbjson-test-pipe.bin";
+    unlink(path.c_str());
+    CHECK(mkfifo(path.c_str(), 0600) == 0);
+    std::thread writer([&]() {
+        std::ofstream(path, std::ios::binary) << content;
+    });
+    const auto result = conversion(path.c_str());
+    writer.join();
+    unlink(path.c_str());
+    return result;
+}
+
+void TestPipe()
+{
+    DescriptorCache cache({sourceDir, includeDir});
+    const auto prototype = cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook");
+    CHECK(prototype != nullptr);
+    if (!prototype) {
+        return;
+    }
+    // a pipe has no size, and is read to its end rather than taken for an empty file
+    std::unique_ptr<google::protobuf::Message> message(prototype->New());
+    const auto expected = GetAddressBook();
+    const auto json = outputDir + "/pbjson-test-pipe.json";
+    CHECK(ConvertFromPipe(expected.SerializeAsString(), [&](const char *path) {
+        return convert_binary_to_json(*message, path, json.c_str());
+    }) == 0);
+    AddressBook parsed;
+    CHECK(util::JsonStringToMessage(ReadFile(json), &parsed).ok());
+    CHECK(util::MessageDifferencer::Equals(parsed, expected));
+
+    // delimited messages are parsed as they arrive
+    std::ostringstream delimited;
+    for (int i = 0; i < 3; ++i) {
+        CHECK(util::SerializeDelimitedToOstream(expected, &delimited));
+    }
+    const auto jsonLines = outputDir + "/pbjson-test-pipe.jsonl";
+    message->Clear();
+    CHECK(ConvertFromPipe(delimited.str(), [&](const char *path) {
+        return convert_delimited_binary_to_json(*message, path, jsonLines.c_str(), true);
+    }) == 0);
+    std::ifstream lines(jsonLines);
+    size_t count = 0;
+    for (std::string line; std::getline(lines, line); ++count) {
+        parsed.Clear();
+        CHECK(util::JsonStringToMessage(line, &parsed).ok());
+        CHECK(util::MessageDifferencer::Equals(parsed, expected));
+    }
+    CHECK(count == 3);
+    CHECK(ConvertFromPipe(delimited.str().substr(0, delimited.str().size() - 1), [&](const char *path) {
+        return convert_delimited_binary_to_json(*message, path, jsonLines.c_str(), true);
+    }) != 0);
+}
+
+#endif
+
+void TestBatch()
+{
+    DescriptorCache cache({sourceDir, includeDir});
+    const auto prototype = cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook");
+    CHECK(prototype != nullptr);
+    if (!prototype) {
+        return;
+    }
+    const auto inputDirectory = outputDir + "/pbjson-test-batch";
+    const auto outputDirectory = outputDir + "/pbjson-test-batch-out";
+    mkdir(inputDirectory.c_str(), 0755);
+    mkdir(outputDirectory.c_str(), 0755);
+    std::vector<AddressBook> expected(20, GetAddressBook());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i].mutable_people(1)->set_id(static_cast<int32_t>(i));
+        WriteFile(inputDirectory + "/" + std::to_string(i) + ".bin", expected[i].SerializeAsString());
+    }
+    WriteFile(inputDirectory + "/corrupt.bin", "\xff");
+    WriteFile(outputDir + "/pbjson-test-batch.manifest",
+              "# a pattern and a file\n" + inputDirectory + "/1?.bin\n" + inputDirectory + "/5.bin\r\n\n");
+
+    // a directory lists its files, a pattern its matches and a manifest its inputs, each in name order
+    std::vector<std::string> paths;
+    CHECK(expand_inputs({inputDirectory}, paths));
+    CHECK(paths.size() == expected.size() + 1);
+    CHECK(!paths.empty() && paths.front() == inputDirectory + "/0.bin");
+    paths.clear();
+    CHECK(expand_inputs({"@" + outputDir + "/pbjson-test-batch.manifest"}, paths));
+    CHECK(paths.size() == 11);
+    CHECK(!paths.empty() && paths.back() == inputDirectory + "/5.bin");
+    paths.clear();
+    CHECK(!expand_inputs({inputDirectory + "/*.missing"}, paths));
+    CHECK(!expand_inputs({"@" + outputDir + "/pbjson-test-missing.manifest"}, paths));
+
+    // every file is converted, but the corrupt one and the one whose output is already taken
+    paths.clear();
+    CHECK(expand_inputs({inputDirectory, inputDirectory + "/7.bin"}, paths));
+    auto files = get_batch_files(paths, outputDirectory, ".json");
+    convert_batch(*prototype, convert_binary_to_json, 4, files);
+    CHECK(files.size() == expected.size() + 2);
+    for (const auto &file : files) {
+        const auto name = file.inputPath.substr(inputDirectory.size() + 1);
+        if (name == "corrupt.bin" || &file == &files.back()) {
+            CHECK(file.result != 0);
+            continue;
+        }
+        CHECK(file.result == 0);
+        CHECK(file.outputPath == outputDirectory + "/" + name.substr(0, name.size() - 4) + ".json");
+        AddressBook parsed;
+        CHECK(util::JsonStringToMessage(ReadFile(file.outputPath), &parsed).ok());
+        CHECK(util::MessageDifferencer::Equals(parsed, expected[std::stoul(name)]));
+    }
+}
+
+void TestErrors()
+{
+    DescriptorCache cache({sourceDir, includeDir});
+    CHECK(cache.GetPrototype(sourceDir + "/schema/addressbook.proto", "Missing") == nullptr);
+    CHECK(cache.GetPrototype(sourceDir + "/schema/missing.proto", "AddressBook") == nullptr);
+    CHECK(cache.GetPrototype(sourceDir + "/CMakeLists.txt", "AddressBook") == nullptr);
+    // a file outside the import paths cannot be given a name that its imports would agree with
+    DescriptorCache other({includeDir});
+    CHECK(other.GetPrototype(sourceDir + "/schema/addressbook.proto", "AddressBook") == nullptr);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    if (argc < 4) {
+        std::fprintf(stderr, "Usage: pbjson-test <source dir> <protobuf include dir> <output dir>\n");
+        return 1;
+    }
+    sourceDir = argv[1];
+    includeDir = argv[2];
+    outputDir = argv[3];
+    TestProtoFile();
+    TestDescriptorSet();
+    TestDelimited();
+    TestMappedFile();
+#if !defined(_WIN32)
+    TestPipe();
+#endif
+    TestBatch();
+    TestErrors();
+    if (failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include "pbjsonbatch.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <thread>
+
+#include <google/protobuf/stubs/logging.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <glob.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+bool HasWildcards(const std::string &path)
+{
+    return path.find_first_of("*?[") != std::string::npos;
+}
+
+#if defined(_WIN32)
+
+bool IsDirectory(const std::string &path)
+{
+    const auto attributes = GetFileAttributesA(path.c_str());
+    return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+}
+
+// lists the files that match the pattern, which may only hold wildcards in its last component
+bool FindFiles(const std::string &pattern, std::vector<std::string> &paths)
+{
+    const auto separator = pattern.find_last_of("/\\");
+    const auto directory = separator == std::string::npos ? std::string() : pattern.substr(0, separator + 1);
+    WIN32_FIND_DATAA data;
+    const auto find = FindFirstFileA(pattern.c_str(), &data);
+    if (find == INVALID_HANDLE_VALUE) {
+        return GetLastError() == ERROR_FILE_NOT_FOUND;
+    }
+    do {
+        if ((data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == 0 && data.cFileName[0] != '.') {
+            paths.push_back(directory + data.cFileName);
+        }
+    } while (FindNextFileA(find, &data));
+    FindClose(find);
+    return true;
+}
+
+bool ListDirectory(const std::string &directory, std::vector<std::string> &paths)
+{
+    return FindFiles(directory + "\\*", paths);
+}
+
+#else
+
+bool IsDirectory(const std::string &path)
+{
+    struct stat status;
+    return stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+}
+
+bool FindFiles(const std::string &pattern, std::vector<std::string> &paths)
+{
+    glob_t matches;
+    const auto result = glob(pattern.c_str(), 0, nullptr, &matches);
+    if (result == 0) {
+        for (size_t i = 0; i < matches.gl_pathc; ++i) {
+            if (!IsDirectory(matches.gl_pathv[i])) {
+                paths.push_back(matches.gl_pathv[i]);
+            }
+        }
+    }
+    globfree(&matches);
+    return result == 0 || result == GLOB_NOMATCH;
+}
+
+bool ListDirectory(const std::string &directory, std::vector<std::string> &paths)
+{
+    const auto stream = opendir(directory.c_str());
+    if (!stream) {
+        return false;
+    }
+    while (const auto entry = readdir(stream)) {
+        const auto path = directory + "/" + entry->d_name;
+        if (entry->d_name[0] != '.' && !IsDirectory(path)) {
+            paths.push_back(path);
+        }
+    }
+    closedir(stream);
+    return true;
+}
+
+#endif
+
+bool ExpandInput(const std::string &input, std::vector<std::string> &paths)
+{
+    if (!input.empty() && input[0] == '@') {
+        std::ifstream manifest(input.substr(1));
+        if (!manifest) {
+            GOOGLE_LOG(ERROR) << "Could not read the manifest: " << input.substr(1);
+            return false;
+        }
+        for (std::string line; std::getline(manifest, line);) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            if (!line.empty() && line[0] != '#' && !ExpandInput(line, paths)) {
+                return false;
+            }
+        }
+        return true;
+    }
+    std::vector<std::string> found;
+    if (HasWildcards(input)) {
+        if (!FindFiles(input, found) || found.empty()) {
+            GOOGLE_LOG(ERROR) << "No file matches the pattern: " << input;
+            return false;
+        }
+    } else if (IsDirectory(input)) {
+        if (!ListDirectory(input, found)) {
+            GOOGLE_LOG(ERROR) << "Could not list the directory: " << input;
+            return false;
+        }
+    } else {
+        found.push_back(input);
+    }
+    std::sort(found.begin(), found.end());
+    paths.insert(paths.end(), found.begin(), found.end());
+    return true;
+}
+
+} // namespace
+
+bool expand_inputs(const std::vector<std::string> &inputs, std::vector<std::string> &paths)
+{
+    for (const auto &input : inputs) {
+        if (!ExpandInput(input, paths)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<BatchFile> get_batch_files(const std::vector<std::string> &paths,
+                                       const std::string &outputDirectory,
+                                       const std::string &extension)
+{
+    std::vector<BatchFile> files(paths.size());
+    std::set<std::string> outputs;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        const auto separator = paths[i].find_last_of("/\\");
+        auto name = separator == std::string::npos ? paths[i] : paths[i].substr(separator + 1);
+        name = name.substr(0, name.find_last_of('.'));
+        files[i].inputPath = paths[i];
+        files[i].outputPath = outputDirectory + "/" + name + extension;
+        if (!outputs.insert(files[i].outputPath).second) {
+            GOOGLE_LOG(ERROR) << "Another input is already converted to " << files[i].outputPath << ": " << paths[i];
+            files[i].result = -1;
+        }
+    }
+    return files;
+}
+
+void convert_batch(const google::protobuf::Message &prototype,
+                   const Conversion &conversion,
+                   unsigned jobCount,
+                   std::vector<BatchFile> &files)
+{
+    // as with the generation of units, each worker takes the next file until none is left, so that the workers done
+    // with small files take over the rest of the queue from one busy with a large file; the message of each worker is
+    // kept across its files, so that its repeated fields and strings reuse their capacity
+    std::atomic<size_t> next(0);
+    const auto work = [&]() {
+        std::unique_ptr<google::protobuf::Message> message(prototype.New());
+        for (auto i = next++; i < files.size(); i = next++) {
+            auto &file = files[i];
+            if (file.result != 0) {
+                continue;
+            }
+            try {
+                message->Clear();
+                file.result = conversion(*message, file.inputPath.c_str(), file.outputPath.c_str());
+            } catch (std::exception &e) {
+                GOOGLE_LOG(ERROR) << e.what() << ": " << file.inputPath;
+                file.result = -1;
+            }
+        }
+    };
+    const auto count = std::min<size_t>(std::max(jobCount, 1u), files.size());
+    std::vector<std::thread> workers;
+    for (size_t k = 1; k < count; ++k) {
+        workers.emplace_back(work);
+    }
+    work();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
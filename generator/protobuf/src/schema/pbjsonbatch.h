@@ -0,0 +1,36 @@
+#ifndef PBJSONBATCH_H
+#define PBJSONBATCH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <google/protobuf/message.h>
+
+struct BatchFile
+{
+    std::string inputPath;
+    std::string outputPath;
+    int result = 0;
+};
+
+// one of the conversions of pbjson.h, with the input path first
+using Conversion = std::function<int(google::protobuf::Message &, const char *, const char *)>;
+
+// lists the files given by each input, which is a file, a directory whose files are taken in name order, a wildcard
+// pattern, or @ followed by a manifest that holds one such input per line; returns false once the cause is logged
+bool expand_inputs(const std::vector<std::string> &inputs, std::vector<std::string> &paths);
+
+// pairs each input file with an output of the same name and the given extension in the output directory, and marks
+// the files whose output another one already takes
+std::vector<BatchFile> get_batch_files(const std::vector<std::string> &paths,
+                                       const std::string &outputDirectory,
+                                       const std::string &extension);
+
+// converts the files on up to jobCount threads, each with its own message, and stores the result of each conversion
+void convert_batch(const google::protobuf::Message &prototype,
+                   const Conversion &conversion,
+                   unsigned jobCount,
+                   std::vector<BatchFile> &files);
+
+#endif // PBJSONBATCH_H
@@ -10,8 +10,10 @@ type
 
   TRttiVisitor = record
     private
-      FObserver: IRttiObserver;
-      FContext : TRttiContext;
+      FObserver    : IRttiObserver;
+      FContext     : TRttiContext;
+      FEnumTypeInfo: Pointer;        // the enum whose names were looked up last
+      FEnumNames   : TArray<string>; // and its registered names, or none to fall back to RTTI
 
       procedure VisitType(AInstance: Pointer; AType: TRttiType; ACount: Integer = 1; AIsArray: Boolean = False);
       procedure Visit(AInstance: Pointer; AType: TRttiRecordType); overload;
@@ -27,7 +29,8 @@ type
       procedure Visit(AInstance: Pointer; AType: TRttiDynamicArrayType); overload;
       procedure Visit(AInstance: Pointer; AType: TRttiOrdinalType; ACount: Integer; AEnumTypeInfo: Pointer); overload;
 
-      class function GetEnumName(AType: TRttiOrdinalType; AEnumTypeInfo: Pointer; Value: Integer): string; static;
+      class function GetEnumName(AType: TRttiOrdinalType; AEnumTypeInfo: Pointer; const ANames: TArray<string>;
+        Value: Integer): string; static;
 
     public
       procedure Initialize(AObserver: IRttiObserver);
@@ -39,6 +42,7 @@ implementation
 
 uses
   Delphi.Profile,
+  Delphi.Serial,
   System.TypInfo;
 
 {$POINTERMATH ON}
@@ -48,8 +52,10 @@ uses
 procedure TRttiVisitor.Initialize(AObserver: IRttiObserver);
 begin
   Trace('TRttiVisitor.Initialize');
-  FObserver := AObserver;
-  FContext  := TRttiContext.Create;
+  FObserver     := AObserver;
+  FContext      := TRttiContext.Create;
+  FEnumTypeInfo := nil;
+  FEnumNames    := nil;
 end;
 
 procedure TRttiVisitor.Visit<T>(var AValue: T);
@@ -249,28 +255,38 @@ var
   I: Integer;
 begin
   Trace('TRttiVisitor.Visit: TRttiOrdinalType + AEnumTypeInfo');
+  // the names are looked up again only when the enum changes, as the values of an array or of a record often share it
+  if AEnumTypeInfo <> FEnumTypeInfo then
+    begin
+      if not EnumRegistry.TryGetNames(AEnumTypeInfo, FEnumNames) then
+        FEnumNames := nil; // fall back to RTTI for enums without generated name tables
+      FEnumTypeInfo := AEnumTypeInfo;
+    end;
   case AType.OrdType of
     otSByte, otUByte:
       for I := 0 to ACount - 1 do
-        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, PByte(AInstance)[I]));
+        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, FEnumNames, PByte(AInstance)[I]));
     otSWord, otUWord:
       for I := 0 to ACount - 1 do
-        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, PWord(AInstance)[I]));
+        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, FEnumNames, PWord(AInstance)[I]));
     otSLong, otULong:
       for I := 0 to ACount - 1 do
-        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, PInteger(AInstance)[I]));
+        FObserver.EnumName(GetEnumName(AType, AEnumTypeInfo, FEnumNames, PInteger(AInstance)[I]));
   end;
 end;
 
-class function TRttiVisitor.GetEnumName(AType: TRttiOrdinalType; AEnumTypeInfo: Pointer; Value: Integer): string;
+class function TRttiVisitor.GetEnumName(AType: TRttiOrdinalType; AEnumTypeInfo: Pointer; const ANames: TArray<string>;
+  Value: Integer): string;
 const
   CUnknownName = '[Unknown]';
 begin
   Trace('TRttiVisitor.GetEnumName');
-  if (Value >= AType.MinValue) and (Value <= AType.MaxValue) then
-    Result := System.TypInfo.GetEnumName(AEnumTypeInfo, Value)
+  if (Value < AType.MinValue) or (Value > AType.MaxValue) then
+    Result := CUnknownName
+  else if (Value >= 0) and (Value < Length(ANames)) and (ANames[Value] <> '') then
+    Result := ANames[Value]
   else
-    Result := CUnknownName;
+    Result := System.TypInfo.GetEnumName(AEnumTypeInfo, Value); // including the values the enum does not declare
 end;
 
 procedure TRttiVisitor.Visit(AInstance: Pointer; AType: TRttiArrayType);
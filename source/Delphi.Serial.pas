@@ -4,6 +4,7 @@ interface
 
 uses
   System.SysUtils,
+  System.Generics.Collections,
   Delphi.Serial.Interfaces,
   Delphi.Serial.RttiVisitor;
 
@@ -57,6 +58,47 @@ type
       property Value: Variant read FValue;
   end;
 
+  NamedValue = record
+    FValue: Int32;
+    FName : string;
+  end;
+
+  // lookups into the minimal perfect hash tables emitted by protoc-gen-delphi: the seed found in the bucket of a name
+  // selects its slot, either directly if negative or by hashing the name once more
+  PerfectHash = record
+    class function Hash(const AName: string; ASeed: UInt32): UInt32; static;
+    class function Reduce(AHash, ACount: UInt32): UInt32; static; inline;
+    class function TryGetValue(const ASeeds: array of Int32; const AEntries: array of NamedValue;
+      const AName: string; out AValue: Int32): Boolean; static;
+  end;
+
+  // the enum names registered by the generated units, indexed by value and empty for the values the enum does not
+  // declare, which spare the serializers the RTTI lookups
+  EnumRegistry = record
+    private
+      class var FTables: TDictionary<Pointer, TArray<string>>;
+
+    public
+      class procedure Register(ATypeInfo: Pointer; const ANames: array of string); static;
+      class function TryGetNames(ATypeInfo: Pointer; out ANames: TArray<string>): Boolean; static;
+  end;
+
+  // lookups into the value tables emitted for sparse enums, which are sorted either by value or by name
+  SparseEnum = record
+    class function TryGetName(const AEntries: array of NamedValue; AValue: Int32;
+      out AName: string): Boolean; static;
+    class function TryGetValue(const AEntries: array of NamedValue; const AName: string;
+      out AValue: Int32): Boolean; static;
+  end;
+
+  // the hashes of the keys of the map records emitted by protoc-gen-delphi, which find their entries by linear probing
+  // in a power of two of slots, at most half of them in use
+  MapHash = record
+    class function Hash(const AKey: string): UInt32; overload; static; inline;
+    class function Hash(AKey: UInt64): UInt32; overload; static; inline;
+    class function SlotCount(AEntryCount: Integer): Integer; static;
+  end;
+
   TVisitor    = TRttiVisitor;
   ISerializer = Delphi.Serial.Interfaces.ISerializer;
 
@@ -108,9 +150,150 @@ begin
   FValue := AValue;
 end;
 
+{ PerfectHash }
+
+{$OVERFLOWCHECKS OFF}
+{$RANGECHECKS OFF}
+
+class function PerfectHash.Hash(const AName: string; ASeed: UInt32): UInt32;
+const
+  CFnvOffsetBasis = UInt32($811C9DC5);
+  CFnvPrime       = UInt32($01000193);
+var
+  I: Integer;
+begin
+  Result := CFnvOffsetBasis xor ASeed; // FNV-1a over the characters, which are ASCII in the generated tables
+  for I := 1 to Length(AName) do
+    Result := (Result xor Ord(AName[I])) * CFnvPrime;
+end;
+
+class function PerfectHash.Reduce(AHash, ACount: UInt32): UInt32;
+begin
+  Result := (UInt64(AHash) * ACount) shr 32; // the high bits, as the low bits of the hash barely depend on the seed
+end;
+
+class function PerfectHash.TryGetValue(const ASeeds: array of Int32; const AEntries: array of NamedValue;
+  const AName: string; out AValue: Int32): Boolean;
+var
+  Count: UInt32;
+  Seed : Int32;
+  Slot : UInt32;
+begin
+  Count := Length(ASeeds);
+  if Count = 0 then
+    Exit(False);
+  Seed := ASeeds[Reduce(Hash(AName, 0), Count)];
+  if Seed < 0 then
+    Slot := - Seed - 1
+  else
+    Slot := Reduce(Hash(AName, Seed), Count);
+  Result := AEntries[Slot].FName = AName;
+  if Result then
+    AValue := AEntries[Slot].FValue;
+end;
+
+{ EnumRegistry }
+
+class procedure EnumRegistry.Register(ATypeInfo: Pointer; const ANames: array of string);
+var
+  Names: TArray<string>;
+  I    : Integer;
+begin
+  SetLength(Names, Length(ANames));
+  for I := 0 to High(ANames) do
+    Names[I] := ANames[I];
+  FTables.AddOrSetValue(ATypeInfo, Names);
+end;
+
+class function EnumRegistry.TryGetNames(ATypeInfo: Pointer; out ANames: TArray<string>): Boolean;
+begin
+  Result := FTables.TryGetValue(ATypeInfo, ANames);
+end;
+
+{ SparseEnum }
+
+class function SparseEnum.TryGetName(const AEntries: array of NamedValue; AValue: Int32;
+  out AName: string): Boolean;
+var
+  First : Integer;
+  Last  : Integer;
+  Middle: Integer;
+begin
+  First := 0;
+  Last  := Length(AEntries) - 1;
+  while First <= Last do
+    begin
+      Middle := (First + Last) shr 1;
+      if AEntries[Middle].FValue < AValue then
+        First := Middle + 1
+      else if AEntries[Middle].FValue > AValue then
+        Last := Middle - 1
+      else
+        begin
+          AName := AEntries[Middle].FName;
+          Exit(True);
+        end;
+    end;
+  Result := False;
+end;
+
+class function SparseEnum.TryGetValue(const AEntries: array of NamedValue; const AName: string;
+  out AValue: Int32): Boolean;
+var
+  First     : Integer;
+  Last      : Integer;
+  Middle    : Integer;
+  Comparison: Integer;
+begin
+  First := 0;
+  Last  := Length(AEntries) - 1;
+  while First <= Last do
+    begin
+      Middle     := (First + Last) shr 1;
+      Comparison := CompareStr(AEntries[Middle].FName, AName);
+      if Comparison < 0 then
+        First := Middle + 1
+      else if Comparison > 0 then
+        Last := Middle - 1
+      else
+        begin
+          AValue := AEntries[Middle].FValue;
+          Exit(True);
+        end;
+    end;
+  Result := False;
+end;
+
+{ MapHash }
+
+class function MapHash.Hash(const AKey: string): UInt32;
+begin
+  Result := PerfectHash.Hash(AKey, 0);
+end;
+
+class function MapHash.Hash(AKey: UInt64): UInt32;
+begin
+  Result := (AKey * UInt64($9E3779B97F4A7C15)) shr 32; // Fibonacci hashing, which spreads consecutive keys apart
+end;
+
+class function MapHash.SlotCount(AEntryCount: Integer): Integer;
+begin
+  Result := 8;
+  while Result < 2 * AEntryCount do
+    Result := 2 * Result;
+end;
+
 function CreateSerializer(const AName: string): ISerializer;
 begin
   Result := TFactory.Instance.CreateSerializer(AName);
 end;
 
+initialization
+
+EnumRegistry.FTables := TDictionary<Pointer, TArray<string>>.Create;
+
+finalization
+
+EnumRegistry.FTables.Free;
+
 end.
@@ -10,20 +10,39 @@ uses
 type
 
   TReader = class
+    private const
+      CInitialScopeCount = 16; // start with this number of nested length-prefixed scopes
+
     private
-      FStream: TCustomMemoryStream;
+      FStream    : TCustomMemoryStream;
+      FScopes    : TArray<Int64>; // end position of each nested length-prefixed scope
+      FScopeCount: Integer;
+      FFieldStart: Int64;    // position of the tag of the last field parsed
+      FFieldTag  : FieldTag; // and its number, which ends the group it starts
+
+      function Limit: Int64; inline;
+      function CheckLength(ALength: UInt32): Integer;
+      procedure SkipGroup(AFieldTag: FieldTag);
 
     public
       constructor Create(AStream: TCustomMemoryStream);
 
       function Skip(ACount: Integer): Int64; inline;
       function Read(var AValue; AByteCount: Integer): Integer; inline;
+      function AtEnd: Boolean; inline;
+      procedure SkipField(AWireType: TWireType); overload;
+      procedure SkipField(AWireType: TWireType; var AUnknown: Bytes); overload;
 
       procedure Parse(var AValue: VarInt); overload; inline;
       procedure Parse(var AValue: SignedInt); overload; inline;
       procedure Parse(var AValue: FixedInt32); overload; inline;
       procedure Parse(var AValue: FixedInt64); overload; inline;
       procedure Parse(var AWireType: TWireType; var AFieldTag: FieldTag); overload; inline;
+      procedure Parse(var AValue: string); overload;
+      procedure Parse(var AValue: Bytes); overload;
+
+      procedure BeginLengthPrefixed;
+      procedure EndLengthPrefixed;
   end;
 
 implementation
@@ -36,6 +55,88 @@ uses
 constructor TReader.Create(AStream: TCustomMemoryStream);
 begin
   FStream := AStream;
+  SetLength(FScopes, CInitialScopeCount);
+end;
+
+function TReader.Limit: Int64;
+begin
+  if FScopeCount > 0 then
+    Result := FScopes[FScopeCount - 1]
+  else
+    Result := FStream.Size;
+end;
+
+function TReader.CheckLength(ALength: UInt32): Integer;
+begin
+  // a length read from the data must not reach past the innermost scope, let alone past the data itself
+  if FStream.Position + ALength > Limit then
+    raise ESerialError.Create('Length prefix exceeds the enclosing data');
+  Result := ALength;
+end;
+
+function TReader.AtEnd: Boolean;
+begin
+  Result := FStream.Position >= Limit;
+end;
+
+procedure TReader.SkipField(AWireType: TWireType);
+var
+  Source: VarInt;
+begin
+  case AWireType of
+    TWireType.VarInt:
+      Parse(Source);
+    TWireType.Fixed64:
+      Skip(CheckLength(SizeOf(UInt64)));
+    TWireType.LengthPrefixed:
+      begin
+        Parse(Source);
+        Skip(CheckLength(UInt32(Source)));
+      end;
+    TWireType.StartGroup:
+      SkipGroup(FFieldTag);
+    TWireType.Fixed32:
+      Skip(CheckLength(SizeOf(UInt32)));
+  else
+    raise ESerialError.CreateFmt('Unsupported wire type: %d', [Ord(AWireType)]);
+  end;
+end;
+
+procedure TReader.SkipGroup(AFieldTag: FieldTag);
+var
+  Source  : VarInt;
+  WireType: TWireType;
+begin
+  // a group is skipped up to the end tag with its number, along with the groups it contains
+  while not AtEnd do
+    begin
+      Parse(Source);
+      WireType := TWireType(UInt32(Source) and 7);
+      if WireType = TWireType.EndGroup then
+        begin
+          if UInt32(Source) shr 3 <> AFieldTag then
+            raise ESerialError.Create('Group ends with the tag of another field');
+          Exit;
+        end;
+      if WireType = TWireType.StartGroup then
+        SkipGroup(UInt32(Source) shr 3)
+      else
+        SkipField(WireType);
+    end;
+  raise ESerialError.Create('Group exceeds the enclosing data');
+end;
+
+procedure TReader.SkipField(AWireType: TWireType; var AUnknown: Bytes);
+var
+  Count: Integer;
+begin
+  SkipField(AWireType);
+  if FStream.Position > FStream.Size then
+    raise ESerialError.Create('Unknown field exceeds the data');
+  // the tag and the value are appended as they were read, so that they are encoded back with a single copy
+  Count := FStream.Position - FFieldStart;
+  SetLength(AUnknown, Length(AUnknown) + Count);
+  System.Move((PByte(FStream.Memory) + FFieldStart)^, AUnknown[Length(AUnknown) - Count], Count);
 end;
 
 function TReader.Skip(ACount: Integer): Int64;
@@ -74,9 +175,56 @@ procedure TReader.Parse(var AWireType: TWireType; var AFieldTag: FieldTag);
 var
   Source: VarInt;
 begin
+  FFieldStart := FStream.Position;
   Parse(Source);
   AWireType := TWireType(UInt32(Source) and 7);
   AFieldTag := UInt32(Source) shr 3;
+  FFieldTag := AFieldTag;
+end;
+
+procedure TReader.Parse(var AValue: string);
+var
+  Source   : VarInt;
+  ByteCount: Integer;
+  ByteStart: PAnsiChar;
+begin
+  Parse(Source);
+  ByteCount := CheckLength(UInt32(Source));
+  ByteStart := PAnsiChar(FStream.Memory) + FStream.Position;
+  SetLength(AValue, UnicodeFromLocaleChars(CP_UTF8, 0, ByteStart, ByteCount, nil, 0));
+  if ByteCount > 0 then
+    UnicodeFromLocaleChars(CP_UTF8, 0, ByteStart, ByteCount, PChar(AValue), Length(AValue));
+  Skip(ByteCount);
+end;
+
+procedure TReader.Parse(var AValue: Bytes);
+var
+  Source: VarInt;
+begin
+  Parse(Source);
+  SetLength(AValue, CheckLength(UInt32(Source)));
+  if Length(AValue) > 0 then
+    read(AValue[0], Length(AValue));
+end;
+
+procedure TReader.BeginLengthPrefixed;
+var
+  Source: VarInt;
+  EndPos: Int64;
+begin
+  Parse(Source);
+  EndPos := FStream.Position + CheckLength(UInt32(Source));
+  if FScopeCount = Length(FScopes) then
+    SetLength(FScopes, 2 * FScopeCount);
+  FScopes[FScopeCount] := EndPos;
+  Inc(FScopeCount);
+end;
+
+procedure TReader.EndLengthPrefixed;
+begin
+  Assert(FScopeCount > 0);
+  Dec(FScopeCount);
+  FStream.Position := FScopes[FScopeCount]; // skip whatever was left unread in the scope
 end;
 
 end.
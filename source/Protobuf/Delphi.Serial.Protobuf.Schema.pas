@@ -0,0 +1,347 @@
+unit Delphi.Serial.Protobuf.Schema;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.View,
+  System.Generics.Collections;
+
+type
+
+  // the declared type of a field, with the ordinals of FieldDescriptorProto.Type
+  TSchemaType = (None, Double, Float, Int64, UInt64, Int32, Fixed64, Fixed32, Bool, &String, Group, Message, Bytes,
+    UInt32, Enum, SFixed32, SFixed64, SInt32, SInt64);
+
+  // a field as declared in the schema, which refers to the message or enum it holds by its full name
+  FieldSchema = record
+    FName      : string;
+    FJsonName  : string;
+    FNumber    : FieldTag;
+    FType      : TSchemaType;
+    FTypeName  : string;
+    FRepeated  : Boolean;
+    FRequired  : Boolean;
+    FPacked    : Boolean;
+    FOneofIndex: Integer; // the index of the containing oneof in the message, or -1
+  end;
+
+  PFieldSchema = ^FieldSchema;
+
+  // a message as declared in the schema, whose fields are looked up in constant time by number or by name
+  TMessageSchema = class
+    private
+      FFullName: string;
+      FFields  : TArray<FieldSchema>;
+      FOneofs  : TArray<string>;
+      FNumbers : TDictionary<Integer, Integer>; // index of the field with each number
+      FNames   : TDictionary<string, Integer>;  // index of the field with each name or JSON name
+
+    public
+      constructor Create(const AFullName: string; const AFields: TArray<FieldSchema>; const AOneofs: TArray<string>);
+      destructor Destroy; override;
+
+      property FullName: string read FFullName;
+      property Fields: TArray<FieldSchema> read FFields;
+      property Oneofs: TArray<string> read FOneofs;
+
+      function FindField(ANumber: Integer): PFieldSchema; overload;
+      function FindField(const AName: string): PFieldSchema; overload;
+  end;
+
+  // an enum as declared in the schema, whose values are looked up in constant time by number or by name
+  TEnumSchema = class
+    private
+      FFullName: string;
+      FValues  : TArray<NamedValue>;
+      FNumbers : TDictionary<Int32, string>; // the first name of each value
+      FNames   : TDictionary<string, Int32>;
+
+    public
+      constructor Create(const AFullName: string; const AValues: TArray<NamedValue>);
+      destructor Destroy; override;
+
+      property FullName: string read FFullName;
+      property Values: TArray<NamedValue> read FValues;
+
+      function TryGetName(AValue: Int32; out AName: string): Boolean;
+      function TryGetValue(const AName: string; out AValue: Int32): Boolean;
+  end;
+
+  // the schemas embedded by the generated units, which describe their messages and enums without RTTI: each schema is
+  // an encoded FileDescriptorSet, and a file embedded by several units is only read once
+  SchemaRegistry = record
+    private
+      class var FFiles   : TList<string>;
+      class var FMessages: TObjectDictionary<string, TMessageSchema>;
+      class var FEnums   : TObjectDictionary<string, TEnumSchema>;
+
+      class procedure RegisterMessage(const AScope: string; const AMessage: MessageView; AProto3: Boolean); static;
+      class procedure RegisterEnum(const AScope: string; const AEnum: MessageView); static;
+
+    public
+      class procedure Register(const ASchema: array of Byte); static;
+      class function FindMessage(const AFullName: string): TMessageSchema; static;
+      class function FindEnum(const AFullName: string): TEnumSchema; static;
+  end;
+
+implementation
+
+uses
+  System.Math,
+  Delphi.Serial.Protobuf.Types;
+
+const
+  // the field numbers of descriptor.proto
+  CSetFile          = 1;
+  CFileName         = 1;
+  CFilePackage      = 2;
+  CFileMessageType  = 4;
+  CFileEnumType     = 5;
+  CFileSyntax       = 12;
+  CMessageName      = 1;
+  CMessageField     = 2;
+  CMessageNested    = 3;
+  CMessageEnumType  = 4;
+  CMessageOneof     = 8;
+  CFieldName        = 1;
+  CFieldNumber      = 3;
+  CFieldLabel       = 4;
+  CFieldType        = 5;
+  CFieldTypeName    = 6;
+  CFieldOptions     = 8;
+  CFieldOneofIndex  = 9;
+  CFieldJsonName    = 10;
+  CFieldOptional    = 17;
+  COptionsPacked    = 2;
+  COneofName        = 1;
+  CEnumName         = 1;
+  CEnumValue        = 2;
+  CValueName        = 1;
+  CValueNumber      = 2;
+  CLabelRequired    = 2;
+  CLabelRepeated    = 3;
+  CUnpackableTypes  = [TSchemaType.&String, TSchemaType.Group, TSchemaType.Message, TSchemaType.Bytes];
+
+function GetString(const AMessage: MessageView; ATag: FieldTag): string;
+begin
+  Result := AMessage.Find(ATag, TWireType.LengthPrefixed).AsSlice.ToString;
+end;
+
+function GetNumber(const AMessage: MessageView; ATag: FieldTag): Int32;
+begin
+  Result := AMessage.Find(ATag, TWireType.VarInt).AsInt32;
+end;
+
+function GetFullName(const AScope, AName: string): string;
+begin
+  if AScope = '' then
+    Result := AName
+  else
+    Result := AScope + '.' + AName;
+end;
+
+{ TMessageSchema }
+
+constructor TMessageSchema.Create(const AFullName: string; const AFields: TArray<FieldSchema>;
+  const AOneofs: TArray<string>);
+var
+  I: Integer;
+begin
+  FFullName := AFullName;
+  FFields   := AFields;
+  FOneofs   := AOneofs;
+  FNumbers  := TDictionary<Integer, Integer>.Create(Length(FFields));
+  FNames    := TDictionary<string, Integer>.Create(2 * Length(FFields));
+  for I := 0 to High(FFields) do
+    begin
+      FNumbers.AddOrSetValue(FFields[I].FNumber, I);
+      FNames.AddOrSetValue(FFields[I].FJsonName, I);
+    end;
+  for I := 0 to High(FFields) do
+    FNames.AddOrSetValue(FFields[I].FName, I); // the original name wins over a JSON name that matches it
+end;
+
+destructor TMessageSchema.Destroy;
+begin
+  FNames.Free;
+  FNumbers.Free;
+  inherited;
+end;
+
+function TMessageSchema.FindField(ANumber: Integer): PFieldSchema;
+var
+  Index: Integer;
+begin
+  if FNumbers.TryGetValue(ANumber, Index) then
+    Result := @FFields[Index]
+  else
+    Result := nil;
+end;
+
+function TMessageSchema.FindField(const AName: string): PFieldSchema;
+var
+  Index: Integer;
+begin
+  if FNames.TryGetValue(AName, Index) then
+    Result := @FFields[Index]
+  else
+    Result := nil;
+end;
+
+{ TEnumSchema }
+
+constructor TEnumSchema.Create(const AFullName: string; const AValues: TArray<NamedValue>);
+var
+  Value: NamedValue;
+begin
+  FFullName := AFullName;
+  FValues   := AValues;
+  FNumbers  := TDictionary<Int32, string>.Create(Length(FValues));
+  FNames    := TDictionary<string, Int32>.Create(Length(FValues));
+  for Value in FValues do
+    begin
+      if not FNumbers.ContainsKey(Value.FValue) then
+        FNumbers.Add(Value.FValue, Value.FName);
+      FNames.AddOrSetValue(Value.FName, Value.FValue);
+    end;
+end;
+
+destructor TEnumSchema.Destroy;
+begin
+  FNames.Free;
+  FNumbers.Free;
+  inherited;
+end;
+
+function TEnumSchema.TryGetName(AValue: Int32; out AName: string): Boolean;
+begin
+  Result := FNumbers.TryGetValue(AValue, AName);
+end;
+
+function TEnumSchema.TryGetValue(const AName: string; out AValue: Int32): Boolean;
+begin
+  Result := FNames.TryGetValue(AName, AValue);
+end;
+
+{ SchemaRegistry }
+
+class procedure SchemaRegistry.Register(const ASchema: array of Byte);
+var
+  Value   : FieldValue;
+  Item    : FieldValue;
+  FileView: MessageView;
+  Name    : string;
+  Scope   : string;
+  Proto3  : Boolean;
+begin
+  for Value in MessageView.Create(@ASchema[0], Length(ASchema)).Values(CSetFile, TWireType.LengthPrefixed) do
+    begin
+      FileView := MessageView.Create(Value.AsSlice);
+      Name     := GetString(FileView, CFileName);
+      if FFiles.Contains(Name) then
+        Continue;
+      FFiles.Add(Name);
+      Scope  := GetString(FileView, CFilePackage);
+      Proto3 := GetString(FileView, CFileSyntax) = 'proto3';
+      for Item in FileView.Values(CFileMessageType, TWireType.LengthPrefixed) do
+        RegisterMessage(Scope, MessageView.Create(Item.AsSlice), Proto3);
+      for Item in FileView.Values(CFileEnumType, TWireType.LengthPrefixed) do
+        RegisterEnum(Scope, MessageView.Create(Item.AsSlice));
+    end;
+end;
+
+class procedure SchemaRegistry.RegisterMessage(const AScope: string; const AMessage: MessageView; AProto3: Boolean);
+var
+  FullName: string;
+  Fields  : TArray<FieldSchema>;
+  Field   : FieldSchema;
+  Oneofs  : TArray<string>;
+  Count   : Integer;
+  Value   : FieldValue;
+  View    : MessageView;
+begin
+  FullName := GetFullName(AScope, GetString(AMessage, CMessageName));
+  Count    := 0;
+  for Value in AMessage.Values(CMessageField, TWireType.LengthPrefixed) do
+    begin
+      View              := MessageView.Create(Value.AsSlice);
+      Field.FName       := GetString(View, CFieldName);
+      Field.FJsonName   := GetString(View, CFieldJsonName);
+      Field.FNumber     := GetNumber(View, CFieldNumber);
+      Field.FType       := TSchemaType(GetNumber(View, CFieldType));
+      Field.FTypeName   := Copy(GetString(View, CFieldTypeName), 2, MaxInt); // without the leading dot
+      Field.FRepeated   := GetNumber(View, CFieldLabel) = CLabelRepeated;
+      Field.FRequired   := GetNumber(View, CFieldLabel) = CLabelRequired;
+      Field.FOneofIndex := - 1;
+      // a proto3 optional field is alone in a synthetic oneof, which is not a oneof of the message
+      if View.Contains(CFieldOneofIndex, TWireType.VarInt) and not View.Find(CFieldOptional, TWireType.VarInt).AsBoolean
+      then
+        begin
+          Field.FOneofIndex := GetNumber(View, CFieldOneofIndex);
+          Count             := Max(Count, Field.FOneofIndex + 1);
+        end;
+      if View.Contains(CFieldOptions, TWireType.LengthPrefixed) then
+        Field.FPacked := MessageView.Create(View.Find(CFieldOptions, TWireType.LengthPrefixed).AsSlice)
+          .Find(COptionsPacked, TWireType.VarInt).AsBoolean
+      else
+        Field.FPacked := AProto3 and Field.FRepeated and not (Field.FType in CUnpackableTypes);
+      Fields := Fields + [Field];
+    end;
+  // the synthetic oneofs come after the others
+  for Value in AMessage.Values(CMessageOneof, TWireType.LengthPrefixed) do
+    if Length(Oneofs) < Count then
+      Oneofs := Oneofs + [GetString(MessageView.Create(Value.AsSlice), COneofName)];
+  FMessages.AddOrSetValue(FullName, TMessageSchema.Create(FullName, Fields, Oneofs));
+  for Value in AMessage.Values(CMessageNested, TWireType.LengthPrefixed) do
+    RegisterMessage(FullName, MessageView.Create(Value.AsSlice), AProto3);
+  for Value in AMessage.Values(CMessageEnumType, TWireType.LengthPrefixed) do
+    RegisterEnum(FullName, MessageView.Create(Value.AsSlice));
+end;
+
+class procedure SchemaRegistry.RegisterEnum(const AScope: string; const AEnum: MessageView);
+var
+  FullName: string;
+  Values  : TArray<NamedValue>;
+  Item    : NamedValue;
+  Value   : FieldValue;
+  View    : MessageView;
+begin
+  FullName := GetFullName(AScope, GetString(AEnum, CEnumName));
+  for Value in AEnum.Values(CEnumValue, TWireType.LengthPrefixed) do
+    begin
+      View        := MessageView.Create(Value.AsSlice);
+      Item.FName  := GetString(View, CValueName);
+      Item.FValue := GetNumber(View, CValueNumber);
+      Values      := Values + [Item];
+    end;
+  FEnums.AddOrSetValue(FullName, TEnumSchema.Create(FullName, Values));
+end;
+
+class function SchemaRegistry.FindMessage(const AFullName: string): TMessageSchema;
+begin
+  if not FMessages.TryGetValue(AFullName, Result) then
+    Result := nil;
+end;
+
+class function SchemaRegistry.FindEnum(const AFullName: string): TEnumSchema;
+begin
+  if not FEnums.TryGetValue(AFullName, Result) then
+    Result := nil;
+end;
+
+initialization
+
+SchemaRegistry.FFiles    := TList<string>.Create;
+SchemaRegistry.FMessages := TObjectDictionary<string, TMessageSchema>.Create([doOwnsValues]);
+SchemaRegistry.FEnums    := TObjectDictionary<string, TEnumSchema>.Create([doOwnsValues]);
+
+finalization
+
+SchemaRegistry.FEnums.Free;
+SchemaRegistry.FMessages.Free;
+SchemaRegistry.FFiles.Free;
+
+end.
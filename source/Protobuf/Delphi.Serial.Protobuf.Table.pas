@@ -0,0 +1,742 @@
+unit Delphi.Serial.Protobuf.Table;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer;
+
+type
+
+  // the Delphi representation of a field value, which selects how it is packed and parsed
+  TFieldKind = (Double, Float, Int32, Int64, UInt32, UInt64, SInt32, SInt64, Fixed32, Fixed64, SFixed32, SFixed64, Bool,
+    Enum8, Enum16, Enum32, &String, Bytes, Message);
+
+  // a lazy message field is held by a wrapper record that keeps the value first, then the encoding of the value until
+  // it is accessed, then whether it was parsed; a field with presence is only encoded when its bit is set in the
+  // presence bitmap of the record, which is located like the case of a oneof; a boxed message field is held by a
+  // dynamic array of the type given as the array type, which is empty while the message is absent; an overlaid member
+  // of a oneof shares its storage with the other overlaid members, in the variant part of the record of the oneof; the
+  // values of a bounded repeated field are held by the record, with their count located like the case of a oneof and
+  // their capacity given as the case value
+  TFieldFlag  = (Repeated, &Packed, Required, Oneof, Lazy, Presence, Boxed, Overlaid, Bounded);
+  TFieldFlags = set of TFieldFlag;
+
+  PMessageTable = ^MessageTable;
+
+  // a field of a generated record, located by its offset from the start of the record
+  FieldEntry = record
+    FNumber    : FieldTag;
+    FTag       : EncodedTag; // the tag along with the wire type it is packed with
+    FWireType  : TWireType;  // the wire type of a single value
+    FKind      : TFieldKind;
+    FFlags     : TFieldFlags;
+    FOffset    : Integer;
+    FCaseOffset: Integer;    // the case field of the containing oneof, which holds FCaseValue when this field is set
+    FCaseValue : Byte;       // or the presence word, and the index of the bit of this field in it,
+                             // or the count of a bounded field, and its capacity
+    FArrayType : Pointer;    // the type info of the dynamic array holding a repeated field
+    FMessage   : PMessageTable;
+
+    class function Create(ANumber: FieldTag; AKind: TFieldKind; AFlags: TFieldFlags; AField: Pointer;
+      AArrayType: Pointer = nil; AMessage: PMessageTable = nil; ACase: Pointer = nil; ACaseValue: Byte = 0): FieldEntry;
+      static;
+  end;
+
+  // the fields of a generated record, which drive a single encoder and decoder for all messages: fields are given as
+  // if the record was located at address zero, and are packed in the same order and format as the generated codecs
+  MessageTable = record
+    private type
+      PBytes = ^Bytes;
+
+    private const
+      CMaxDirectNumber = 1023; // field numbers up to this one are looked up directly while parsing
+
+    private
+      FFields  : TArray<FieldEntry>;
+      FLookup  : TArray<Integer>; // index of the field with each number, or -1
+      FSize    : Integer;
+      FTypeInfo: Pointer;
+      FUnknown : Integer; // the offset of the bytes of the fields that the record does not declare, or -1
+
+      function FindField(ANumber: FieldTag): Integer; inline;
+      function ComputeSize(AInstance: PByte; const AField: FieldEntry; AWriter: TWriter): Integer; overload;
+      procedure EncodeTo(AInstance: PByte; const AField: FieldEntry; AWriter: TWriter); overload;
+      procedure ParseFrom(AInstance: PByte; const AField: FieldEntry; AWireType: TWireType; AReader: TReader);
+        overload;
+      procedure SkipField(AInstance: PByte; AWireType: TWireType; AReader: TReader); inline;
+      procedure ClearMember(AInstance: PByte; ACaseOffset: Integer);
+
+      class function GetElementSize(const AField: FieldEntry): Integer; static;
+      class function GetElements(AValue: PByte; const AField: FieldEntry; out ACount: Integer): PByte; static;
+      class function Encoded(AValue: PByte; const AField: FieldEntry): PBytes; static; inline;
+      class function IsParsed(AValue: PByte; const AField: FieldEntry): Boolean; static; inline;
+      class function MessageSize(AValue: PByte; const AField: FieldEntry; AWriter: TWriter): Integer; static;
+      class procedure EncodeMessage(AValue: PByte; const AField: FieldEntry; AWriter: TWriter); static;
+      class procedure ParseMessage(AValue: PByte; const AField: FieldEntry; AReader: TReader); static;
+
+      class function IsSelected(AInstance: PByte; const AField: FieldEntry): Boolean; static; inline;
+      class function IsSet(AValue: PByte; AKind: TFieldKind): Boolean; static;
+      class function FixedSize(AKind: TFieldKind): Integer; static; inline;
+      class function ValueSize(AValue: PByte; AKind: TFieldKind): Integer; static;
+      class procedure Pack(AValue: PByte; AKind: TFieldKind; AWriter: TWriter); static;
+      class procedure Parse(AValue: PByte; AKind: TFieldKind; AReader: TReader); static;
+
+    public
+      class function Create(ATypeInfo: Pointer; const AFields: array of FieldEntry; AUnknown: Integer = - 1)
+        : MessageTable; static;
+
+      procedure SerializeTo(AInstance: Pointer; AWriter: TWriter);
+      procedure ParseFrom(AInstance: Pointer; AReader: TReader); overload;
+      function ComputeSize(AInstance: Pointer; AWriter: TWriter): Integer; overload;
+      procedure EncodeTo(AInstance: Pointer; AWriter: TWriter); overload;
+  end;
+
+implementation
+
+uses
+  System.Math,
+  System.TypInfo;
+
+{$POINTERMATH ON}
+
+const
+  CKindWireTypes: array [TFieldKind] of TWireType = (TWireType.Fixed64, TWireType.Fixed32, TWireType.VarInt,
+    TWireType.VarInt, TWireType.VarInt, TWireType.VarInt, TWireType.VarInt, TWireType.VarInt, TWireType.Fixed32,
+    TWireType.Fixed64, TWireType.Fixed32, TWireType.Fixed64, TWireType.VarInt, TWireType.VarInt, TWireType.VarInt,
+    TWireType.VarInt, TWireType.LengthPrefixed, TWireType.LengthPrefixed, TWireType.LengthPrefixed);
+
+  CKindSizes: array [TFieldKind] of Integer = (8, 4, 4, 8, 4, 8, 4, 8, 4, 8, 4, 8, 1, 1, 2, 4, SizeOf(Pointer),
+    SizeOf(Pointer), 0);
+
+{ FieldEntry }
+
+class function FieldEntry.Create(ANumber: FieldTag; AKind: TFieldKind; AFlags: TFieldFlags; AField: Pointer;
+  AArrayType: Pointer; AMessage: PMessageTable; ACase: Pointer; ACaseValue: Byte): FieldEntry;
+var
+  WireType: TWireType;
+  Value   : UInt32;
+  Count   : Integer;
+begin
+  Result.FNumber     := ANumber;
+  Result.FWireType   := CKindWireTypes[AKind];
+  Result.FKind       := AKind;
+  Result.FFlags      := AFlags;
+  Result.FOffset     := NativeInt(AField);
+  Result.FCaseOffset := NativeInt(ACase);
+  Result.FCaseValue  := ACaseValue;
+  Result.FArrayType  := AArrayType;
+  Result.FMessage    := AMessage;
+  if TFieldFlag.&Packed in AFlags then
+    WireType := TWireType.LengthPrefixed
+  else
+    WireType := Result.FWireType;
+  Value              := UInt32(ANumber) shl 3 or Ord(WireType);
+  Result.FTag.FBytes := 0;
+  Count              := 0;
+  repeat
+    Result.FTag.FBytes := Result.FTag.FBytes or UInt64(Value and $7F or Ord(Value > $7F) shl 7) shl (8 * Count);
+    Value              := Value shr 7;
+    Inc(Count);
+  until Value = 0;
+  Result.FTag.FCount := Count;
+end;
+
+{ MessageTable }
+
+class function MessageTable.Create(ATypeInfo: Pointer; const AFields: array of FieldEntry; AUnknown: Integer)
+  : MessageTable;
+var
+  MaxNumber: Integer;
+  I        : Integer;
+begin
+  Result.FSize     := GetTypeData(ATypeInfo)^.RecSize;
+  Result.FTypeInfo := ATypeInfo;
+  Result.FUnknown  := AUnknown;
+  SetLength(Result.FFields, Length(AFields));
+  MaxNumber := 0;
+  for I := 0 to High(AFields) do
+    begin
+      Result.FFields[I] := AFields[I];
+      MaxNumber         := Max(MaxNumber, AFields[I].FNumber);
+    end;
+  SetLength(Result.FLookup, Min(MaxNumber, CMaxDirectNumber) + 1);
+  for I := 0 to High(Result.FLookup) do
+    Result.FLookup[I] := - 1;
+  for I := 0 to High(AFields) do
+    if AFields[I].FNumber <= CMaxDirectNumber then
+      Result.FLookup[AFields[I].FNumber] := I;
+end;
+
+function MessageTable.FindField(ANumber: FieldTag): Integer;
+var
+  I: Integer;
+begin
+  if ANumber <= High(FLookup) then
+    Exit(FLookup[ANumber]);
+  for I := 0 to High(FFields) do
+    if FFields[I].FNumber = ANumber then
+      Exit(I);
+  Result := - 1;
+end;
+
+procedure MessageTable.SerializeTo(AInstance: Pointer; AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AInstance, AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AInstance, AWriter);
+  AWriter.Truncate;
+end;
+
+function MessageTable.ComputeSize(AInstance: Pointer; AWriter: TWriter): Integer;
+var
+  I: Integer;
+begin
+  Result := 0;
+  for I := 0 to High(FFields) do
+    if IsSelected(AInstance, FFields[I]) then
+      Inc(Result, ComputeSize(PByte(AInstance) + FFields[I].FOffset, FFields[I], AWriter));
+  if FUnknown >= 0 then
+    Inc(Result, Length(PBytes(PByte(AInstance) + FUnknown)^));
+end;
+
+function MessageTable.ComputeSize(AInstance: PByte; const AField: FieldEntry; AWriter: TWriter): Integer;
+var
+  Elements   : PByte;
+  Count      : Integer;
+  ElementSize: Integer;
+  Slot       : Integer;
+  Size       : Integer;
+  I          : Integer;
+begin
+  Result := 0;
+  if TFieldFlag.Repeated in AField.FFlags then
+    begin
+      Elements := GetElements(AInstance, AField, Count);
+      if Count = 0 then
+        Exit;
+      ElementSize := GetElementSize(AField);
+      if TFieldFlag.&Packed in AField.FFlags then
+        begin
+          Size := Count * FixedSize(AField.FKind);
+          if Size = 0 then
+            begin
+              // keep the payload size of varint arrays, so that the encoder does not have to compute it again
+              for I := 0 to Count - 1 do
+                Inc(Size, ValueSize(Elements + I * ElementSize, AField.FKind));
+              AWriter.StoreSize(Size);
+            end;
+          Exit(AField.FTag.FCount + VarInt.ByteCount(Size) + Size);
+        end;
+      for I := 0 to Count - 1 do
+        case AField.FKind of
+          TFieldKind.Message:
+            begin
+              Slot := AWriter.ReserveSize;
+              Size := AWriter.StoreSize(Slot, MessageSize(Elements + I * ElementSize, AField, AWriter));
+              Inc(Result, AField.FTag.FCount + VarInt.ByteCount(Size) + Size);
+            end;
+          TFieldKind.&String:
+            begin
+              Size := AWriter.StoreSize(TWriter.ByteCount(PString(Elements)[I]));
+              Inc(Result, AField.FTag.FCount + VarInt.ByteCount(Size) + Size);
+            end;
+          TFieldKind.Bytes:
+            begin
+              Size := Length(PBytes(Elements)[I]);
+              Inc(Result, AField.FTag.FCount + VarInt.ByteCount(Size) + Size);
+            end;
+        else
+          Inc(Result, AField.FTag.FCount + ValueSize(Elements + I * ElementSize, AField.FKind));
+        end;
+      Exit;
+    end;
+
+  if AField.FKind = TFieldKind.Message then
+    begin
+      // the slot is kept even for an empty sub-message, so that the encoder can find out it must be omitted
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, MessageSize(AInstance, AField, AWriter));
+      if (Size > 0) or (AField.FFlags * [TFieldFlag.Required, TFieldFlag.Oneof, TFieldFlag.Boxed] <> []) then
+        Result := AField.FTag.FCount + VarInt.ByteCount(Size) + Size
+      else
+        AWriter.ReleaseSizes(Slot);
+      Exit;
+    end;
+  if (AField.FFlags * [TFieldFlag.Required, TFieldFlag.Oneof, TFieldFlag.Presence] = []) and
+    not IsSet(AInstance, AField.FKind) then
+    Exit;
+  case AField.FKind of
+    TFieldKind.&String:
+      begin
+        Size   := AWriter.StoreSize(TWriter.ByteCount(PString(AInstance)^));
+        Result := AField.FTag.FCount + VarInt.ByteCount(Size) + Size;
+      end;
+    TFieldKind.Bytes:
+      begin
+        Size   := Length(PBytes(AInstance)^);
+        Result := AField.FTag.FCount + VarInt.ByteCount(Size) + Size;
+      end;
+  else
+    Result := AField.FTag.FCount + ValueSize(AInstance, AField.FKind);
+  end;
+end;
+
+procedure MessageTable.EncodeTo(AInstance: Pointer; AWriter: TWriter);
+var
+  I: Integer;
+begin
+  for I := 0 to High(FFields) do
+    if IsSelected(AInstance, FFields[I]) then
+      EncodeTo(PByte(AInstance) + FFields[I].FOffset, FFields[I], AWriter);
+  if FUnknown >= 0 then
+    AWriter.Splice(PBytes(PByte(AInstance) + FUnknown)^);
+end;
+
+procedure MessageTable.EncodeTo(AInstance: PByte; const AField: FieldEntry; AWriter: TWriter);
+var
+  Elements   : PByte;
+  Count      : Integer;
+  ElementSize: Integer;
+  Size       : Integer;
+  I          : Integer;
+begin
+  if TFieldFlag.Repeated in AField.FFlags then
+    begin
+      Elements := GetElements(AInstance, AField, Count);
+      if Count = 0 then
+        Exit;
+      ElementSize := GetElementSize(AField);
+      if TFieldFlag.&Packed in AField.FFlags then
+        begin
+          Size := Count * FixedSize(AField.FKind);
+          if Size = 0 then
+            Size := AWriter.NextSize;
+          AWriter.Pack(AField.FTag);
+          AWriter.Pack(VarInt(Size));
+          for I := 0 to Count - 1 do
+            Pack(Elements + I * ElementSize, AField.FKind, AWriter);
+          Exit;
+        end;
+      for I := 0 to Count - 1 do
+        begin
+          AWriter.Pack(AField.FTag);
+          case AField.FKind of
+            TFieldKind.Message:
+              begin
+                AWriter.Pack(VarInt(AWriter.NextSize));
+                EncodeMessage(Elements + I * ElementSize, AField, AWriter);
+              end;
+            TFieldKind.&String:
+              AWriter.Pack(PString(Elements)[I], AWriter.NextSize);
+          else
+            Pack(Elements + I * ElementSize, AField.FKind, AWriter);
+          end;
+        end;
+      Exit;
+    end;
+
+  if AField.FKind = TFieldKind.Message then
+    begin
+      // empty sub-messages are omitted from the output unless they are known to be present
+      Size := AWriter.NextSize;
+      if (Size > 0) or (AField.FFlags * [TFieldFlag.Required, TFieldFlag.Oneof, TFieldFlag.Boxed] <> []) then
+        begin
+          AWriter.Pack(AField.FTag);
+          AWriter.Pack(VarInt(Size));
+          EncodeMessage(AInstance, AField, AWriter);
+        end;
+      Exit;
+    end;
+  if (AField.FFlags * [TFieldFlag.Required, TFieldFlag.Oneof, TFieldFlag.Presence] = []) and
+    not IsSet(AInstance, AField.FKind) then
+    Exit;
+  AWriter.Pack(AField.FTag);
+  if AField.FKind = TFieldKind.&String then
+    AWriter.Pack(PString(AInstance)^, AWriter.NextSize)
+  else
+    Pack(AInstance, AField.FKind, AWriter);
+end;
+
+procedure MessageTable.ParseFrom(AInstance: Pointer; AReader: TReader);
+var
+  WireType: TWireType;
+  Tag     : FieldTag;
+  Index   : Integer;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      Index := FindField(Tag);
+      if Index < 0 then
+        SkipField(AInstance, WireType, AReader)
+      else
+        with FFields[Index] do
+          // only repeated fields take the packed encoding of their values, as the generated decoders have it
+          if (WireType = FWireType) or ((WireType = TWireType.LengthPrefixed) and (TFieldFlag.Repeated in FFlags)) then
+            begin
+              if TFieldFlag.Oneof in FFlags then
+                begin
+                  // a message is merged into an overlaid member only if it held the previous one
+                  if PByte(AInstance)[FCaseOffset] <> FCaseValue then
+                    begin
+                      ClearMember(AInstance, FCaseOffset);
+                      if (TFieldFlag.Overlaid in FFlags) and (FKind = TFieldKind.Message) then
+                        FillChar(PByte(AInstance)[FOffset], FMessage.FSize, 0);
+                    end;
+                  PByte(AInstance)[FCaseOffset] := FCaseValue;
+                end
+              else if TFieldFlag.Presence in FFlags then
+                PUInt32(PByte(AInstance) + FCaseOffset)^ := PUInt32(PByte(AInstance) + FCaseOffset)^ or
+                  UInt32(1) shl FCaseValue;
+              ParseFrom(PByte(AInstance) + FOffset, FFields[Index], WireType, AReader);
+            end
+          else
+            SkipField(AInstance, WireType, AReader);
+    end;
+end;
+
+procedure MessageTable.SkipField(AInstance: PByte; AWireType: TWireType; AReader: TReader);
+begin
+  if FUnknown >= 0 then
+    AReader.SkipField(AWireType, PBytes(AInstance + FUnknown)^)
+  else
+    AReader.SkipField(AWireType);
+end;
+
+procedure MessageTable.ClearMember(AInstance: PByte; ACaseOffset: Integer);
+var
+  I    : Integer;
+  Value: PByte;
+begin
+  // the member selected before is released when it has storage of its own, so that a message parsed again into it is
+  // not merged with the value it held
+  for I := 0 to High(FFields) do
+    with FFields[I] do
+      if (TFieldFlag.Oneof in FFlags) and not (TFieldFlag.Overlaid in FFlags) and (FCaseOffset = ACaseOffset) and
+        (FCaseValue = AInstance[ACaseOffset]) then
+        begin
+          Value := AInstance + FOffset;
+          case FKind of
+            TFieldKind.&String:
+              PString(Value)^ := '';
+            TFieldKind.Bytes:
+              PBytes(Value)^ := nil;
+            TFieldKind.Message:
+              if TFieldFlag.Boxed in FFlags then
+                DynArrayClear(PPointer(Value)^, FArrayType)
+              else
+                begin
+                  FinalizeArray(Value, FMessage.FTypeInfo, 1);
+                  if TFieldFlag.Lazy in FFlags then
+                    begin
+                      Encoded(Value, FFields[I])^ := nil;
+                      PBoolean(PByte(Encoded(Value, FFields[I])) + SizeOf(Pointer))^ := False;
+                    end;
+                  FillChar(Value^, FMessage.FSize, 0);
+                end;
+          else
+            FillChar(Value^, CKindSizes[FKind], 0);
+          end;
+          Exit;
+        end;
+end;
+
+procedure MessageTable.ParseFrom(AInstance: PByte; const AField: FieldEntry; AWireType: TWireType; AReader: TReader);
+
+  function Append: PByte;
+  var
+    Count: NativeInt;
+    Bound: PInteger;
+  begin
+    if TFieldFlag.Bounded in AField.FFlags then
+      begin
+        // the values past the count are at their default, so the next one is parsed in place
+        Bound := PInteger(AInstance - AField.FOffset + AField.FCaseOffset);
+        if Bound^ = AField.FCaseValue then
+          raise ESerialError.CreateFmt('A bounded field holds at most %d values', [AField.FCaseValue]);
+        Inc(Bound^);
+        Exit(AInstance + (Bound^ - 1) * GetElementSize(AField));
+      end;
+    Count := DynArraySize(PPointer(AInstance)^) + 1;
+    DynArraySetLength(PPointer(AInstance)^, AField.FArrayType, 1, @Count);
+    Result := PByte(PPointer(AInstance)^) + (Count - 1) * GetElementSize(AField);
+  end;
+
+var
+  Target: PByte;
+begin
+  if AWireType <> AField.FWireType then
+    begin
+      // parsers must accept both packed and unpacked encodings of packable fields
+      AReader.BeginLengthPrefixed;
+      while not AReader.AtEnd do
+        Parse(Append, AField.FKind, AReader);
+      AReader.EndLengthPrefixed;
+      Exit;
+    end;
+  if TFieldFlag.Repeated in AField.FFlags then
+    Target := Append
+  else
+    Target := AInstance;
+  if AField.FKind = TFieldKind.Message then
+    ParseMessage(Target, AField, AReader)
+  else
+    Parse(Target, AField.FKind, AReader);
+end;
+
+class function MessageTable.GetElementSize(const AField: FieldEntry): Integer;
+begin
+  if TFieldFlag.Lazy in AField.FFlags then
+    Result := GetTypeData(AField.FArrayType)^.elSize
+  else if AField.FKind = TFieldKind.Message then
+    Result := AField.FMessage.FSize
+  else
+    Result := CKindSizes[AField.FKind];
+end;
+
+class function MessageTable.GetElements(AValue: PByte; const AField: FieldEntry; out ACount: Integer): PByte;
+begin
+  if TFieldFlag.Bounded in AField.FFlags then
+    begin
+      ACount := PInteger(AValue - AField.FOffset + AField.FCaseOffset)^;
+      Result := AValue;
+    end
+  else
+    begin
+      Result := PPointer(AValue)^;
+      ACount := DynArraySize(Result);
+    end;
+end;
+
+class function MessageTable.Encoded(AValue: PByte; const AField: FieldEntry): PBytes;
+begin
+  Result := PBytes(AValue + ((AField.FMessage.FSize + SizeOf(Pointer) - 1) and not (SizeOf(Pointer) - 1)));
+end;
+
+class function MessageTable.IsParsed(AValue: PByte; const AField: FieldEntry): Boolean;
+begin
+  Result := not (TFieldFlag.Lazy in AField.FFlags) or PBoolean(PByte(Encoded(AValue, AField)) + SizeOf(Pointer))^;
+end;
+
+class function MessageTable.MessageSize(AValue: PByte; const AField: FieldEntry; AWriter: TWriter): Integer;
+begin
+  if TFieldFlag.Boxed in AField.FFlags then
+    AValue := PPointer(AValue)^;
+  if IsParsed(AValue, AField) then
+    Result := AField.FMessage.ComputeSize(AValue, AWriter)
+  else
+    Result := Length(Encoded(AValue, AField)^);
+end;
+
+class procedure MessageTable.EncodeMessage(AValue: PByte; const AField: FieldEntry; AWriter: TWriter);
+var
+  Value: PBytes;
+begin
+  if TFieldFlag.Boxed in AField.FFlags then
+    AValue := PPointer(AValue)^;
+  if IsParsed(AValue, AField) then
+    AField.FMessage.EncodeTo(AValue, AWriter)
+  else
+    begin
+      Value := Encoded(AValue, AField);
+      if Length(Value^) > 0 then
+        AWriter.Write(Value^[0], Length(Value^)); // copied as it was parsed
+    end;
+end;
+
+class procedure MessageTable.ParseMessage(AValue: PByte; const AField: FieldEntry; AReader: TReader);
+var
+  Value: Bytes;
+  Count: NativeInt;
+begin
+  if TFieldFlag.Boxed in AField.FFlags then
+    begin
+      // allocates the box, or copies it if it is shared
+      Count := 1;
+      DynArraySetLength(PPointer(AValue)^, AField.FArrayType, 1, @Count);
+      AValue := PPointer(AValue)^;
+    end;
+  if IsParsed(AValue, AField) then
+    begin
+      AReader.BeginLengthPrefixed;
+      AField.FMessage.ParseFrom(AValue, AReader);
+      AReader.EndLengthPrefixed;
+    end
+  else
+    begin
+      // parsing the concatenation of several encodings merges the messages they hold
+      AReader.Parse(Value);
+      Encoded(AValue, AField)^ := Encoded(AValue, AField)^ + Value;
+    end;
+end;
+
+class function MessageTable.IsSelected(AInstance: PByte; const AField: FieldEntry): Boolean;
+begin
+  if TFieldFlag.Oneof in AField.FFlags then
+    Result := AInstance[AField.FCaseOffset] = AField.FCaseValue
+  else if TFieldFlag.Presence in AField.FFlags then
+    Result := PUInt32(AInstance + AField.FCaseOffset)^ and (UInt32(1) shl AField.FCaseValue) <> 0
+  else if TFieldFlag.Boxed in AField.FFlags then
+    Result := PPointer(AInstance + AField.FOffset)^ <> nil
+  else
+    Result := True;
+end;
+
+class function MessageTable.IsSet(AValue: PByte; AKind: TFieldKind): Boolean;
+begin
+  case AKind of
+    TFieldKind.Double:
+      Result := PDouble(AValue)^ <> 0;
+    TFieldKind.Float:
+      Result := PSingle(AValue)^ <> 0;
+    TFieldKind.Int32, TFieldKind.UInt32, TFieldKind.SInt32, TFieldKind.Fixed32, TFieldKind.SFixed32,
+      TFieldKind.Enum32:
+      Result := PUInt32(AValue)^ <> 0;
+    TFieldKind.Int64, TFieldKind.UInt64, TFieldKind.SInt64, TFieldKind.Fixed64, TFieldKind.SFixed64:
+      Result := PUInt64(AValue)^ <> 0;
+    TFieldKind.Bool, TFieldKind.Enum8:
+      Result := AValue^ <> 0;
+    TFieldKind.Enum16:
+      Result := PWord(AValue)^ <> 0;
+  else
+    Result := PPointer(AValue)^ <> nil; // empty strings and arrays are nil
+  end;
+end;
+
+class function MessageTable.FixedSize(AKind: TFieldKind): Integer;
+begin
+  if CKindWireTypes[AKind] = TWireType.VarInt then
+    if AKind = TFieldKind.Bool then
+      Result := 1
+    else
+      Result := 0
+  else
+    Result := CKindSizes[AKind];
+end;
+
+class function MessageTable.ValueSize(AValue: PByte; AKind: TFieldKind): Integer;
+begin
+  case AKind of
+    TFieldKind.Int32, TFieldKind.Enum32:
+      Result := VarInt.ByteCount(PInteger(AValue)^);
+    TFieldKind.Int64:
+      Result := VarInt.ByteCount(PInt64(AValue)^);
+    TFieldKind.UInt32:
+      Result := VarInt.ByteCount(PCardinal(AValue)^);
+    TFieldKind.UInt64:
+      Result := VarInt.ByteCount(PUInt64(AValue)^);
+    TFieldKind.SInt32:
+      Result := SignedInt.ByteCount(PInteger(AValue)^);
+    TFieldKind.SInt64:
+      Result := SignedInt.ByteCount(PInt64(AValue)^);
+    TFieldKind.Enum8:
+      Result := VarInt.ByteCount(AValue^);
+    TFieldKind.Enum16:
+      Result := VarInt.ByteCount(PWord(AValue)^);
+  else
+    Result := FixedSize(AKind);
+  end;
+end;
+
+class procedure MessageTable.Pack(AValue: PByte; AKind: TFieldKind; AWriter: TWriter);
+begin
+  case AKind of
+    TFieldKind.Double:
+      AWriter.Pack(FixedInt64(PDouble(AValue)^));
+    TFieldKind.Float:
+      AWriter.Pack(FixedInt32(PSingle(AValue)^));
+    TFieldKind.Int32, TFieldKind.Enum32:
+      AWriter.Pack(VarInt(PInteger(AValue)^));
+    TFieldKind.Int64:
+      AWriter.Pack(VarInt(PInt64(AValue)^));
+    TFieldKind.UInt32:
+      AWriter.Pack(VarInt(PCardinal(AValue)^));
+    TFieldKind.UInt64:
+      AWriter.Pack(VarInt(PUInt64(AValue)^));
+    TFieldKind.SInt32:
+      AWriter.Pack(SignedInt(PInteger(AValue)^));
+    TFieldKind.SInt64:
+      AWriter.Pack(SignedInt(PInt64(AValue)^));
+    TFieldKind.Fixed32:
+      AWriter.Pack(FixedInt32(PCardinal(AValue)^));
+    TFieldKind.Fixed64:
+      AWriter.Pack(FixedInt64(PUInt64(AValue)^));
+    TFieldKind.SFixed32:
+      AWriter.Pack(FixedInt32(PInteger(AValue)^));
+    TFieldKind.SFixed64:
+      AWriter.Pack(FixedInt64(PInt64(AValue)^));
+    TFieldKind.Bool:
+      AWriter.Pack(VarInt(Ord(PBoolean(AValue)^)));
+    TFieldKind.Enum8:
+      AWriter.Pack(VarInt(Int32(AValue^)));
+    TFieldKind.Enum16:
+      AWriter.Pack(VarInt(Int32(PWord(AValue)^)));
+    TFieldKind.&String:
+      AWriter.Pack(PString(AValue)^);
+    TFieldKind.Bytes:
+      AWriter.Pack(PBytes(AValue)^);
+  end;
+end;
+
+class procedure MessageTable.Parse(AValue: PByte; AKind: TFieldKind; AReader: TReader);
+var
+  Fixed32Value  : FixedInt32;
+  Fixed64Value  : FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue   : VarInt;
+begin
+  case CKindWireTypes[AKind] of
+    TWireType.Fixed32:
+      AReader.Parse(Fixed32Value);
+    TWireType.Fixed64:
+      AReader.Parse(Fixed64Value);
+  else
+    if AKind in [TFieldKind.SInt32, TFieldKind.SInt64] then
+      AReader.Parse(SignedIntValue)
+    else if not (AKind in [TFieldKind.&String, TFieldKind.Bytes]) then
+      AReader.Parse(VarIntValue);
+  end;
+  case AKind of
+    TFieldKind.Double:
+      PDouble(AValue)^ := Double(Fixed64Value);
+    TFieldKind.Float:
+      PSingle(AValue)^ := Single(Fixed32Value);
+    TFieldKind.Int32, TFieldKind.Enum32:
+      PInteger(AValue)^ := Int32(VarIntValue);
+    TFieldKind.Int64:
+      PInt64(AValue)^ := Int64(VarIntValue);
+    TFieldKind.UInt32:
+      PCardinal(AValue)^ := UInt32(VarIntValue);
+    TFieldKind.UInt64:
+      PUInt64(AValue)^ := UInt64(VarIntValue);
+    TFieldKind.SInt32:
+      PInteger(AValue)^ := Int32(SignedIntValue);
+    TFieldKind.SInt64:
+      PInt64(AValue)^ := Int64(SignedIntValue);
+    TFieldKind.Fixed32:
+      PCardinal(AValue)^ := UInt32(Fixed32Value);
+    TFieldKind.Fixed64:
+      PUInt64(AValue)^ := UInt64(Fixed64Value);
+    TFieldKind.SFixed32:
+      PInteger(AValue)^ := Int32(Fixed32Value);
+    TFieldKind.SFixed64:
+      PInt64(AValue)^ := Int64(Fixed64Value);
+    TFieldKind.Bool:
+      PBoolean(AValue)^ := UInt64(VarIntValue) <> 0;
+    TFieldKind.Enum8:
+      AValue^ := Byte(Int32(VarIntValue));
+    TFieldKind.Enum16:
+      PWord(AValue)^ := Word(Int32(VarIntValue));
+    TFieldKind.&String:
+      AReader.Parse(PString(AValue)^);
+    TFieldKind.Bytes:
+      AReader.Parse(PBytes(AValue)^);
+  end;
+end;
+
+end.
@@ -6,7 +6,7 @@ interface
 
 type
 
-  TWireType = (VarInt = 0, Fixed64 = 1, LengthPrefixed = 2, Fixed32 = 5);
+  TWireType = (VarInt = 0, Fixed64 = 1, LengthPrefixed = 2, StartGroup = 3, EndGroup = 4, Fixed32 = 5);
 
   VarIntImpl = record
     private
@@ -39,6 +39,8 @@ type
 
       procedure Initialize(ABytes: PByte; ALength: Integer); overload; inline;
 
+      class function ByteCount(AValue: UInt64): Integer; static;
+
       class operator Explicit(AValue: Int32): VarInt; static; inline;
       class operator Explicit(AValue: Int64): VarInt; static; inline;
       class operator Explicit(AValue: UInt32): VarInt; static; inline;
@@ -63,6 +65,9 @@ type
 
       procedure Initialize(ABytes: PByte; ALength: Integer); inline;
 
+      class function ByteCount(AValue: Int32): Integer; overload; static; inline;
+      class function ByteCount(AValue: Int64): Integer; overload; static; inline;
+
       class operator Explicit(AValue: Int32): SignedInt; static; inline;
       class operator Explicit(AValue: Int64): SignedInt; static; inline;
       class operator Explicit(AValue: SignedInt): Int32; static; inline;
@@ -82,6 +87,12 @@ type
       class operator Explicit(AValue: FixedInt32): Single; static; inline;
   end;
 
+  // a field tag along with its wire type, encoded as a VarInt in advance: the bytes are stored in little-endian order
+  EncodedTag = record
+    FBytes: UInt64;
+    FCount: Integer;
+  end;
+
   FixedInt64 = record
     private
       FValue: UInt64;
@@ -121,6 +132,16 @@ begin
   FValue           := AValue;
 end;
 
+class function VarInt.ByteCount(AValue: UInt64): Integer;
+begin
+  Result := 1;
+  while AValue >= VarIntImpl.CBitLimit do
+    begin
+      AValue := AValue shr VarIntImpl.CBitShift;
+      Inc(Result);
+    end;
+end;
+
 class operator VarInt.Explicit(AValue: Int32): VarInt;
 begin
   Result.Initialize(AValue);
@@ -168,6 +189,16 @@ begin
   FVarInt.Initialize(ABytes, ALength);
 end;
 
+class function SignedInt.ByteCount(AValue: Int32): Integer;
+begin
+  Result := VarInt.ByteCount(ZigZag(AValue));
+end;
+
+class function SignedInt.ByteCount(AValue: Int64): Integer;
+begin
+  Result := VarInt.ByteCount(ZigZag(AValue));
+end;
+
 class operator SignedInt.Explicit(AValue: Int32): SignedInt;
 begin
   Result.FVarInt.Initialize(ZigZag(AValue));
@@ -0,0 +1,307 @@
+unit Delphi.Serial.Protobuf.View;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  System.Classes;
+
+type
+
+  // a range of bytes in an encoded message, which is only valid as long as the buffer is neither freed nor resized
+  ByteSlice = record
+    private
+      FData : PByte;
+      FCount: Integer;
+
+    public
+      property Data: PByte read FData;
+      property Count: Integer read FCount;
+
+      function ToBytes: Bytes;
+      function ToString: string; // decodes the bytes as UTF-8
+  end;
+
+  // an encoded field value: the bits of a number, or the payload of a length-prefixed value
+  FieldValue = record
+    private
+      FBits : UInt64;
+      FSlice: ByteSlice;
+
+    public
+      function AsInt32: Int32; inline;
+      function AsInt64: Int64; inline;
+      function AsUInt32: UInt32; inline;
+      function AsUInt64: UInt64; inline;
+      function AsSInt32: Int32; inline;
+      function AsSInt64: Int64; inline;
+      function AsDouble: Double; inline;
+      function AsSingle: Single; inline;
+      function AsBoolean: Boolean; inline;
+      function AsSlice: ByteSlice; inline;
+  end;
+
+  // the values of a field with the given wire type, in the order they are encoded, including the packed ones of a
+  // repeated field; it can be iterated with for-in
+  FieldCursor = record
+    private
+      FPosition      : PByte;
+      FEnd           : PByte;
+      FPackedPosition: PByte; // the next value in the packed payload being iterated
+      FPackedEnd     : PByte;
+      FTag           : FieldTag;
+      FWireType      : TWireType;
+      FExpandPacked  : Boolean; // only repeated fields take the packed encoding, as the generated decoders have it
+      FCurrent       : FieldValue;
+
+    public
+      function GetEnumerator: FieldCursor; inline;
+      function MoveNext: Boolean;
+      property Current: FieldValue read FCurrent;
+  end;
+
+  // an encoded message, whose fields are decoded on demand without copying or allocating anything: a field that occurs
+  // several times takes its last value, as when the message is parsed, which for a sub-message means the others are
+  // not merged into it
+  MessageView = record
+    private
+      FData : PByte;
+      FCount: Integer;
+
+      class function ReadVarInt(var APosition: PByte; AEnd: PByte): UInt64; static;
+      class procedure ReadValue(var APosition: PByte; AEnd: PByte; AWireType: TWireType; var AValue: FieldValue);
+        static;
+
+    public
+      class function Create(AData: Pointer; ACount: Integer): MessageView; overload; static;
+      class function Create(AStream: TCustomMemoryStream): MessageView; overload; static;
+      class function Create(const ASlice: ByteSlice): MessageView; overload; static; inline;
+
+      property Data: PByte read FData;
+      property Count: Integer read FCount;
+
+      function Contains(ATag: FieldTag; AWireType: TWireType): Boolean;
+      function Find(ATag: FieldTag; AWireType: TWireType): FieldValue;
+      function Values(ATag: FieldTag; AWireType: TWireType): FieldCursor;
+  end;
+
+implementation
+
+{ ByteSlice }
+
+function ByteSlice.ToBytes: Bytes;
+begin
+  SetLength(Result, FCount);
+  if FCount > 0 then
+    Move(FData^, Result[0], FCount);
+end;
+
+function ByteSlice.ToString: string;
+begin
+  SetLength(Result, UnicodeFromLocaleChars(CP_UTF8, 0, PAnsiChar(FData), FCount, nil, 0));
+  if FCount > 0 then
+    UnicodeFromLocaleChars(CP_UTF8, 0, PAnsiChar(FData), FCount, PChar(Result), Length(Result));
+end;
+
+{ FieldValue }
+
+function FieldValue.AsInt32: Int32;
+begin
+  Result := Int32(FBits);
+end;
+
+function FieldValue.AsInt64: Int64;
+begin
+  Result := Int64(FBits);
+end;
+
+function FieldValue.AsUInt32: UInt32;
+begin
+  Result := UInt32(FBits);
+end;
+
+function FieldValue.AsUInt64: UInt64;
+begin
+  Result := FBits;
+end;
+
+function FieldValue.AsSInt32: Int32;
+begin
+  Result := AsSInt64;
+end;
+
+function FieldValue.AsSInt64: Int64;
+begin
+  if FBits and 1 = 0 then
+    Result := Int64(FBits shr 1)
+  else
+    Result := not Int64(FBits shr 1);
+end;
+
+function FieldValue.AsDouble: Double;
+begin
+  Result := PDouble(@FBits)^;
+end;
+
+function FieldValue.AsSingle: Single;
+begin
+  Result := PSingle(@FBits)^; // fixed 32-bit values are kept in the low bytes
+end;
+
+function FieldValue.AsBoolean: Boolean;
+begin
+  Result := FBits <> 0;
+end;
+
+function FieldValue.AsSlice: ByteSlice;
+begin
+  Result := FSlice;
+end;
+
+{ FieldCursor }
+
+function FieldCursor.GetEnumerator: FieldCursor;
+begin
+  Result := Self;
+end;
+
+function FieldCursor.MoveNext: Boolean;
+var
+  Key     : UInt64;
+  WireType: TWireType;
+begin
+  while True do
+    begin
+      if FPackedPosition < FPackedEnd then
+        begin
+          MessageView.ReadValue(FPackedPosition, FPackedEnd, FWireType, FCurrent);
+          Exit(True);
+        end;
+      if FPosition >= FEnd then
+        Exit(False);
+      Key      := MessageView.ReadVarInt(FPosition, FEnd);
+      WireType := TWireType(Key and 7);
+      MessageView.ReadValue(FPosition, FEnd, WireType, FCurrent);
+      if Key shr 3 = FTag then
+        if WireType = FWireType then
+          Exit(True)
+        else if (WireType = TWireType.LengthPrefixed) and FExpandPacked then
+          begin
+            // parsers must accept both packed and unpacked encodings of packable fields
+            FPackedPosition := FCurrent.FSlice.FData;
+            FPackedEnd      := FPackedPosition + FCurrent.FSlice.FCount;
+          end;
+    end;
+end;
+
+{ MessageView }
+
+class function MessageView.Create(AData: Pointer; ACount: Integer): MessageView;
+begin
+  Result.FData  := AData;
+  Result.FCount := ACount;
+end;
+
+class function MessageView.Create(AStream: TCustomMemoryStream): MessageView;
+begin
+  Result := Create(PByte(AStream.Memory) + AStream.Position, AStream.Size - AStream.Position);
+end;
+
+class function MessageView.Create(const ASlice: ByteSlice): MessageView;
+begin
+  Result := Create(ASlice.FData, ASlice.FCount);
+end;
+
+class function MessageView.ReadVarInt(var APosition: PByte; AEnd: PByte): UInt64;
+const
+  CMaxShift = 63; // the shift of the tenth and last byte of a 64-bit varint
+var
+  Shift: Integer;
+  Value: Byte;
+begin
+  // decoded here rather than by VarInt, which reads the byte at the limit of a varint that does not end before it
+  Result := 0;
+  Shift  := 0;
+  repeat
+    if APosition >= AEnd then
+      raise ESerialError.Create('Varint exceeds the enclosing data');
+    if Shift > CMaxShift then
+      raise ESerialError.Create('Varint exceeds the maximum length');
+    Value  := APosition^;
+    Result := Result or (UInt64(Value and $7F) shl Shift);
+    Inc(APosition);
+    Inc(Shift, 7);
+  until Value < $80;
+end;
+
+class procedure MessageView.ReadValue(var APosition: PByte; AEnd: PByte; AWireType: TWireType;
+  var AValue: FieldValue);
+var
+  Count: UInt64;
+begin
+  case AWireType of
+    TWireType.VarInt:
+      AValue.FBits := ReadVarInt(APosition, AEnd);
+    TWireType.Fixed64:
+      begin
+        if AEnd - APosition < SizeOf(UInt64) then
+          raise ESerialError.Create('Fixed-size value exceeds the enclosing data');
+        AValue.FBits := PUInt64(APosition)^;
+        Inc(APosition, SizeOf(UInt64));
+      end;
+    TWireType.LengthPrefixed:
+      begin
+        Count := ReadVarInt(APosition, AEnd);
+        // compared as signed, so that a count beyond Int64 is not taken for a small one
+        if (Int64(Count) < 0) or (Int64(Count) > AEnd - APosition) then
+          raise ESerialError.Create('Length prefix exceeds the enclosing data');
+        AValue.FSlice.FData  := APosition;
+        AValue.FSlice.FCount := Count;
+        Inc(APosition, Count);
+      end;
+    TWireType.Fixed32:
+      begin
+        if AEnd - APosition < SizeOf(UInt32) then
+          raise ESerialError.Create('Fixed-size value exceeds the enclosing data');
+        AValue.FBits := PUInt32(APosition)^;
+        Inc(APosition, SizeOf(UInt32));
+      end;
+  else
+    raise ESerialError.CreateFmt('Unsupported wire type: %d', [Ord(AWireType)]);
+  end;
+end;
+
+function MessageView.Values(ATag: FieldTag; AWireType: TWireType): FieldCursor;
+begin
+  Result               := Default (FieldCursor);
+  Result.FPosition     := FData;
+  Result.FEnd          := FData + FCount;
+  Result.FTag          := ATag;
+  Result.FWireType     := AWireType;
+  Result.FExpandPacked := True;
+end;
+
+function MessageView.Contains(ATag: FieldTag; AWireType: TWireType): Boolean;
+var
+  Cursor: FieldCursor;
+begin
+  Cursor               := Values(ATag, AWireType);
+  Cursor.FExpandPacked := False; // a singular field skips the packed encoding
+  Result               := Cursor.MoveNext;
+end;
+
+function MessageView.Find(ATag: FieldTag; AWireType: TWireType): FieldValue;
+var
+  Cursor: FieldCursor;
+begin
+  Result               := Default (FieldValue);
+  Cursor               := Values(ATag, AWireType);
+  Cursor.FExpandPacked := False; // a singular field skips the packed encoding
+  while Cursor.MoveNext do
+    Result := Cursor.Current;
+end;
+
+end.
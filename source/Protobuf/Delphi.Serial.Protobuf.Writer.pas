@@ -10,8 +10,17 @@ uses
 type
 
   TWriter = class
+    private const
+      CInitialSizeCount = 16; // start with this number of cached sizes
+
     private
-      FStream: TCustomMemoryStream;
+      FStream   : TCustomMemoryStream;
+      FSizes    : TArray<Integer>;
+      FSizeCount: Integer;
+      FSizeIndex: Integer;
+
+    public const
+      CTagSlack = SizeOf(UInt64); // room past a message for the store of its last tag, truncated once it is encoded
 
     public
       constructor Create(AStream: TCustomMemoryStream);
@@ -27,6 +36,22 @@ type
       procedure Pack(AValue: FixedInt32); overload; inline;
       procedure Pack(AValue: FixedInt64); overload; inline;
       procedure Pack(AWireType: TWireType; AFieldTag: FieldTag); overload; inline;
+      procedure Pack(const AValue: EncodedTag); overload; inline;
+      procedure Pack(const AValue: string); overload;
+      procedure Pack(const AValue: string; AByteCount: Integer); overload;
+      procedure Pack(const AValue: Bytes); overload;
+      procedure Splice(const AValue: Bytes); inline;
+
+      class function ByteCount(const AValue: string): Integer; static; inline;
+
+      // sizes of length-prefixed fields, stored in pre-order while computing the size of a message and consumed in
+      // the same order while encoding it, so that each length prefix is packed before its payload
+      procedure ResetSizes; inline;
+      function ReserveSize: Integer;
+      function StoreSize(ASlot, ASize: Integer): Integer; overload; inline;
+      function StoreSize(ASize: Integer): Integer; overload; inline;
+      procedure ReleaseSizes(ASlot: Integer); inline;
+      function NextSize: Integer; inline;
   end;
 
 implementation
@@ -36,6 +61,7 @@ implementation
 constructor TWriter.Create(AStream: TCustomMemoryStream);
 begin
   FStream := AStream;
+  SetLength(FSizes, CInitialSizeCount);
 end;
 
 procedure TWriter.Move(ACount, ADisplacement: Integer);
@@ -104,4 +130,85 @@ begin
   Pack(VarInt(Target));
 end;
 
+procedure TWriter.Pack(const AValue: EncodedTag);
+var
+  Target: PByte;
+begin
+  // the tag is stored at once, along with zeros past it that the data of the field overwrites next
+  Target           := Require(SizeOf(UInt64));
+  PUInt64(Target)^ := AValue.FBytes;
+  Skip(AValue.FCount);
+end;
+
+procedure TWriter.Pack(const AValue: string);
+begin
+  Pack(AValue, ByteCount(AValue));
+end;
+
+procedure TWriter.Pack(const AValue: string; AByteCount: Integer);
+begin
+  Pack(VarInt(AByteCount));
+  if AByteCount > 0 then
+    begin
+      LocaleCharsFromUnicode(CP_UTF8, 0, PChar(AValue), Length(AValue), Require(AByteCount), AByteCount, nil, nil);
+      Skip(AByteCount);
+    end;
+end;
+
+procedure TWriter.Pack(const AValue: Bytes);
+begin
+  Pack(VarInt(Length(AValue)));
+  if Length(AValue) > 0 then
+    write(AValue[0], Length(AValue));
+end;
+
+procedure TWriter.Splice(const AValue: Bytes);
+begin
+  if Length(AValue) > 0 then
+    write(AValue[0], Length(AValue)); // the bytes are already encoded, so they take no length prefix
+end;
+
+class function TWriter.ByteCount(const AValue: string): Integer;
+begin
+  Result := LocaleCharsFromUnicode(CP_UTF8, 0, PChar(AValue), Length(AValue), nil, 0, nil, nil);
+end;
+
+procedure TWriter.ResetSizes;
+begin
+  FSizeCount := 0;
+  FSizeIndex := 0;
+end;
+
+function TWriter.ReserveSize: Integer;
+begin
+  if FSizeCount = Length(FSizes) then
+    SetLength(FSizes, 2 * FSizeCount);
+  Result := FSizeCount;
+  Inc(FSizeCount);
+end;
+
+function TWriter.StoreSize(ASlot, ASize: Integer): Integer;
+begin
+  FSizes[ASlot] := ASize;
+  Result        := ASize;
+end;
+
+function TWriter.StoreSize(ASize: Integer): Integer;
+begin
+  Result := StoreSize(ReserveSize, ASize);
+end;
+
+procedure TWriter.ReleaseSizes(ASlot: Integer);
+begin
+  Assert(ASlot < FSizeCount);
+  FSizeCount := ASlot + 1; // keep the slot itself, the sizes stored after it are no longer needed
+end;
+
+function TWriter.NextSize: Integer;
+begin
+  Assert(FSizeIndex < FSizeCount);
+  Result := FSizes[FSizeIndex];
+  Inc(FSizeIndex);
+end;
+
 end.
@@ -27,11 +27,16 @@ type
 
       [Test]
       procedure TestSerializeMessage;
+
+      [Test]
+      procedure TestEnumNames;
   end;
 
 implementation
 
 uses
+  System.SysUtils,
+  System.TypInfo,
   Delphi.Serial.Json.OutputSerializer,
   Schema.Addressbook.Proto,
   Schema.Message.Proto;
@@ -92,6 +97,33 @@ begin
 //  FStream.SaveToFile('message.json');
 end;
 
+procedure TOutputSerializerTest.TestEnumNames;
+var
+  Names   : TArray<string>;
+  Phone   : TPersonPhoneNumber;
+  Optional: TOptional;
+  Output  : string;
+begin
+  Assert.IsTrue(EnumRegistry.TryGetNames(TypeInfo(TEnum), Names));
+  Assert.AreEqual(3, Length(Names));
+  Assert.AreEqual('Value0', Names[0]);
+  Assert.AreEqual('', Names[1]);
+  Assert.AreEqual('Value2', Names[2]);
+  Assert.IsFalse(EnumRegistry.TryGetNames(TypeInfo(TSparse), Names));
+  Phone.FNumber := '1';
+  Phone.FType   := TPersonPhoneType.Work;
+  FVisitor.Visit(Phone);
+  Assert.IsTrue(TEncoding.UTF8.GetString(BytesOf(FStream.Memory, FStream.Position)).Contains('"Work"'));
+
+  // a value the enum does not declare has no registered name, so it is written as RTTI names it
+  FStream.Position := 0;
+  Optional         := Default (TOptional);
+  Optional.FEnum   := TEnum(1);
+  FVisitor.Visit(Optional);
+  Output := TEncoding.UTF8.GetString(BytesOf(FStream.Memory, FStream.Position));
+  Assert.IsTrue(Output.Contains('"' + System.TypInfo.GetEnumName(TypeInfo(TEnum), 1) + '"'));
+end;
+
 initialization
 
 TDUnitX.RegisterTestFixture(TOutputSerializerTest);
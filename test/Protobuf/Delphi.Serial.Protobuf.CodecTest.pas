@@ -0,0 +1,1065 @@
+unit Delphi.Serial.Protobuf.CodecTest;
+
+interface
+
+uses
+  DUnitX.TestFramework,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial,
+  System.Classes;
+
+type
+
+  TProtobufReader = Delphi.Serial.Protobuf.Reader.TReader;
+  TProtobufWriter = Delphi.Serial.Protobuf.Writer.TWriter;
+  TFindFieldTag   = function(const AName: string): Integer; // the FindFieldTag class function of a generated record
+
+  [TestFixture]
+  TCodecTest = class
+    private
+      FStream    : TCustomMemoryStream;
+      FExpected  : TCustomMemoryStream;
+      FReader    : TProtobufReader;
+      FWriter    : TProtobufWriter;
+      FSerializer: ISerializer;
+      FVisitor   : TVisitor;
+
+      procedure CheckSameOutput;
+      procedure CheckTableRoundTrip(const ATable: MessageTable; ATarget: Pointer);
+      procedure CheckFieldNames(ATypeInfo: Pointer; AFindFieldTag: TFindFieldTag; const AFullName: string = '');
+
+    public
+      [Setup]
+      procedure Setup;
+      [TearDown]
+      procedure TearDown;
+
+      [Test]
+      procedure TestSerializeAddressBook;
+
+      [Test]
+      procedure TestSerializeMessage;
+
+      [Test]
+      procedure TestComputeSizeOmitsEmptyMessages;
+
+      [Test]
+      procedure TestParseAddressBook;
+
+      [Test]
+      procedure TestParseMessage;
+
+      [Test]
+      procedure TestParseSkipsUnknownFields;
+
+      [Test]
+      procedure TestSparseEnum;
+
+      [Test]
+      procedure TestFindFieldTag;
+
+      [Test]
+      procedure TestFindFieldTagAllMessages;
+
+      [Test]
+      procedure TestTableSerializeAddressBook;
+
+      [Test]
+      procedure TestTableSerializeMessage;
+
+      [Test]
+      procedure TestTableParseMessage;
+
+      [Test]
+      procedure TestTableSkipsPackedSingular;
+
+      [Test]
+      procedure TestLazyFields;
+
+      [Test]
+      procedure TestTableLazyFields;
+
+      [Test]
+      procedure TestPresence;
+
+      [Test]
+      procedure TestTablePresence;
+
+      [Test]
+      procedure TestBoxed;
+
+      [Test]
+      procedure TestTableBoxed;
+
+      [Test]
+      procedure TestOverlaid;
+
+      [Test]
+      procedure TestOneofSwitch;
+
+      [Test]
+      procedure TestMaps;
+
+      [Test]
+      procedure TestTableMaps;
+
+      [Test]
+      procedure TestBounded;
+
+      [Test]
+      procedure TestTableBounded;
+
+      [Test]
+      procedure TestUnknownFields;
+
+      [Test]
+      procedure TestTableUnknownFields;
+  end;
+
+implementation
+
+uses
+  System.Rtti,
+  System.SysUtils,
+  System.TypInfo,
+  Delphi.Serial.Protobuf.OutputSerializer,
+  Delphi.Serial.Protobuf.Schema,
+  Delphi.Serial.Protobuf.Types,
+  Schema.Addressbook.Proto,
+  Schema.Message.Proto,
+  Schema.Presence.Proto,
+  Schema.Envelope.Proto,
+  Schema.Config.Proto,
+  Schema.Sensor.Proto,
+  Schema.Relay.Proto;
+
+{ TCodecTest }
+
+procedure TCodecTest.Setup;
+begin
+  FStream            := TMemoryStream.Create;
+  FExpected          := TMemoryStream.Create;
+  FReader            := TProtobufReader.Create(FStream);
+  FWriter            := TProtobufWriter.Create(FStream);
+  FSerializer        := TOutputSerializer.Create;
+  FSerializer.Stream := FExpected;
+  FVisitor.Initialize(FSerializer);
+end;
+
+procedure TCodecTest.TearDown;
+begin
+  FReader.Free;
+  FWriter.Free;
+  FExpected.Free;
+  FStream.Free;
+end;
+
+procedure TCodecTest.CheckSameOutput;
+begin
+  Assert.AreEqual<Int64>(FExpected.Position, FStream.Position);
+  Assert.IsTrue(CompareMem(FExpected.Memory, FStream.Memory, FStream.Position));
+end;
+
+// parses the encoding written to FStream through the table into the target, and checks that the table encodes the
+// target back into the same bytes
+procedure TCodecTest.CheckTableRoundTrip(const ATable: MessageTable; ATarget: Pointer);
+var
+  Writer: TProtobufWriter;
+begin
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  ATable.ParseFrom(ATarget, FReader);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+  FExpected.Position := 0;
+  Writer             := TProtobufWriter.Create(FExpected);
+  try
+    ATable.SerializeTo(ATarget, Writer);
+  finally
+    Writer.Free;
+  end;
+  CheckSameOutput;
+end;
+
+procedure TCodecTest.TestSerializeAddressBook;
+const
+  CPerson: TPerson = (FName: 'abc'; FId: 1; FLastUpdated: (FSeconds: - 1));
+var
+  Addressbook: TAddressBook;
+begin
+  Addressbook.FPeople := Addressbook.FPeople + [CPerson, CPerson];
+  FVisitor.Visit(Addressbook);
+  Addressbook.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(44, FStream.Position);
+  Assert.AreEqual<Int64>(FStream.Size, FStream.Position);
+  CheckSameOutput;
+end;
+
+procedure TCodecTest.TestSerializeMessage;
+const
+  COptional: TOptional = (FFloat: 0.1; FBytes: [1]);
+  CDefault: TDefault   = (FFloat: 0.1);
+  CRequired: TRequired = (FFloat: 0);
+  CRepeated: TRepeated = (FFloat: [0.1]; FBytes: [[]]);
+  CUnPacked: TUnPacked = (FFloat: [0.1]);
+var
+  Msg: TMessage;
+begin
+  Msg.FOptional := Msg.FOptional + [COptional];
+  Msg.FDefault  := Msg.FDefault + [CDefault];
+  Msg.FRequired := Msg.FRequired + [CRequired];
+  Msg.FRepeated := Msg.FRepeated + [CRepeated];
+  Msg.FUnPacked := Msg.FUnPacked + [CUnPacked];
+  FVisitor.Visit(Msg);
+  Msg.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(99, FStream.Position);
+  Assert.AreEqual<Int64>(FStream.Size, FStream.Position);
+  CheckSameOutput;
+end;
+
+procedure TCodecTest.TestComputeSizeOmitsEmptyMessages;
+var
+  Person: TPerson;
+begin
+  Person         := Default (TPerson);
+  Person.FPhones := [Default (TPersonPhoneNumber)];
+  FVisitor.Visit(Person);
+  Assert.AreEqual(2, Person.ComputeSize(FWriter));
+  Person.SerializeTo(FWriter);
+  CheckSameOutput;
+  Person.FPhones[0].FNumber  := 'abc';
+  Person.FLastUpdated.FNanos := 300;
+  FStream.Position           := 0;
+  Assert.AreEqual(12, Person.ComputeSize(FWriter));
+  Person.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(12, FStream.Position);
+end;
+
+procedure TCodecTest.TestParseAddressBook;
+const
+  CPerson: TPerson = (FName: 'abc'; FId: 1; FEmail: 'e'#$00E9; FLastUpdated: (FSeconds: - 1; FNanos: 2));
+var
+  Addressbook: TAddressBook;
+  Target     : TAddressBook;
+begin
+  Addressbook.FPeople                       := Addressbook.FPeople + [CPerson, CPerson];
+  Addressbook.FPeople[1].FPhones            := [Default (TPersonPhoneNumber)];
+  Addressbook.FPeople[1].FPhones[0].FNumber := '123';
+  Addressbook.FPeople[1].FPhones[0].FType   := TPersonPhoneType.Work;
+  Addressbook.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TAddressBook);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+  Assert.AreEqual(2, Length(Target.FPeople));
+  Assert.AreEqual('abc', Target.FPeople[0].FName);
+  Assert.AreEqual(1, Target.FPeople[0].FId);
+  Assert.AreEqual('e'#$00E9, Target.FPeople[0].FEmail);
+  Assert.AreEqual<Int64>(- 1, Target.FPeople[0].FLastUpdated.FSeconds);
+  Assert.AreEqual(2, Target.FPeople[0].FLastUpdated.FNanos);
+  Assert.AreEqual(0, Length(Target.FPeople[0].FPhones));
+  Assert.AreEqual(1, Length(Target.FPeople[1].FPhones));
+  Assert.AreEqual('123', Target.FPeople[1].FPhones[0].FNumber);
+  Assert.AreEqual(TPersonPhoneType.Work, Target.FPeople[1].FPhones[0].FType);
+end;
+
+procedure TCodecTest.TestParseMessage;
+const
+  CRequired: TRequired = (FDouble: 0.5; FFloat: 0.25; FInt32: - 1; FSint64: - 2; FFixed32: 3; FBool: True;
+    FString: 'a'; FBytes: [1, 2]; FEnum: TEnum.Value2);
+  CRepeated: TRepeated = (FSint32: [- 1, 0, 1]; FDouble: [0.5]; FBytes: [[], [1]]);
+  CUnPacked: TUnPacked = (FUint64: [1, 300]);
+var
+  Msg   : TMessage;
+  Target: TMessage;
+begin
+  Msg.FRequired := Msg.FRequired + [CRequired];
+  Msg.FRepeated := Msg.FRepeated + [CRepeated];
+  Msg.FUnPacked := Msg.FUnPacked + [CUnPacked];
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TMessage);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(1, Length(Target.FRequired));
+  Assert.AreEqual<Double>(0.5, Target.FRequired[0].FDouble);
+  Assert.AreEqual<Single>(0.25, Target.FRequired[0].FFloat);
+  Assert.AreEqual(- 1, Target.FRequired[0].FInt32);
+  Assert.AreEqual<SInt64>(- 2, Target.FRequired[0].FSint64);
+  Assert.AreEqual<Fixed32>(3, Target.FRequired[0].FFixed32);
+  Assert.IsTrue(Target.FRequired[0].FBool);
+  Assert.AreEqual('a', Target.FRequired[0].FString);
+  Assert.AreEqual(2, Length(Target.FRequired[0].FBytes));
+  Assert.AreEqual(TEnum.Value2, Target.FRequired[0].FEnum);
+  Assert.AreEqual(1, Length(Target.FRepeated));
+  Assert.AreEqual(3, Length(Target.FRepeated[0].FSint32));
+  Assert.AreEqual<SInt32>(- 1, Target.FRepeated[0].FSint32[0]);
+  Assert.AreEqual<SInt32>(1, Target.FRepeated[0].FSint32[2]);
+  Assert.AreEqual(2, Length(Target.FRepeated[0].FBytes));
+  Assert.AreEqual(1, Length(Target.FRepeated[0].FBytes[1]));
+  Assert.AreEqual(1, Length(Target.FUnPacked));
+  Assert.AreEqual(2, Length(Target.FUnPacked[0].FUint64));
+  Assert.AreEqual<UInt64>(300, Target.FUnPacked[0].FUint64[1]);
+end;
+
+procedure TCodecTest.TestParseSkipsUnknownFields;
+var
+  Target: TPersonPhoneNumber;
+begin
+  FWriter.Pack(TWireType.Fixed64, 7);
+  FWriter.Pack(FixedInt64(UInt64(1)));
+  FWriter.Pack(TWireType.LengthPrefixed, 1);
+  FWriter.Pack('123');
+  FWriter.Pack(TWireType.LengthPrefixed, 8);
+  FWriter.Pack('ignored');
+  FStream.Position := 0;
+  Target           := Default (TPersonPhoneNumber);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual('123', Target.FNumber);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+end;
+
+procedure TCodecTest.TestSparseEnum;
+var
+  Values: TSparseValues;
+  Target: TSparseValues;
+  Name  : string;
+begin
+  Values.FSparse  := TSparse.Minus;
+  Values.FSparses := [TSparse.Million, TSparse.Zero, TSparse(7)];
+  Assert.IsTrue(Values.FSparse.TryGetName(Name));
+  Assert.AreEqual('Minus', Name);
+  Assert.IsTrue(Values.FSparses[0].TryGetName(Name));
+  Assert.AreEqual('Million', Name);
+  Assert.IsFalse(Values.FSparses[2].TryGetName(Name));
+  Assert.IsTrue(TSparse.TryParse('Zero', Target.FSparse));
+  Assert.AreEqual<TSparse>(TSparse.Zero, Target.FSparse);
+  Assert.IsFalse(TSparse.TryParse('zero', Target.FSparse));
+  Values.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(Values.ComputeSize(FWriter), FStream.Position);
+  FStream.Position := 0;
+  Target           := Default (TSparseValues);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual<TSparse>(TSparse.Minus, Target.FSparse);
+  Assert.AreEqual(3, Length(Target.FSparses));
+  Assert.AreEqual<TSparse>(TSparse.Million, Target.FSparses[0]);
+  Assert.AreEqual<TSparse>(TSparse(7), Target.FSparses[2]);
+end;
+
+procedure TCodecTest.TestFindFieldTag;
+begin
+  Assert.AreEqual(5, TPerson.FindFieldTag('lastUpdated'));
+  Assert.AreEqual(5, TPerson.FindFieldTag('last_updated'));
+  Assert.AreEqual(4, TPerson.FindFieldTag('phones'));
+  Assert.AreEqual(0, TPerson.FindFieldTag('lastupdated'));
+  Assert.AreEqual(0, TPerson.FindFieldTag(''));
+  Assert.AreEqual(2, TGoogleProtobufTimestamp.FindFieldTag('nanos'));
+end;
+
+procedure TCodecTest.CheckFieldNames(ATypeInfo: Pointer; AFindFieldTag: TFindFieldTag; const AFullName: string);
+
+  procedure CheckFields(AType: TRttiType);
+  var
+    Field    : TRttiField;
+    Attribute: TCustomAttribute;
+    Tag      : Integer;
+    Name     : string;
+    Oneof    : Boolean;
+  begin
+    for Field in AType.GetFields do
+      begin
+        Tag   := 0;
+        Name  := '';
+        Oneof := False;
+        for Attribute in Field.GetAttributes do
+          if Attribute is TagAttribute then
+            Tag := TagAttribute(Attribute).Value
+          else if Attribute is NameAttribute then
+            Name := NameAttribute(Attribute).Value
+          else if Attribute is OneofAttribute then
+            Oneof := True;
+        if Tag <> 0 then
+          begin
+            Assert.AreEqual(Tag, AFindFieldTag(Name), Name);
+            Assert.AreEqual(0, AFindFieldTag(Name + '_'), Name + '_');
+          end
+        else if Oneof and (Field.FieldType is TRttiRecordType) then
+          CheckFields(Field.FieldType); // the members of a oneof are fields of its nested record
+      end;
+  end;
+
+var
+  Context : TRttiContext;
+  Schema  : TMessageSchema;
+  Field   : FieldSchema;
+  Other   : FieldSchema;
+  Expected: Integer;
+begin
+  // every JSON name finds its field, and no longer does once altered
+  Context := TRttiContext.Create;
+  CheckFields(Context.GetType(ATypeInfo));
+  Assert.AreEqual(0, AFindFieldTag(''));
+  if AFullName = '' then
+    Exit;
+  // so does every original name, unless it is the JSON name of another field, which wins as it does in protobuf
+  Schema := SchemaRegistry.FindMessage(AFullName);
+  Assert.IsNotNull(Schema, AFullName);
+  for Field in Schema.Fields do
+    begin
+      Expected := Field.FNumber;
+      for Other in Schema.Fields do
+        if Other.FJsonName = Field.FName then
+          Expected := Other.FNumber;
+      Assert.AreEqual(Expected, AFindFieldTag(Field.FName), Field.FName);
+      Assert.AreEqual(0, AFindFieldTag(Field.FName + '_'), Field.FName + '_');
+    end;
+end;
+
+procedure TCodecTest.TestFindFieldTagAllMessages;
+begin
+  CheckFieldNames(TypeInfo(TPersonPhoneNumber), TPersonPhoneNumber.FindFieldTag, 'Person.PhoneNumber');
+  CheckFieldNames(TypeInfo(TGoogleProtobufTimestamp), TGoogleProtobufTimestamp.FindFieldTag,
+    'google.protobuf.Timestamp');
+  CheckFieldNames(TypeInfo(TPerson), TPerson.FindFieldTag, 'Person');
+  CheckFieldNames(TypeInfo(TAddressBook), TAddressBook.FindFieldTag, 'AddressBook');
+  CheckFieldNames(TypeInfo(TOptional), TOptional.FindFieldTag, 'Optional');
+  CheckFieldNames(TypeInfo(TDefault), TDefault.FindFieldTag, 'Default');
+  CheckFieldNames(TypeInfo(TRequired), TRequired.FindFieldTag, 'Required');
+  CheckFieldNames(TypeInfo(TRepeated), TRepeated.FindFieldTag, 'Repeated');
+  CheckFieldNames(TypeInfo(TUnPacked), TUnPacked.FindFieldTag, 'UnPacked');
+  CheckFieldNames(TypeInfo(TMessage), TMessage.FindFieldTag, 'Message');
+  CheckFieldNames(TypeInfo(TSparseValues), TSparseValues.FindFieldTag, 'SparseValues');
+  CheckFieldNames(TypeInfo(TLazyFields), TLazyFields.FindFieldTag, 'LazyFields');
+  CheckFieldNames(TypeInfo(TJsonNames), TJsonNames.FindFieldTag, 'JsonNames');
+  CheckFieldNames(TypeInfo(TInner), TInner.FindFieldTag);
+  CheckFieldNames(TypeInfo(TPresence), TPresence.FindFieldTag);
+  CheckFieldNames(TypeInfo(TWidePresence), TWidePresence.FindFieldTag);
+  CheckFieldNames(TypeInfo(TMotion), TMotion.FindFieldTag);
+  CheckFieldNames(TypeInfo(TRemark), TRemark.FindFieldTag);
+  CheckFieldNames(TypeInfo(TEnvelope), TEnvelope.FindFieldTag);
+  CheckFieldNames(TypeInfo(TLimit), TLimit.FindFieldTag);
+  CheckFieldNames(TypeInfo(TConfigSettingsEntry), TConfigSettingsEntry.FindFieldTag);
+  CheckFieldNames(TypeInfo(TConfigLimitsEntry), TConfigLimitsEntry.FindFieldTag);
+  CheckFieldNames(TypeInfo(TConfigFlagsEntry), TConfigFlagsEntry.FindFieldTag);
+  CheckFieldNames(TypeInfo(TConfig), TConfig.FindFieldTag);
+  CheckFieldNames(TypeInfo(TSample), TSample.FindFieldTag);
+  CheckFieldNames(TypeInfo(TReading), TReading.FindFieldTag);
+  CheckFieldNames(TypeInfo(THeader), THeader.FindFieldTag);
+  CheckFieldNames(TypeInfo(TFrame), TFrame.FindFieldTag);
+  CheckFieldNames(TypeInfo(TExtendedHeader), TExtendedHeader.FindFieldTag);
+  CheckFieldNames(TypeInfo(TExtendedFrame), TExtendedFrame.FindFieldTag);
+
+  // a json_name option can make the JSON name of a field the original name of another
+  Assert.AreEqual(1, TJsonNames.FindFieldTag('firstName'));
+  Assert.AreEqual(2, TJsonNames.FindFieldTag('first_name'));
+  Assert.AreEqual(2, TJsonNames.FindFieldTag('alias'));
+end;
+
+procedure TCodecTest.TestTableSerializeAddressBook;
+const
+  CPerson: TPerson = (FName: 'abc'; FId: 1; FLastUpdated: (FSeconds: - 1));
+var
+  Addressbook: TAddressBook;
+  Target     : TAddressBook;
+  Writer     : TProtobufWriter;
+begin
+  Addressbook.FPeople                       := Addressbook.FPeople + [CPerson, CPerson];
+  Addressbook.FPeople[1].FPhones            := [Default (TPersonPhoneNumber)];
+  Addressbook.FPeople[1].FPhones[0].FNumber := '123';
+  Addressbook.FPeople[1].FPhones[0].FType   := TPersonPhoneType.Work;
+  Addressbook.SerializeTo(FWriter);
+  Writer := TProtobufWriter.Create(FExpected);
+  try
+    TAddressBook.Table.SerializeTo(@Addressbook, Writer);
+  finally
+    Writer.Free;
+  end;
+  CheckSameOutput;
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TAddressBook);
+  TAddressBook.Table.ParseFrom(@Target, FReader);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+  Assert.AreEqual(2, Length(Target.FPeople));
+  Assert.AreEqual('abc', Target.FPeople[0].FName);
+  Assert.AreEqual<Int64>(- 1, Target.FPeople[0].FLastUpdated.FSeconds);
+  Assert.AreEqual(1, Length(Target.FPeople[1].FPhones));
+  Assert.AreEqual('123', Target.FPeople[1].FPhones[0].FNumber);
+  Assert.AreEqual(TPersonPhoneType.Work, Target.FPeople[1].FPhones[0].FType);
+end;
+
+procedure TCodecTest.TestTableSerializeMessage;
+const
+  COptional: TOptional = (FFloat: 0.1; FSint32: - 3; FBytes: [1]; FEnum: TEnum.Value2);
+  CDefault: TDefault   = (FFloat: 0.1);
+  CRequired: TRequired = (FFloat: 0);
+  CRepeated: TRepeated = (FFloat: [0.1]; FInt32: [- 1, 300]; FString: ['a', '']; FBytes: [[]]);
+  CUnPacked: TUnPacked = (FFloat: [0.1]; FSint64: [- 2]);
+var
+  Msg   : TMessage;
+  Writer: TProtobufWriter;
+begin
+  Msg.FOptional := Msg.FOptional + [COptional];
+  Msg.FDefault  := Msg.FDefault + [CDefault];
+  Msg.FRequired := Msg.FRequired + [CRequired];
+  Msg.FRepeated := Msg.FRepeated + [CRepeated];
+  Msg.FUnPacked := Msg.FUnPacked + [CUnPacked];
+  Msg.SerializeTo(FWriter);
+  Writer := TProtobufWriter.Create(FExpected);
+  try
+    TMessage.Table.SerializeTo(@Msg, Writer);
+    Assert.AreEqual(Msg.ComputeSize(FWriter), TMessage.Table.ComputeSize(@Msg, Writer));
+  finally
+    Writer.Free;
+  end;
+  CheckSameOutput;
+end;
+
+procedure TCodecTest.TestTableParseMessage;
+const
+  CRequired: TRequired = (FDouble: 0.5; FFloat: 0.25; FInt32: - 1; FSint64: - 2; FFixed32: 3; FBool: True;
+    FString: 'a'; FBytes: [1, 2]; FEnum: TEnum.Value2);
+  CRepeated: TRepeated = (FSint32: [- 1, 0, 1]; FDouble: [0.5]; FBytes: [[], [1]]);
+  CUnPacked: TUnPacked = (FUint64: [1, 300]);
+var
+  Msg   : TMessage;
+  Target: TMessage;
+begin
+  Msg.FRequired := Msg.FRequired + [CRequired];
+  Msg.FRepeated := Msg.FRepeated + [CRepeated];
+  Msg.FUnPacked := Msg.FUnPacked + [CUnPacked];
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TMessage);
+  TMessage.Table.ParseFrom(@Target, FReader);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+  Assert.AreEqual(1, Length(Target.FRequired));
+  Assert.AreEqual<Double>(0.5, Target.FRequired[0].FDouble);
+  Assert.AreEqual<Single>(0.25, Target.FRequired[0].FFloat);
+  Assert.AreEqual(- 1, Target.FRequired[0].FInt32);
+  Assert.AreEqual<SInt64>(- 2, Target.FRequired[0].FSint64);
+  Assert.AreEqual<Fixed32>(3, Target.FRequired[0].FFixed32);
+  Assert.IsTrue(Target.FRequired[0].FBool);
+  Assert.AreEqual('a', Target.FRequired[0].FString);
+  Assert.AreEqual(2, Length(Target.FRequired[0].FBytes));
+  Assert.AreEqual(TEnum.Value2, Target.FRequired[0].FEnum);
+  Assert.AreEqual(3, Length(Target.FRepeated[0].FSint32));
+  Assert.AreEqual<SInt32>(- 1, Target.FRepeated[0].FSint32[0]);
+  Assert.AreEqual(2, Length(Target.FRepeated[0].FBytes));
+  Assert.AreEqual(1, Length(Target.FRepeated[0].FBytes[1]));
+  Assert.AreEqual(2, Length(Target.FUnPacked[0].FUint64));
+  Assert.AreEqual<UInt64>(300, Target.FUnPacked[0].FUint64[1]);
+end;
+
+procedure TCodecTest.TestTableSkipsPackedSingular;
+var
+  Run   : Bytes;
+  Target: TOptional;
+begin
+  // a packed run of a singular field is skipped, as by the generated decoder, instead of being parsed into the field
+  Run := [5, 7];
+  FWriter.Pack(TWireType.LengthPrefixed, 3);
+  FWriter.Pack(Run);
+  FWriter.Pack(TWireType.VarInt, 5);
+  FWriter.Pack(VarInt(9));
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TOptional);
+  TOptional.Table.ParseFrom(@Target, FReader);
+  Assert.AreEqual(FStream.Size, FStream.Position);
+  Assert.AreEqual(0, Target.FInt32);
+  Assert.AreEqual<UInt32>(9, Target.FUint32);
+  FStream.Position := 0;
+  Target           := Default (TOptional);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(0, Target.FInt32);
+  Assert.AreEqual<UInt32>(9, Target.FUint32);
+end;
+
+procedure TCodecTest.TestLazyFields;
+const
+  COptional: TOptional = (FSint32: - 3; FString: 'a');
+  CRepeated: TRepeated = (FInt32: [- 1, 300]);
+var
+  Msg   : TLazyFields;
+  Target: TLazyFields;
+  Writer: TProtobufWriter;
+begin
+  Msg.FOptional.Value := COptional;
+  SetLength(Msg.FRepeated, 1);
+  Msg.FRepeated[0].Value := CRepeated;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TLazyFields);
+  Target.ParseFrom(FReader);
+  Assert.IsFalse(Target.FOptional.Parsed);
+  Assert.IsFalse(Target.FRepeated[0].Parsed);
+  Writer := TProtobufWriter.Create(FExpected);
+  try
+    Target.SerializeTo(Writer); // the encodings are copied without being parsed
+  finally
+    Writer.Free;
+  end;
+  CheckSameOutput;
+  Assert.AreEqual<SInt32>(- 3, Target.FOptional.Value.FSint32);
+  Assert.AreEqual('a', Target.FOptional.Value.FString);
+  Assert.IsTrue(Target.FOptional.Parsed);
+  Assert.AreEqual(2, Length(Target.FRepeated[0].Value.FInt32));
+  Assert.AreEqual(300, Target.FRepeated[0].Value.FInt32[1]);
+end;
+
+procedure TCodecTest.TestTableLazyFields;
+const
+  COptional: TOptional = (FSint32: - 3; FString: 'a');
+  CRepeated: TRepeated = (FInt32: [- 1, 300]);
+var
+  Msg   : TLazyFields;
+  Target: TLazyFields;
+begin
+  Msg.FOptional.Value := COptional;
+  SetLength(Msg.FRepeated, 2);
+  Msg.FRepeated[1].Value := CRepeated;
+  Msg.SerializeTo(FWriter);
+  Target := Default (TLazyFields);
+  CheckTableRoundTrip(TLazyFields.Table, @Target);
+  Assert.IsFalse(Target.FOptional.Parsed);
+  Assert.AreEqual(2, Length(Target.FRepeated));
+  Assert.AreEqual<SInt32>(- 3, Target.FOptional.Value.FSint32);
+  Assert.AreEqual(300, Target.FRepeated[1].Value.FInt32[1]);
+  Assert.AreEqual(Msg.ComputeSize(FWriter), TLazyFields.Table.ComputeSize(@Target, FWriter));
+end;
+
+procedure TCodecTest.TestPresence;
+var
+  Msg   : TPresence;
+  Wide  : TWidePresence;
+  Target: TPresence;
+begin
+  Msg := Default (TPresence);
+  Msg.SetInt32(0);
+  Msg.SetString('');
+  Msg.FDouble := 0.5; // left out without its bit
+  Msg.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(4, FStream.Position);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TPresence);
+  Target.ParseFrom(FReader);
+  Assert.IsTrue(Target.HasInt32);
+  Assert.IsTrue(Target.HasString);
+  Assert.IsFalse(Target.HasDouble);
+  Assert.IsFalse(Target.HasBool);
+  Target.ClearInt32;
+  Assert.IsFalse(Target.HasInt32);
+  Assert.AreEqual(2, Target.ComputeSize(FWriter));
+
+  Wide := Default (TWidePresence);
+  Wide.SetHematite(0);
+  Assert.IsTrue(Wide.HasHematite);
+  Assert.IsFalse(Wide.HasAlpha);
+  Assert.AreEqual(3, Wide.ComputeSize(FWriter));
+end;
+
+procedure TCodecTest.TestTablePresence;
+var
+  Msg   : TPresence;
+  Target: TPresence;
+begin
+  Msg := Default (TPresence);
+  Msg.SetBool(False);
+  Msg.SetLevel(TLevel.None);
+  Msg.SetSint64(- 1);
+  Msg.FImplicit := 0;
+  Msg.SerializeTo(FWriter);
+  Target := Default (TPresence);
+  CheckTableRoundTrip(TPresence.Table, @Target);
+  Assert.IsTrue(Target.HasBool);
+  Assert.IsTrue(Target.HasLevel);
+  Assert.IsTrue(Target.HasSint64);
+  Assert.IsFalse(Target.HasInt32);
+end;
+
+procedure TCodecTest.TestBoxed;
+const
+  CFirst: TInner  = (FValue: 7);
+  CSecond: TInner = (FValue: 9);
+var
+  Msg   : TPresence;
+  Shared: TPresence;
+  Target: TPresence;
+begin
+  Msg := Default (TPresence);
+  Assert.IsFalse(Msg.FInner.HasValue);
+  Assert.AreEqual(0, Msg.FInner.Value.FValue);
+  Assert.AreEqual(0, Msg.ComputeSize(FWriter));
+  Msg.FInner.Value := Default (TInner); // present though empty
+  Msg.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(2, FStream.Position);
+
+  // a record parsed into does not change the box it shares with another record
+  Msg.FInner.Value := CSecond;
+  FStream.Position := 0;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Msg.FInner.Value := CFirst;
+  Shared           := Msg;
+  Shared.ParseFrom(FReader);
+  Assert.AreEqual(9, Shared.FInner.Value.FValue);
+  Assert.AreEqual(7, Msg.FInner.Value.FValue);
+  Shared.FInner.Clear;
+  Assert.IsFalse(Shared.FInner.HasValue);
+  Assert.IsTrue(Msg.FInner.HasValue);
+
+  FStream.Position := 0;
+  Target           := Default (TPresence);
+  Target.ParseFrom(FReader);
+  Assert.IsTrue(Target.FInner.HasValue);
+  Assert.AreEqual(9, Target.FInner.Value.FValue);
+end;
+
+procedure TCodecTest.TestTableBoxed;
+const
+  CInner: TInner = (FValue: - 3);
+var
+  Msg   : TPresence;
+  Target: TPresence;
+begin
+  Msg              := Default (TPresence);
+  Msg.FInner.Value := CInner;
+  Msg.SerializeTo(FWriter);
+  Target := Default (TPresence);
+  CheckTableRoundTrip(TPresence.Table, @Target);
+  Assert.AreEqual(- 3, Target.FInner.Value.FValue);
+end;
+
+procedure TCodecTest.TestOverlaid;
+const
+  CFirst: TMotion  = (FX: 1; FY: 5);
+  CSecond: TMotion = (FTime: - 3);
+  CThird: TMotion  = (FX: 2);
+var
+  Msg   : TEnvelope;
+  Target: TEnvelope;
+begin
+  // the members without managed values share the storage that follows the others
+  Assert.IsTrue(@Msg.FEvent.FMove = @Msg.FEvent.FCode);
+  Assert.IsTrue(@Msg.FEvent.FClick = @Msg.FEvent.FPing);
+  Assert.IsTrue(@Msg.FEvent.FNote <> @Msg.FEvent.FRemark);
+
+  // a message replacing another member starts from scratch, while one replacing itself is merged
+  Msg               := Default (TEnvelope);
+  Msg.FEvent.FCase  := TEnvelopeEventCase.EnvelopeMove;
+  Msg.FEvent.FMove  := CFirst;
+  Msg.SerializeTo(FWriter);
+  Msg               := Default (TEnvelope);
+  Msg.FEvent.FCase  := TEnvelopeEventCase.EnvelopeClick;
+  Msg.FEvent.FClick := CSecond;
+  Msg.SerializeTo(FWriter);
+  Msg.FEvent.FClick := CThird;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TEnvelope);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual<TEnvelopeEventCase>(TEnvelopeEventCase.EnvelopeClick, Target.FEvent.FCase);
+  Assert.AreEqual<Double>(2, Target.FEvent.FClick.FX);
+  Assert.AreEqual<Double>(0, Target.FEvent.FClick.FY);
+  Assert.AreEqual<Int64>(- 3, Target.FEvent.FClick.FTime);
+
+  FStream.Position := 0;
+  Target           := Default (TEnvelope);
+  TEnvelope.Table.ParseFrom(@Target, FReader);
+  Assert.AreEqual<TEnvelopeEventCase>(TEnvelopeEventCase.EnvelopeClick, Target.FEvent.FCase);
+  Assert.AreEqual<Double>(0, Target.FEvent.FClick.FY);
+  Assert.AreEqual<Int64>(- 3, Target.FEvent.FClick.FTime);
+end;
+
+procedure TCodecTest.TestOneofSwitch;
+var
+  Msg   : TEnvelope;
+  Target: TEnvelope;
+begin
+  // the member selected before is released, so that a message selected again starts from scratch
+  Msg                      := Default (TEnvelope);
+  Msg.FEvent.FCase         := TEnvelopeEventCase.EnvelopeRemark;
+  Msg.FEvent.FRemark.FText := 'a';
+  Msg.SerializeTo(FWriter);
+  Msg                      := Default (TEnvelope);
+  Msg.FEvent.FCase         := TEnvelopeEventCase.EnvelopeNote;
+  Msg.FEvent.FNote         := 'n';
+  Msg.SerializeTo(FWriter);
+  Msg                      := Default (TEnvelope);
+  Msg.FEvent.FCase         := TEnvelopeEventCase.EnvelopeRemark;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TEnvelope);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual<TEnvelopeEventCase>(TEnvelopeEventCase.EnvelopeRemark, Target.FEvent.FCase);
+  Assert.AreEqual('', Target.FEvent.FRemark.FText);
+  Assert.AreEqual('', Target.FEvent.FNote);
+
+  FStream.Position := 0;
+  Target           := Default (TEnvelope);
+  TEnvelope.Table.ParseFrom(@Target, FReader);
+  Assert.AreEqual<TEnvelopeEventCase>(TEnvelopeEventCase.EnvelopeRemark, Target.FEvent.FCase);
+  Assert.AreEqual('', Target.FEvent.FRemark.FText);
+  Assert.AreEqual('', Target.FEvent.FNote);
+end;
+
+procedure TCodecTest.TestMaps;
+const
+  CLimit: TLimit = (FLow: - 1; FHigh: 1);
+var
+  Msg   : TConfig;
+  Shared: TConfig;
+  Target: TConfig;
+  Value : string;
+  I     : Integer;
+begin
+  Msg := Default (TConfig);
+  for I := 0 to 999 do
+    Msg.FSettings[IntToStr(I)] := IntToStr(2 * I);
+  Msg.FSettings['1'] := 'one';
+  Msg.FLimits.AddOrSetValue(- 5, CLimit);
+  Msg.FFlags[- 1] := True;
+  Assert.AreEqual(1000, Msg.FSettings.Count);
+  Assert.AreEqual('one', Msg.FSettings['1']);
+  Assert.AreEqual('1998', Msg.FSettings['999']);
+  Assert.AreEqual('', Msg.FSettings['1000']);
+  Assert.IsFalse(Msg.FSettings.TryGetValue('1000', Value));
+  Assert.IsTrue(Msg.FSettings.Remove('0'));
+  Assert.IsFalse(Msg.FSettings.ContainsKey('0'));
+  Assert.AreEqual('1', Msg.FSettings.Entries[0].FKey);
+
+  // a record changed after a copy does not change the entries it shares with the copy
+  Shared := Msg;
+  Shared.FSettings['2'] := 'two';
+  Shared.FFlags.Clear;
+  Assert.AreEqual('4', Msg.FSettings['2']);
+  Assert.IsTrue(Msg.FFlags[- 1]);
+
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TConfig);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(999, Target.FSettings.Count);
+  Assert.AreEqual('one', Target.FSettings['1']);
+  Assert.AreEqual(1, Target.FLimits[- 5].FHigh);
+  Assert.IsTrue(Target.FFlags[- 1]);
+
+  // an entry whose key was decoded before replaces its value
+  Msg := Default (TConfig);
+  Msg.FSettings['5'] := 'five';
+  FStream.Position := 0;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(999, Target.FSettings.Count);
+  Assert.AreEqual('five', Target.FSettings['5']);
+end;
+
+procedure TCodecTest.TestTableMaps;
+var
+  Msg   : TConfig;
+  Target: TConfig;
+  Merged: TConfig;
+begin
+  Msg := Default (TConfig);
+  Msg.FSettings['a'] := '1';
+  Msg.FSettings['b'] := '2';
+  Msg.SerializeTo(FWriter);
+  Msg.FSettings.Clear;
+  Msg.FSettings['a'] := '3';
+  Msg.SerializeTo(FWriter);
+
+  // the table codec appends the entries as a repeated message, whose duplicate keys are merged on the first lookup
+  Target := Default (TConfig);
+  CheckTableRoundTrip(TConfig.Table, @Target);
+  Assert.AreEqual(2, Target.FSettings.Count);
+  Assert.AreEqual('3', Target.FSettings['a']);
+  Assert.AreEqual('a', Target.FSettings.Entries[0].FKey);
+  FStream.Position := 0;
+  Target.SerializeTo(FWriter);
+  Merged := Default (TConfig);
+  CheckTableRoundTrip(TConfig.Table, @Merged);
+  Assert.AreEqual(2, Merged.FSettings.Count);
+end;
+
+procedure TCodecTest.TestBounded;
+const
+  CSample: TSample = (FTime: 3; FLabel: 's');
+var
+  Msg   : TReading;
+  Shared: TReading;
+  Target: TReading;
+begin
+  Msg := Default (TReading);
+  Msg.FValues.Add(- 1);
+  Msg.FValues.Add(300);
+  Msg.FWeights.Add(0.5);
+  Msg.FTags.Add('a');
+  Msg.FSamples.Add(CSample);
+  Msg.FFlags.Add(True);
+  Msg.FHistory := [7];
+  Msg.FName    := 'n';
+  Assert.AreEqual(2, Msg.FValues.Count);
+  Assert.AreEqual<Integer>(300, Msg.FValues[1]);
+  Assert.WillRaise(
+    procedure
+    begin
+      Msg.FValues[2] := 0;
+    end, ESerialError);
+
+  // the values are held by the record, so a copy does not share them
+  Shared := Msg;
+  Shared.FTags[0] := 'b';
+  Shared.FValues.Clear;
+  Assert.AreEqual('a', Msg.FTags[0]);
+  Assert.AreEqual(2, Msg.FValues.Count);
+
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target           := Default (TReading);
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(2, Target.FValues.Count);
+  Assert.AreEqual<Integer>(- 1, Target.FValues[0]);
+  Assert.AreEqual<Double>(0.5, Target.FWeights[0]);
+  Assert.AreEqual('a', Target.FTags[0]);
+  Assert.AreEqual('s', Target.FSamples[0].FLabel);
+  Assert.IsTrue(Target.FFlags[0]);
+  Assert.AreEqual('n', Target.FName);
+
+  // merging fills the capacity, and one more value is rejected
+  Msg := Default (TReading);
+  Msg.FValues.Add(1);
+  Msg.FValues.Add(2);
+  FStream.Position := 0;
+  Msg.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  Target.ParseFrom(FReader);
+  Assert.AreEqual(4, Target.FValues.Count);
+  Assert.AreEqual<Integer>(2, Target.FValues[3]);
+  FStream.Position := 0;
+  Assert.WillRaise(
+    procedure
+    begin
+      Target.ParseFrom(FReader);
+    end, ESerialError);
+end;
+
+procedure TCodecTest.TestTableBounded;
+const
+  CSample: TSample = (FTime: 3; FLabel: 's');
+var
+  Msg   : TReading;
+  Target: TReading;
+begin
+  Msg := Default (TReading);
+  Msg.FValues.Add(- 1);
+  Msg.FWeights.Add(0.5);
+  Msg.FTags.Add('a');
+  Msg.FTags.Add('');
+  Msg.FSamples.Add(CSample);
+  Msg.FFlags.Add(False);
+  Msg.FFlags.Add(True);
+  Msg.SerializeTo(FWriter);
+
+  // the table codec appends in place up to the capacity given by the table
+  Target := Default (TReading);
+  CheckTableRoundTrip(TReading.Table, @Target);
+  Assert.AreEqual(2, Target.FTags.Count);
+  Assert.AreEqual(3, Target.FSamples[0].FTime);
+  Assert.IsTrue(Target.FFlags[1]);
+
+  FStream.Position := 0;
+  Assert.WillRaise(
+    procedure
+    begin
+      TReading.Table.ParseFrom(@Target, FReader);
+    end, ESerialError);
+end;
+
+procedure TCodecTest.TestUnknownFields;
+var
+  Extended: TExtendedFrame;
+  Frame   : TFrame;
+begin
+  Extended                 := Default (TExtendedFrame);
+  Extended.FId             := 1;
+  Extended.FHeader.FHop    := 2;
+  Extended.FHeader.FTarget := 't';
+  Extended.FHeader.FWeight := 0.5;
+  Extended.FPayload        := [1, 2];
+  Extended.FTags           := ['a', 'b'];
+  Extended.FStamp          := 3;
+  Extended.FPriority       := - 4;
+  Extended.SerializeTo(FWriter);
+  FStream.Size := FStream.Position;
+  FExpected.CopyFrom(FStream, 0);
+
+  // the fields of the next revision are kept by the records of the first one, and encoded back after the known ones
+  FStream.Position := 0;
+  Frame            := Default (TFrame);
+  Frame.ParseFrom(FReader);
+  Assert.AreEqual(1, Frame.FId);
+  Assert.AreEqual('t', Frame.FHeader.FTarget);
+  FStream.Position := 0;
+  Frame.SerializeTo(FWriter);
+  CheckSameOutput;
+
+  FStream.Position := 0;
+  Extended         := Default (TExtendedFrame);
+  Extended.ParseFrom(FReader);
+  Assert.AreEqual<Double>(0.5, Extended.FHeader.FWeight);
+  Assert.AreEqual(2, Length(Extended.FTags));
+  Assert.AreEqual<Integer>(- 4, Extended.FPriority);
+end;
+
+procedure TCodecTest.TestTableUnknownFields;
+const
+  CFixed: array [0 .. 4] of Byte = ($0D, 1, 2, 3, 4); // a known field with an unexpected wire type
+var
+  Extended : TExtendedFrame;
+  Frame    : TFrame;
+  Merged   : TFrame;
+  InputSize: Int64;
+begin
+  Extended              := Default (TExtendedFrame);
+  Extended.FId          := 1;
+  Extended.FHeader.FHop := 2;
+  Extended.FTags        := ['a'];
+  Extended.FStamp       := 3;
+  Extended.SerializeTo(FWriter);
+  FStream.WriteBuffer(CFixed, SizeOf(CFixed));
+  InputSize := FStream.Position;
+
+  // the table codec keeps the unknown fields in the same order as the generated codecs
+  Frame := Default (TFrame);
+  CheckTableRoundTrip(TFrame.Table, @Frame);
+  Assert.AreEqual(2, Frame.FHeader.FHop);
+
+  // merging appends to the fields already kept, so that they are encoded twice while the known ones are encoded once
+  FStream.Position := 0;
+  Frame.ParseFrom(FReader);
+  FStream.Position := 0;
+  Frame.SerializeTo(FWriter);
+  Assert.AreEqual<Int64>(2 * InputSize - 2 - 4, FStream.Position); // without a second id and header
+  Merged := Default (TFrame);
+  CheckTableRoundTrip(TFrame.Table, @Merged);
+end;
+
+initialization
+
+TDUnitX.RegisterTestFixture(TCodecTest);
+
+end.
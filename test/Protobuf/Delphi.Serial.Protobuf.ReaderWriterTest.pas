@@ -21,6 +21,8 @@ type
       FReader: TProtobufReader;
       FWriter: TProtobufWriter;
 
+      procedure ReadField(const AKind: string);
+
     public
       [Setup]
       procedure Setup;
@@ -111,6 +113,55 @@ type
       [TestCase('Last wire type and first field tag', '5,1')]
       [TestCase('Last wire type and last field tag', '5,536870911')]
       procedure TestPackAndParseWireTypeAndFieldTag(AWireType: Integer; AFieldTag: FieldTag);
+
+      [Test]
+      [TestCase('One byte', '1,10,1')]
+      [TestCase('Two bytes', '16,386,2')]
+      [TestCase('Last field tag', '536870911,68719476730,5')]
+      procedure TestPackEncodedTag(AFieldTag: FieldTag; ABytes: UInt64; ACount: Integer);
+
+      [Test]
+      [TestCase('Empty', ',0')]
+      [TestCase('Ascii', 'abc,3')]
+      [TestCase('Multi-byte', #$00E9#$20AC',5')]
+      procedure TestPackString(const AValue: string; AByteCount: Integer);
+
+      [Test]
+      [TestCase('Empty', '')]
+      [TestCase('Ascii', 'abc')]
+      [TestCase('Multi-byte', #$00E9#$20AC)]
+      procedure TestPackAndParseString(const AValue: string);
+
+      [Test]
+      [TestCase('VarInt', '0')]
+      [TestCase('Fixed64', '1')]
+      [TestCase('LengthPrefixed', '2')]
+      [TestCase('Fixed32', '5')]
+      procedure TestSkipField(AWireType: Integer);
+
+      [Test]
+      procedure TestSkipGroup;
+
+      [Test]
+      [TestCase('Other end tag', 'Other')]
+      [TestCase('Missing end tag', 'Missing')]
+      procedure TestSkipMalformedGroup(const AKind: string);
+
+      [Test]
+      [TestCase('String', 'String')]
+      [TestCase('Bytes', 'Bytes')]
+      [TestCase('Skipped length prefix', 'LengthPrefixed')]
+      [TestCase('Skipped Fixed32', 'Fixed32')]
+      [TestCase('Skipped Fixed64', 'Fixed64')]
+      procedure TestLengthExceedsScope(const AKind: string);
+
+      [Test]
+      [TestCase('String', 'String')]
+      [TestCase('Bytes', 'Bytes')]
+      [TestCase('Skipped length prefix', 'LengthPrefixed')]
+      [TestCase('Skipped Fixed32', 'Fixed32')]
+      [TestCase('Skipped Fixed64', 'Fixed64')]
+      procedure TestLengthExceedsData(const AKind: string);
   end;
 
 implementation
@@ -267,6 +318,161 @@ begin
   Assert.AreEqual(AFieldTag, TargetFieldTag);
 end;
 
+procedure TReaderWriterTest.TestPackEncodedTag(AFieldTag: FieldTag; ABytes: UInt64; ACount: Integer);
+var
+  Tag           : EncodedTag;
+  TargetWireType: TWireType;
+  TargetFieldTag: FieldTag;
+  TargetValue   : VarInt;
+begin
+  Tag.FBytes := ABytes;
+  Tag.FCount := ACount;
+  FWriter.Pack(Tag);
+  FWriter.Pack(VarInt(1));
+  FWriter.Truncate; // drops the zeros stored past the tag, as the encoders do once done
+  Assert.AreEqual<Int64>(ACount + 1, FStream.Size);
+  FStream.Position := 0;
+  FReader.Parse(TargetWireType, TargetFieldTag);
+  FReader.Parse(TargetValue);
+  Assert.AreEqual(TWireType.LengthPrefixed, TargetWireType);
+  Assert.AreEqual(AFieldTag, TargetFieldTag);
+  Assert.AreEqual(1, Int32(TargetValue));
+end;
+
+procedure TReaderWriterTest.TestPackString(const AValue: string; AByteCount: Integer);
+var
+  Target: VarInt;
+begin
+  FWriter.Pack(AValue);
+  FStream.Position := 0;
+  FReader.Parse(Target);
+  Assert.AreEqual(AByteCount, Int32(Target));
+  Assert.AreEqual<Int64>(Target.Count + AByteCount, FStream.Size);
+end;
+
+procedure TReaderWriterTest.TestPackAndParseString(const AValue: string);
+var
+  Target: string;
+begin
+  FWriter.Pack(AValue);
+  FStream.Position := 0;
+  FReader.Parse(Target);
+  Assert.AreEqual(AValue, Target);
+  Assert.IsTrue(FReader.AtEnd);
+end;
+
+procedure TReaderWriterTest.TestSkipField(AWireType: Integer);
+var
+  Target: VarInt;
+begin
+  case TWireType(AWireType) of
+    TWireType.VarInt:
+      FWriter.Pack(VarInt(300));
+    TWireType.Fixed64:
+      FWriter.Pack(FixedInt64(UInt64(1)));
+    TWireType.LengthPrefixed:
+      FWriter.Pack('abc');
+    TWireType.Fixed32:
+      FWriter.Pack(FixedInt32(UInt32(1)));
+  end;
+  FWriter.Pack(VarInt(1));
+  FStream.Position := 0;
+  FReader.SkipField(TWireType(AWireType));
+  FReader.Parse(Target);
+  Assert.AreEqual(1, Int32(Target));
+  Assert.IsTrue(FReader.AtEnd);
+end;
+
+procedure TReaderWriterTest.TestSkipGroup;
+var
+  WireType: TWireType;
+  Tag     : FieldTag;
+  Target  : VarInt;
+begin
+  // a group holding a field and a nested group, followed by a field that is read after skipping them
+  FWriter.Pack(TWireType.StartGroup, 3);
+  FWriter.Pack(TWireType.LengthPrefixed, 1);
+  FWriter.Pack('abc');
+  FWriter.Pack(TWireType.StartGroup, 2);
+  FWriter.Pack(TWireType.VarInt, 1);
+  FWriter.Pack(VarInt(300));
+  FWriter.Pack(TWireType.EndGroup, 2);
+  FWriter.Pack(TWireType.EndGroup, 3);
+  FWriter.Pack(VarInt(1));
+  FStream.Position := 0;
+  FReader.Parse(WireType, Tag);
+  FReader.SkipField(WireType);
+  FReader.Parse(Target);
+  Assert.AreEqual(1, Int32(Target));
+  Assert.IsTrue(FReader.AtEnd);
+end;
+
+procedure TReaderWriterTest.TestSkipMalformedGroup(const AKind: string);
+var
+  WireType: TWireType;
+  Tag     : FieldTag;
+begin
+  FWriter.Pack(TWireType.StartGroup, 3);
+  FWriter.Pack(TWireType.VarInt, 1);
+  FWriter.Pack(VarInt(300));
+  if AKind = 'Other' then
+    FWriter.Pack(TWireType.EndGroup, 4);
+  FStream.Position := 0;
+  FReader.Parse(WireType, Tag);
+  Assert.WillRaise(
+    procedure
+    begin
+      FReader.SkipField(WireType);
+    end, ESerialError);
+end;
+
+procedure TReaderWriterTest.ReadField(const AKind: string);
+var
+  TargetString: string;
+  TargetBytes : Bytes;
+begin
+  if AKind = 'String' then
+    FReader.Parse(TargetString)
+  else if AKind = 'Bytes' then
+    FReader.Parse(TargetBytes)
+  else if AKind = 'LengthPrefixed' then
+    FReader.SkipField(TWireType.LengthPrefixed)
+  else if AKind = 'Fixed32' then
+    FReader.SkipField(TWireType.Fixed32)
+  else
+    FReader.SkipField(TWireType.Fixed64);
+end;
+
+procedure TReaderWriterTest.TestLengthExceedsScope(const AKind: string);
+begin
+  // the scope ends after three bytes, while the inner length claims three more than the one it takes, so that it
+  // reaches into the field that follows the scope
+  FWriter.Pack(VarInt(3));
+  FWriter.Pack(VarInt(3));
+  FWriter.Pack(VarInt(1));
+  FWriter.Pack(VarInt(1));
+  FWriter.Pack(VarInt(1));
+  FStream.Position := 0;
+  FReader.BeginLengthPrefixed;
+  Assert.WillRaise(
+    procedure
+    begin
+      ReadField(AKind);
+    end, ESerialError);
+end;
+
+procedure TReaderWriterTest.TestLengthExceedsData(const AKind: string);
+begin
+  FWriter.Pack(VarInt(3));
+  FWriter.Pack(VarInt(1));
+  FStream.Position := 0;
+  Assert.WillRaise(
+    procedure
+    begin
+      ReadField(AKind);
+    end, ESerialError);
+end;
+
 initialization
 
 TDUnitX.RegisterTestFixture(TReaderWriterTest);
@@ -0,0 +1,114 @@
+unit Delphi.Serial.Protobuf.SchemaTest;
+
+interface
+
+uses
+  DUnitX.TestFramework;
+
+type
+
+  [TestFixture]
+  TSchemaTest = class
+    public
+      [Test]
+      procedure TestFields;
+
+      [Test]
+      procedure TestImported;
+
+      [Test]
+      procedure TestLabels;
+
+      [Test]
+      procedure TestEnums;
+
+      [Test]
+      procedure TestNotFound;
+  end;
+
+implementation
+
+uses
+  Delphi.Serial.Protobuf.Schema,
+  Schema.Addressbook.Proto,
+  Schema.Message.Proto;
+
+{ TSchemaTest }
+
+procedure TSchemaTest.TestFields;
+var
+  Schema: TMessageSchema;
+  Field : PFieldSchema;
+begin
+  Schema := SchemaRegistry.FindMessage('Person');
+  Assert.IsNotNull(Schema);
+  Assert.AreEqual(5, Length(Schema.Fields));
+  Field := Schema.FindField(5);
+  Assert.IsNotNull(Field);
+  Assert.AreEqual('last_updated', Field.FName);
+  Assert.AreEqual('lastUpdated', Field.FJsonName);
+  Assert.AreEqual(TSchemaType.Message, Field.FType);
+  Assert.AreEqual('google.protobuf.Timestamp', Field.FTypeName);
+  // a field is found by its name as well as by its JSON name
+  Assert.IsTrue(Field = Schema.FindField('last_updated'));
+  Assert.IsTrue(Field = Schema.FindField('lastUpdated'));
+  Field := SchemaRegistry.FindMessage('Person.PhoneNumber').FindField('type');
+  Assert.AreEqual(TSchemaType.Enum, Field.FType);
+  Assert.AreEqual('Person.PhoneType', Field.FTypeName);
+  // a repeated scalar is packed by default in proto3 only
+  Field := SchemaRegistry.FindMessage('AddressBook').FindField(1);
+  Assert.IsTrue(Field.FRepeated);
+  Assert.IsFalse(Field.FPacked);
+end;
+
+procedure TSchemaTest.TestImported;
+var
+  Schema: TMessageSchema;
+begin
+  Schema := SchemaRegistry.FindMessage('google.protobuf.Timestamp');
+  Assert.IsNotNull(Schema);
+  Assert.AreEqual(TSchemaType.Int64, Schema.FindField('seconds').FType);
+  Assert.AreEqual(TSchemaType.Int32, Schema.FindField(2).FType);
+end;
+
+procedure TSchemaTest.TestLabels;
+begin
+  Assert.IsTrue(SchemaRegistry.FindMessage('Required').FindField('int32').FRequired);
+  Assert.IsFalse(SchemaRegistry.FindMessage('Optional').FindField('int32').FRequired);
+  Assert.IsTrue(SchemaRegistry.FindMessage('Repeated').FindField('sint32').FPacked);
+  Assert.IsFalse(SchemaRegistry.FindMessage('UnPacked').FindField('sint32').FPacked);
+  Assert.AreEqual(- 1, SchemaRegistry.FindMessage('Optional').FindField('int32').FOneofIndex);
+end;
+
+procedure TSchemaTest.TestEnums;
+var
+  Schema: TEnumSchema;
+  Name  : string;
+  Value : Int32;
+begin
+  Schema := SchemaRegistry.FindEnum('Person.PhoneType');
+  Assert.IsNotNull(Schema);
+  Assert.AreEqual(3, Length(Schema.Values));
+  Assert.IsTrue(Schema.TryGetName(2, Name));
+  Assert.AreEqual('WORK', Name);
+  Assert.IsTrue(Schema.TryGetValue('HOME', Value));
+  Assert.AreEqual(1, Value);
+  Schema := SchemaRegistry.FindEnum('Sparse');
+  Assert.IsTrue(Schema.TryGetName(- 1, Name));
+  Assert.AreEqual('SPARSE_MINUS', Name);
+  Assert.IsFalse(Schema.TryGetName(1, Name));
+end;
+
+procedure TSchemaTest.TestNotFound;
+begin
+  Assert.IsNull(SchemaRegistry.FindMessage('Missing'));
+  Assert.IsNull(SchemaRegistry.FindEnum('Person'));
+  Assert.IsNull(SchemaRegistry.FindMessage('Person').FindField(6));
+  Assert.IsNull(SchemaRegistry.FindMessage('Person').FindField('lastupdated'));
+end;
+
+initialization
+
+TDUnitX.RegisterTestFixture(TSchemaTest);
+
+end.
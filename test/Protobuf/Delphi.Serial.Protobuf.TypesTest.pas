@@ -35,6 +35,15 @@ type
       [TestCase('First with 10 bytes', '9223372036854775808')]
       [TestCase('Last with 10 bytes', '18446744073709551615')]
       procedure TestCreateAndExtractBig(const AValue: string);
+
+      [Test]
+      [TestCase('First with 1 byte', '0')]
+      [TestCase('Last with 1 byte', '127')]
+      [TestCase('First with 2 bytes', '128')]
+      [TestCase('Last with 5 bytes', '34359738367')]
+      [TestCase('First with 9 bytes', '72057594037927936')]
+      [TestCase('Last with 9 bytes', '9223372036854775807')]
+      procedure TestByteCount(AValue: UInt64);
   end;
 
   [TestFixture]
@@ -55,6 +64,20 @@ type
       [TestCase('Highest value', '9223372036854775807')]
       [TestCase('Lowest value', '-9223372036854775808')]
       procedure TestCreateAndExtract64(AValue: Int64);
+
+      [Test]
+      [TestCase('Zero', '0')]
+      [TestCase('Minus one', '-1')]
+      [TestCase('Highest value', '2147483647')]
+      [TestCase('Lowest value', '-2147483648')]
+      procedure TestByteCount32(AValue: Int32);
+
+      [Test]
+      [TestCase('Zero', '0')]
+      [TestCase('Minus one', '-1')]
+      [TestCase('Highest value', '9223372036854775807')]
+      [TestCase('Lowest value', '-9223372036854775808')]
+      procedure TestByteCount64(AValue: Int64);
   end;
 
   [TestFixture]
@@ -110,6 +133,11 @@ begin
   Assert.AreEqual(Value, UInt64(VarInt(Value)));
 end;
 
+procedure TVarIntTest.TestByteCount(AValue: UInt64);
+begin
+  Assert.AreEqual(VarInt(AValue).Count, VarInt.ByteCount(AValue));
+end;
+
 { TSignedIntTest }
 
 procedure TSignedIntTest.TestCreateAndExtract32(AValue: Int32);
@@ -122,6 +150,16 @@ begin
   Assert.AreEqual(AValue, Int64(SignedInt(AValue)));
 end;
 
+procedure TSignedIntTest.TestByteCount32(AValue: Int32);
+begin
+  Assert.AreEqual(SignedInt(AValue).Count, SignedInt.ByteCount(AValue));
+end;
+
+procedure TSignedIntTest.TestByteCount64(AValue: Int64);
+begin
+  Assert.AreEqual(SignedInt(AValue).Count, SignedInt.ByteCount(AValue));
+end;
+
 { TFixedInt32Test }
 
 procedure TFixedInt32Test.TestCreateAndExtract(AValue: UInt32);
@@ -0,0 +1,291 @@
+unit Delphi.Serial.Protobuf.ViewTest;
+
+interface
+
+uses
+  DUnitX.TestFramework,
+  Delphi.Serial.Protobuf.Writer,
+  System.Classes;
+
+type
+
+  TProtobufWriter = Delphi.Serial.Protobuf.Writer.TWriter;
+
+  [TestFixture]
+  TViewTest = class
+    private
+      FStream: TCustomMemoryStream;
+      FWriter: TProtobufWriter;
+
+    public
+      [Setup]
+      procedure Setup;
+      [TearDown]
+      procedure TearDown;
+
+      [Test]
+      procedure TestAddressBook;
+
+      [Test]
+      procedure TestAbsentFields;
+
+      [Test]
+      procedure TestScalars;
+
+      [Test]
+      procedure TestPackedAndUnpacked;
+
+      [Test]
+      procedure TestPackedSingular;
+
+      [Test]
+      procedure TestLastValueWins;
+
+      [Test]
+      procedure TestTruncated;
+
+      [Test]
+      procedure TestTruncatedVarInt;
+
+      [Test]
+      procedure TestTruncatedLength;
+  end;
+
+implementation
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.View,
+  Schema.Addressbook.Proto,
+  Schema.Message.Proto;
+
+{ TViewTest }
+
+procedure TViewTest.Setup;
+begin
+  FStream := TMemoryStream.Create;
+  FWriter := TProtobufWriter.Create(FStream);
+end;
+
+procedure TViewTest.TearDown;
+begin
+  FWriter.Free;
+  FStream.Free;
+end;
+
+procedure TViewTest.TestAddressBook;
+const
+  CPerson: TPerson = (FName: 'abc'; FId: 300; FEmail: 'e'#$E9; FLastUpdated: (FSeconds: - 1; FNanos: 2));
+  CPhone: TPersonPhoneNumber = (FNumber: '123'; FType: TPersonPhoneType.Work);
+var
+  Addressbook: TAddressBook;
+  View       : TAddressBookView;
+  Person     : TPersonView;
+  Value      : FieldValue;
+  Count      : Integer;
+begin
+  Addressbook.FPeople := [CPerson, CPerson];
+  Addressbook.FPeople[1].FPhones := [CPhone, CPhone];
+  Addressbook.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  View             := TAddressBookView.Create(MessageView.Create(FStream));
+  Count            := 0;
+  for Value in View.GetPeople do
+    begin
+      Person := TPersonView.Create(Value);
+      Assert.AreEqual('abc', Person.GetName.ToString);
+      Assert.AreEqual(300, Person.GetId);
+      Assert.AreEqual('e'#$E9, Person.GetEmail.ToString);
+      Assert.AreEqual(3, Person.GetEmail.Count);
+      Assert.AreEqual<Int64>(- 1, Person.GetLastUpdated.GetSeconds);
+      Assert.AreEqual(2, Person.GetLastUpdated.GetNanos);
+      Inc(Count);
+    end;
+  Assert.AreEqual(2, Count);
+  for Value in Person.GetPhones do
+    begin
+      Assert.AreEqual('123', TPersonPhoneNumberView.Create(Value).GetNumber.ToString);
+      Assert.AreEqual(TPersonPhoneType.Work, TPersonPhoneNumberView.Create(Value).GetType);
+    end;
+  // the slices point into the buffer instead of copying it
+  Assert.IsTrue(Person.GetName.Data > PByte(FStream.Memory));
+  Assert.IsTrue(Person.GetName.Data < PByte(FStream.Memory) + FStream.Size);
+end;
+
+procedure TViewTest.TestAbsentFields;
+var
+  Person: TPersonView;
+begin
+  Person := TPersonView.Create(MessageView.Create(nil, 0));
+  Assert.IsFalse(Person.HasName);
+  Assert.AreEqual(0, Person.GetName.Count);
+  Assert.AreEqual('', Person.GetName.ToString);
+  Assert.AreEqual(0, Person.GetId);
+  Assert.IsFalse(Person.HasLastUpdated);
+  Assert.AreEqual<Int64>(0, Person.GetLastUpdated.GetSeconds);
+  Assert.IsFalse(Person.GetPhones.MoveNext);
+end;
+
+procedure TViewTest.TestScalars;
+const
+  COptional: TOptional = (FDouble: 0.5; FFloat: 0.25; FInt64: - 5; FUint32: 4000000000; FSint32: - 3;
+    FSint64: - 300; FFixed32: 7; FSfixed64: - 8; FBool: True; FBytes: [1, 2, 3]; FEnum: TEnum.Value2);
+var
+  Optional: TOptional;
+  View    : TOptionalView;
+begin
+  Optional := COptional;
+  Optional.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  View             := TOptionalView.Create(MessageView.Create(FStream));
+  Assert.AreEqual<Double>(0.5, View.GetDouble);
+  Assert.AreEqual<Single>(0.25, View.GetFloat);
+  Assert.AreEqual<Int64>(- 5, View.GetInt64);
+  Assert.AreEqual<UInt32>(4000000000, View.GetUint32);
+  Assert.AreEqual<SInt32>(- 3, View.GetSint32);
+  Assert.AreEqual<SInt64>(- 300, View.GetSint64);
+  Assert.AreEqual<Fixed32>(7, View.GetFixed32);
+  Assert.AreEqual<SFixed64>(- 8, View.GetSfixed64);
+  Assert.IsTrue(View.GetBool);
+  Assert.AreEqual(3, Length(View.GetBytes.ToBytes));
+  Assert.AreEqual(TEnum.Value2, View.GetEnum);
+  Assert.IsFalse(View.HasInt32);
+end;
+
+procedure TViewTest.TestPackedAndUnpacked;
+const
+  CRepeated: TRepeated = (FSint32: [- 1, 0, 1]);
+  CUnPacked: TUnPacked = (FSint32: [5]);
+var
+  Repeated: TRepeated;
+  UnPacked: TUnPacked;
+  Value   : FieldValue;
+  Values  : TArray<Integer>;
+begin
+  // repeated occurrences of a message are concatenated, with both encodings of the same field
+  Repeated := CRepeated;
+  Repeated.SerializeTo(FWriter);
+  UnPacked := CUnPacked;
+  UnPacked.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  for Value in TRepeatedView.Create(MessageView.Create(FStream)).GetSint32 do
+    Values := Values + [Value.AsSInt32];
+  Assert.AreEqual(4, Length(Values));
+  Assert.AreEqual(- 1, Values[0]);
+  Assert.AreEqual(1, Values[2]);
+  Assert.AreEqual(5, Values[3]);
+end;
+
+procedure TViewTest.TestPackedSingular;
+var
+  Run : Bytes;
+  View: TOptionalView;
+begin
+  // a packed run of a singular field is skipped, as by the generated decoder, instead of being read as its values
+  Run := [5, 7];
+  FWriter.Pack(TWireType.LengthPrefixed, 3);
+  FWriter.Pack(Run);
+  FWriter.Pack(TWireType.VarInt, 5);
+  FWriter.Pack(VarInt(9));
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  View             := TOptionalView.Create(MessageView.Create(FStream));
+  Assert.IsFalse(View.HasInt32);
+  Assert.AreEqual(0, View.GetInt32);
+  Assert.AreEqual<UInt32>(9, View.GetUint32);
+end;
+
+procedure TViewTest.TestLastValueWins;
+const
+  CFirst: TOptional  = (FInt32: 1; FString: 'a');
+  CSecond: TOptional = (FInt32: 2);
+var
+  Optional: TOptional;
+  View    : TOptionalView;
+begin
+  Optional := CFirst;
+  Optional.SerializeTo(FWriter);
+  Optional := CSecond;
+  Optional.SerializeTo(FWriter);
+  FStream.Size     := FStream.Position;
+  FStream.Position := 0;
+  View             := TOptionalView.Create(MessageView.Create(FStream));
+  Assert.AreEqual(2, View.GetInt32);
+  Assert.AreEqual('a', View.GetString.ToString);
+end;
+
+procedure TViewTest.TestTruncated;
+const
+  COptional: TOptional = (FString: 'abc');
+var
+  Optional: TOptional;
+  View    : TOptionalView;
+begin
+  Optional := COptional;
+  Optional.SerializeTo(FWriter);
+  View := TOptionalView.Create(MessageView.Create(FStream.Memory, FStream.Position - 1));
+  Assert.WillRaise(
+    procedure
+    begin
+      View.GetString;
+    end, ESerialError);
+end;
+
+procedure TViewTest.TestTruncatedVarInt;
+const
+  CInt32: array [0 .. 2] of Byte = ($18, $80, $80); // the int32 field, whose value ends after the data
+var
+  View: TOptionalView;
+begin
+  FStream.WriteBuffer(CInt32, SizeOf(CInt32));
+  View := TOptionalView.Create(MessageView.Create(FStream.Memory, FStream.Position));
+  Assert.WillRaise(
+    procedure
+    begin
+      View.GetInt32;
+    end, ESerialError);
+end;
+
+procedure TViewTest.TestTruncatedLength;
+const
+  // the string field, whose length ends after the data, is above High(Int64), or exceeds the data
+  CPrefix: array [0 .. 2] of Byte  = ($72, $FF, $FF);
+  CHuge: array [0 .. 11] of Byte   = ($72, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $01, 0);
+  CTooLong: array [0 .. 2] of Byte = ($72, $05, 0);
+var
+  View: TOptionalView;
+begin
+  FStream.WriteBuffer(CPrefix, SizeOf(CPrefix));
+  View := TOptionalView.Create(MessageView.Create(FStream.Memory, FStream.Position));
+  Assert.WillRaise(
+    procedure
+    begin
+      View.GetString;
+    end, ESerialError);
+  FStream.Position := 0;
+  FStream.WriteBuffer(CHuge, SizeOf(CHuge));
+  View := TOptionalView.Create(MessageView.Create(FStream.Memory, FStream.Position));
+  Assert.WillRaise(
+    procedure
+    begin
+      View.GetString;
+    end, ESerialError);
+  FStream.Position := 0;
+  FStream.WriteBuffer(CTooLong, SizeOf(CTooLong));
+  View := TOptionalView.Create(MessageView.Create(FStream.Memory, FStream.Position));
+  Assert.WillRaise(
+    procedure
+    begin
+      View.GetString;
+    end, ESerialError);
+end;
+
+initialization
+
+TDUnitX.RegisterTestFixture(TViewTest);
+
+end.
@@ -5,7 +5,12 @@ unit Schema.Addressbook.Proto;
 interface
 
 uses
-  Delphi.Serial;
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
 
 type
 
@@ -18,11 +23,45 @@ type
   TPersonPhoneNumber = record
     [Tag(1), Name('number')] FNumber: string;
     [Tag(2), Name('type')] FType: TPersonPhoneType;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TPersonPhoneNumberView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TPersonPhoneNumberView; overload; static;
+    class function Create(const AValue: FieldValue): TPersonPhoneNumberView; overload; static;
+    function HasNumber: Boolean;
+    function GetNumber: ByteSlice;
+    function HasType: Boolean;
+    function GetType: TPersonPhoneType;
   end;
 
   TGoogleProtobufTimestamp = record
     [Tag(1), Name('seconds')] FSeconds: int64;
     [Tag(2), Name('nanos')] FNanos: int32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TGoogleProtobufTimestampView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TGoogleProtobufTimestampView; overload; static;
+    class function Create(const AValue: FieldValue): TGoogleProtobufTimestampView; overload; static;
+    function HasSeconds: Boolean;
+    function GetSeconds: int64;
+    function HasNanos: Boolean;
+    function GetNanos: int32;
   end;
 
   TPerson = record
@@ -31,12 +70,647 @@ type
     [Tag(3), Name('email')] FEmail: string;
     [Tag(4), Name('phones')] FPhones: TArray<TPersonPhoneNumber>;
     [Tag(5), Name('lastUpdated')] FLastUpdated: TGoogleProtobufTimestamp;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TPersonView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TPersonView; overload; static;
+    class function Create(const AValue: FieldValue): TPersonView; overload; static;
+    function HasName: Boolean;
+    function GetName: ByteSlice;
+    function HasId: Boolean;
+    function GetId: int32;
+    function HasEmail: Boolean;
+    function GetEmail: ByteSlice;
+    function GetPhones: FieldCursor;
+    function HasLastUpdated: Boolean;
+    function GetLastUpdated: TGoogleProtobufTimestampView;
   end;
 
   TAddressBook = record
     [Tag(1), Name('people')] FPeople: TArray<TPerson>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TAddressBookView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TAddressBookView; overload; static;
+    class function Create(const AValue: FieldValue): TAddressBookView; overload; static;
+    function GetPeople: FieldCursor;
   end;
 
 implementation
 
+uses
+  Delphi.Serial.Protobuf.Schema;
+
+const
+  CPersonPhoneTypeByValue: array [0 .. 2] of string = (
+    'Mobile',
+    'Home',
+    'Work'
+  );
+
+const
+  CPersonPhoneNumberFieldSeeds: array [0 .. 1] of Int32 = (
+    1, 0
+  );
+  CPersonPhoneNumberFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 1; FName: 'number'),
+    (FValue: 2; FName: 'type')
+  );
+
+class function TPersonPhoneNumber.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CPersonPhoneNumberFieldSeeds, CPersonPhoneNumberFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CGoogleProtobufTimestampFieldSeeds: array [0 .. 1] of Int32 = (
+    2, 0
+  );
+  CGoogleProtobufTimestampFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 1; FName: 'seconds'),
+    (FValue: 2; FName: 'nanos')
+  );
+
+class function TGoogleProtobufTimestamp.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CGoogleProtobufTimestampFieldSeeds, CGoogleProtobufTimestampFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CPersonFieldSeeds: array [0 .. 5] of Int32 = (
+    0, -2, 0, 2, 6, 0
+  );
+  CPersonFieldNames: array [0 .. 5] of NamedValue = (
+    (FValue: 4; FName: 'phones'),
+    (FValue: 2; FName: 'id'),
+    (FValue: 1; FName: 'name'),
+    (FValue: 3; FName: 'email'),
+    (FValue: 5; FName: 'lastUpdated'),
+    (FValue: 5; FName: 'last_updated')
+  );
+
+class function TPerson.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CPersonFieldSeeds, CPersonFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CAddressBookFieldSeeds: array [0 .. 0] of Int32 = (
+    -1
+  );
+  CAddressBookFieldNames: array [0 .. 0] of NamedValue = (
+    (FValue: 1; FName: 'people')
+  );
+
+class function TAddressBook.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CAddressBookFieldSeeds, CAddressBookFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag1LengthPrefixed: EncodedTag = (FBytes: $0A; FCount: 1);
+  CTag2VarInt: EncodedTag = (FBytes: $10; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5LengthPrefixed: EncodedTag = (FBytes: $2A; FCount: 1);
+
+procedure TPersonPhoneNumber.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TPersonPhoneNumber.EncodeTo(AWriter: TWriter);
+begin
+  if FNumber <> '' then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(FNumber, AWriter.NextSize);
+    end;
+  if Ord(FType) <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(Ord(FType)));
+    end;
+end;
+
+function TPersonPhoneNumber.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FNumber <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FNumber));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Ord(FType) <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Ord(FType)));
+    end;
+end;
+
+procedure TPersonPhoneNumber.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FNumber);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FType := TPersonPhoneType(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TGoogleProtobufTimestamp.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TGoogleProtobufTimestamp.EncodeTo(AWriter: TWriter);
+begin
+  if FSeconds <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FSeconds));
+    end;
+  if FNanos <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(FNanos));
+    end;
+end;
+
+function TGoogleProtobufTimestamp.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FSeconds <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FSeconds));
+    end;
+  if FNanos <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FNanos));
+    end;
+end;
+
+procedure TGoogleProtobufTimestamp.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FSeconds := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FNanos := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TPerson.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TPerson.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+  Size: Integer;
+begin
+  if FName <> '' then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(FName, AWriter.NextSize);
+    end;
+  if FId <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(FId));
+    end;
+  if FEmail <> '' then
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(FEmail, AWriter.NextSize);
+    end;
+  for I := 0 to High(FPhones) do
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FPhones[I].EncodeTo(AWriter);
+    end;
+  Size := AWriter.NextSize;
+  if Size > 0 then
+    begin
+      AWriter.Pack(CTag5LengthPrefixed);
+      AWriter.Pack(VarInt(Size));
+      FLastUpdated.EncodeTo(AWriter);
+    end;
+end;
+
+function TPerson.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FName <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FName));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FId <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FId));
+    end;
+  if FEmail <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FEmail));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FPhones) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FPhones[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  Slot := AWriter.ReserveSize;
+  Size := AWriter.StoreSize(Slot, FLastUpdated.ComputeSize(AWriter));
+  if Size > 0 then
+    Inc(Result, 1 + VarInt.ByteCount(Size) + Size)
+  else
+    AWriter.ReleaseSizes(Slot);
+end;
+
+procedure TPerson.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FName);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FId := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FEmail);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FPhones, Length(FPhones) + 1);
+              AReader.BeginLengthPrefixed;
+              FPhones[High(FPhones)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              FLastUpdated.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TAddressBook.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TAddressBook.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  for I := 0 to High(FPeople) do
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FPeople[I].EncodeTo(AWriter);
+    end;
+end;
+
+function TAddressBook.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  for I := 0 to High(FPeople) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FPeople[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TAddressBook.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FPeople, Length(FPeople) + 1);
+              AReader.BeginLengthPrefixed;
+              FPeople[High(FPeople)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+class function TPersonPhoneNumberView.Create(const AMessage: MessageView): TPersonPhoneNumberView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TPersonPhoneNumberView.Create(const AValue: FieldValue): TPersonPhoneNumberView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TPersonPhoneNumberView.HasNumber: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.LengthPrefixed);
+end;
+
+function TPersonPhoneNumberView.GetNumber: ByteSlice;
+begin
+  Result := FMessage.Find(1, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPersonPhoneNumberView.HasType: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TPersonPhoneNumberView.GetType: TPersonPhoneType;
+begin
+  Result := TPersonPhoneType(FMessage.Find(2, TWireType.VarInt).AsInt32);
+end;
+
+class function TGoogleProtobufTimestampView.Create(const AMessage: MessageView): TGoogleProtobufTimestampView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TGoogleProtobufTimestampView.Create(const AValue: FieldValue): TGoogleProtobufTimestampView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TGoogleProtobufTimestampView.HasSeconds: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TGoogleProtobufTimestampView.GetSeconds: int64;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt64;
+end;
+
+function TGoogleProtobufTimestampView.HasNanos: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TGoogleProtobufTimestampView.GetNanos: int32;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsInt32;
+end;
+
+class function TPersonView.Create(const AMessage: MessageView): TPersonView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TPersonView.Create(const AValue: FieldValue): TPersonView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TPersonView.HasName: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.LengthPrefixed);
+end;
+
+function TPersonView.GetName: ByteSlice;
+begin
+  Result := FMessage.Find(1, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPersonView.HasId: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TPersonView.GetId: int32;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsInt32;
+end;
+
+function TPersonView.HasEmail: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.LengthPrefixed);
+end;
+
+function TPersonView.GetEmail: ByteSlice;
+begin
+  Result := FMessage.Find(3, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPersonView.GetPhones: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.LengthPrefixed);
+end;
+
+function TPersonView.HasLastUpdated: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.LengthPrefixed);
+end;
+
+function TPersonView.GetLastUpdated: TGoogleProtobufTimestampView;
+begin
+  Result := TGoogleProtobufTimestampView.Create(FMessage.Find(5, TWireType.LengthPrefixed));
+end;
+
+class function TAddressBookView.Create(const AMessage: MessageView): TAddressBookView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TAddressBookView.Create(const AValue: FieldValue): TAddressBookView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TAddressBookView.GetPeople: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.LengthPrefixed);
+end;
+
+const
+  CSchema: array [0 .. 538] of Byte = (
+    $0A, $77, $0A, $1F, $67, $6F, $6F, $67, $6C, $65, $2F, $70, $72, $6F, $74, $6F,
+    $62, $75, $66, $2F, $74, $69, $6D, $65, $73, $74, $61, $6D, $70, $2E, $70, $72,
+    $6F, $74, $6F, $12, $0F, $67, $6F, $6F, $67, $6C, $65, $2E, $70, $72, $6F, $74,
+    $6F, $62, $75, $66, $22, $3B, $0A, $09, $54, $69, $6D, $65, $73, $74, $61, $6D,
+    $70, $12, $18, $0A, $07, $73, $65, $63, $6F, $6E, $64, $73, $18, $01, $20, $01,
+    $28, $03, $52, $07, $73, $65, $63, $6F, $6E, $64, $73, $12, $14, $0A, $05, $6E,
+    $61, $6E, $6F, $73, $18, $02, $20, $01, $28, $05, $52, $05, $6E, $61, $6E, $6F,
+    $73, $62, $06, $70, $72, $6F, $74, $6F, $33, $0A, $9F, $03, $0A, $18, $73, $63,
+    $68, $65, $6D, $61, $2F, $61, $64, $64, $72, $65, $73, $73, $62, $6F, $6F, $6B,
+    $2E, $70, $72, $6F, $74, $6F, $1A, $1F, $67, $6F, $6F, $67, $6C, $65, $2F, $70,
+    $72, $6F, $74, $6F, $62, $75, $66, $2F, $74, $69, $6D, $65, $73, $74, $61, $6D,
+    $70, $2E, $70, $72, $6F, $74, $6F, $22, $A9, $02, $0A, $06, $50, $65, $72, $73,
+    $6F, $6E, $12, $12, $0A, $04, $6E, $61, $6D, $65, $18, $01, $20, $01, $28, $09,
+    $52, $04, $6E, $61, $6D, $65, $12, $0E, $0A, $02, $69, $64, $18, $02, $20, $01,
+    $28, $05, $52, $02, $69, $64, $12, $14, $0A, $05, $65, $6D, $61, $69, $6C, $18,
+    $03, $20, $01, $28, $09, $52, $05, $65, $6D, $61, $69, $6C, $12, $2B, $0A, $06,
+    $70, $68, $6F, $6E, $65, $73, $18, $04, $20, $03, $28, $0B, $32, $13, $2E, $50,
+    $65, $72, $73, $6F, $6E, $2E, $50, $68, $6F, $6E, $65, $4E, $75, $6D, $62, $65,
+    $72, $52, $06, $70, $68, $6F, $6E, $65, $73, $12, $3D, $0A, $0C, $6C, $61, $73,
+    $74, $5F, $75, $70, $64, $61, $74, $65, $64, $18, $05, $20, $01, $28, $0B, $32,
+    $1A, $2E, $67, $6F, $6F, $67, $6C, $65, $2E, $70, $72, $6F, $74, $6F, $62, $75,
+    $66, $2E, $54, $69, $6D, $65, $73, $74, $61, $6D, $70, $52, $0B, $6C, $61, $73,
+    $74, $55, $70, $64, $61, $74, $65, $64, $1A, $4C, $0A, $0B, $50, $68, $6F, $6E,
+    $65, $4E, $75, $6D, $62, $65, $72, $12, $16, $0A, $06, $6E, $75, $6D, $62, $65,
+    $72, $18, $01, $20, $01, $28, $09, $52, $06, $6E, $75, $6D, $62, $65, $72, $12,
+    $25, $0A, $04, $74, $79, $70, $65, $18, $02, $20, $01, $28, $0E, $32, $11, $2E,
+    $50, $65, $72, $73, $6F, $6E, $2E, $50, $68, $6F, $6E, $65, $54, $79, $70, $65,
+    $52, $04, $74, $79, $70, $65, $22, $2B, $0A, $09, $50, $68, $6F, $6E, $65, $54,
+    $79, $70, $65, $12, $0A, $0A, $06, $4D, $4F, $42, $49, $4C, $45, $10, $00, $12,
+    $08, $0A, $04, $48, $4F, $4D, $45, $10, $01, $12, $08, $0A, $04, $57, $4F, $52,
+    $4B, $10, $02, $22, $2E, $0A, $0B, $41, $64, $64, $72, $65, $73, $73, $42, $6F,
+    $6F, $6B, $12, $1F, $0A, $06, $70, $65, $6F, $70, $6C, $65, $18, $01, $20, $03,
+    $28, $0B, $32, $07, $2E, $50, $65, $72, $73, $6F, $6E, $52, $06, $70, $65, $6F,
+    $70, $6C, $65, $62, $06, $70, $72, $6F, $74, $6F, $33
+  );
+
+initialization
+
+SchemaRegistry.Register(CSchema);
+EnumRegistry.Register(TypeInfo(TPersonPhoneType), CPersonPhoneTypeByValue);
+TPersonPhoneNumber.Table := MessageTable.Create(TypeInfo(TPersonPhoneNumber), [
+  FieldEntry.Create(1, TFieldKind.&String, [], @TPersonPhoneNumber(nil^).FNumber),
+  FieldEntry.Create(2, TFieldKind.Enum8, [], @TPersonPhoneNumber(nil^).FType)]);
+TGoogleProtobufTimestamp.Table := MessageTable.Create(TypeInfo(TGoogleProtobufTimestamp), [
+  FieldEntry.Create(1, TFieldKind.Int64, [], @TGoogleProtobufTimestamp(nil^).FSeconds),
+  FieldEntry.Create(2, TFieldKind.Int32, [], @TGoogleProtobufTimestamp(nil^).FNanos)]);
+TPerson.Table := MessageTable.Create(TypeInfo(TPerson), [
+  FieldEntry.Create(1, TFieldKind.&String, [], @TPerson(nil^).FName),
+  FieldEntry.Create(2, TFieldKind.Int32, [], @TPerson(nil^).FId),
+  FieldEntry.Create(3, TFieldKind.&String, [], @TPerson(nil^).FEmail),
+  FieldEntry.Create(4, TFieldKind.Message, [TFieldFlag.Repeated], @TPerson(nil^).FPhones, TypeInfo(TArray<TPersonPhoneNumber>), @TPersonPhoneNumber.Table),
+  FieldEntry.Create(5, TFieldKind.Message, [], @TPerson(nil^).FLastUpdated, nil, @TGoogleProtobufTimestamp.Table)]);
+TAddressBook.Table := MessageTable.Create(TypeInfo(TAddressBook), [
+  FieldEntry.Create(1, TFieldKind.Message, [TFieldFlag.Repeated], @TAddressBook(nil^).FPeople, TypeInfo(TArray<TPerson>), @TPerson.Table)]);
+
 end.
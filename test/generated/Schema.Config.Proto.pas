@@ -0,0 +1,1303 @@
+unit Schema.Config.Proto;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
+
+type
+
+  TLimit = record
+    [Tag(1), Name('low')] FLow: int32;
+    [Tag(2), Name('high')] FHigh: int32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TLimitView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TLimitView; overload; static;
+    class function Create(const AValue: FieldValue): TLimitView; overload; static;
+    function HasLow: Boolean;
+    function GetLow: int32;
+    function HasHigh: Boolean;
+    function GetHigh: int32;
+  end;
+
+  TConfigSettingsEntry = record
+    [Tag(1), Name('key')] FKey: string;
+    [Tag(2), Name('value')] FValue: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TConfigSettingsEntryView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TConfigSettingsEntryView; overload; static;
+    class function Create(const AValue: FieldValue): TConfigSettingsEntryView; overload; static;
+    function HasKey: Boolean;
+    function GetKey: ByteSlice;
+    function HasValue: Boolean;
+    function GetValue: ByteSlice;
+  end;
+
+  TConfigSettingsMap = record
+    private
+      FEntries: TArray<TConfigSettingsEntry>; // in the order their keys were added
+      FSlots: TArray<Int32>; // one plus the index of the entry whose key hashes to each slot, or zero
+      FIndexed: Integer; // the count of entries in the slots
+      procedure Reindex;
+      procedure EnsureIndexed; inline;
+      function Find(const AKey: string; out ASlot: Integer): Boolean;
+      function GetItem(const AKey: string): string;
+      procedure SetItem(const AKey: string; const AValue: string);
+      function GetCount: Integer;
+      function GetEntries: TArray<TConfigSettingsEntry>;
+    public
+      property Items[const AKey: string]: string read GetItem write SetItem; default;
+      property Count: Integer read GetCount;
+      property Entries: TArray<TConfigSettingsEntry> read GetEntries;
+      function ContainsKey(const AKey: string): Boolean;
+      function TryGetValue(const AKey: string; out AValue: string): Boolean;
+      procedure AddOrSetValue(const AKey: string; const AValue: string);
+      function Remove(const AKey: string): Boolean;
+      procedure Clear;
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TConfigLimitsEntry = record
+    [Tag(1), Name('key')] FKey: int32;
+    [Tag(2), Name('value')] FValue: TLimit;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TConfigLimitsEntryView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TConfigLimitsEntryView; overload; static;
+    class function Create(const AValue: FieldValue): TConfigLimitsEntryView; overload; static;
+    function HasKey: Boolean;
+    function GetKey: int32;
+    function HasValue: Boolean;
+    function GetValue: TLimitView;
+  end;
+
+  TConfigLimitsMap = record
+    private
+      FEntries: TArray<TConfigLimitsEntry>; // in the order their keys were added
+      FSlots: TArray<Int32>; // one plus the index of the entry whose key hashes to each slot, or zero
+      FIndexed: Integer; // the count of entries in the slots
+      procedure Reindex;
+      procedure EnsureIndexed; inline;
+      function Find(const AKey: int32; out ASlot: Integer): Boolean;
+      function GetItem(const AKey: int32): TLimit;
+      procedure SetItem(const AKey: int32; const AValue: TLimit);
+      function GetCount: Integer;
+      function GetEntries: TArray<TConfigLimitsEntry>;
+    public
+      property Items[const AKey: int32]: TLimit read GetItem write SetItem; default;
+      property Count: Integer read GetCount;
+      property Entries: TArray<TConfigLimitsEntry> read GetEntries;
+      function ContainsKey(const AKey: int32): Boolean;
+      function TryGetValue(const AKey: int32; out AValue: TLimit): Boolean;
+      procedure AddOrSetValue(const AKey: int32; const AValue: TLimit);
+      function Remove(const AKey: int32): Boolean;
+      procedure Clear;
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TConfigFlagsEntry = record
+    [Tag(1), Name('key')] FKey: sint64;
+    [Tag(2), Name('value')] FValue: bool;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TConfigFlagsEntryView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TConfigFlagsEntryView; overload; static;
+    class function Create(const AValue: FieldValue): TConfigFlagsEntryView; overload; static;
+    function HasKey: Boolean;
+    function GetKey: sint64;
+    function HasValue: Boolean;
+    function GetValue: bool;
+  end;
+
+  TConfigFlagsMap = record
+    private
+      FEntries: TArray<TConfigFlagsEntry>; // in the order their keys were added
+      FSlots: TArray<Int32>; // one plus the index of the entry whose key hashes to each slot, or zero
+      FIndexed: Integer; // the count of entries in the slots
+      procedure Reindex;
+      procedure EnsureIndexed; inline;
+      function Find(const AKey: sint64; out ASlot: Integer): Boolean;
+      function GetItem(const AKey: sint64): bool;
+      procedure SetItem(const AKey: sint64; const AValue: bool);
+      function GetCount: Integer;
+      function GetEntries: TArray<TConfigFlagsEntry>;
+    public
+      property Items[const AKey: sint64]: bool read GetItem write SetItem; default;
+      property Count: Integer read GetCount;
+      property Entries: TArray<TConfigFlagsEntry> read GetEntries;
+      function ContainsKey(const AKey: sint64): Boolean;
+      function TryGetValue(const AKey: sint64; out AValue: bool): Boolean;
+      procedure AddOrSetValue(const AKey: sint64; const AValue: bool);
+      function Remove(const AKey: sint64): Boolean;
+      procedure Clear;
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TConfig = record
+    [Tag(1), Name('settings')] FSettings: TConfigSettingsMap;
+    [Tag(2), Name('limits')] FLimits: TConfigLimitsMap;
+    [Tag(3), Name('flags')] FFlags: TConfigFlagsMap;
+    [Tag(4), Name('name')] FName: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TConfigView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TConfigView; overload; static;
+    class function Create(const AValue: FieldValue): TConfigView; overload; static;
+    function GetSettings: FieldCursor;
+    function GetLimits: FieldCursor;
+    function GetFlags: FieldCursor;
+    function HasName: Boolean;
+    function GetName: ByteSlice;
+  end;
+
+implementation
+
+const
+  CLimitFieldSeeds: array [0 .. 1] of Int32 = (
+    1, 0
+  );
+  CLimitFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 2; FName: 'high'),
+    (FValue: 1; FName: 'low')
+  );
+
+class function TLimit.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CLimitFieldSeeds, CLimitFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CConfigSettingsEntryFieldSeeds: array [0 .. 1] of Int32 = (
+    3, 0
+  );
+  CConfigSettingsEntryFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 2; FName: 'value'),
+    (FValue: 1; FName: 'key')
+  );
+
+class function TConfigSettingsEntry.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CConfigSettingsEntryFieldSeeds, CConfigSettingsEntryFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CConfigLimitsEntryFieldSeeds: array [0 .. 1] of Int32 = (
+    3, 0
+  );
+  CConfigLimitsEntryFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 2; FName: 'value'),
+    (FValue: 1; FName: 'key')
+  );
+
+class function TConfigLimitsEntry.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CConfigLimitsEntryFieldSeeds, CConfigLimitsEntryFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CConfigFlagsEntryFieldSeeds: array [0 .. 1] of Int32 = (
+    3, 0
+  );
+  CConfigFlagsEntryFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 2; FName: 'value'),
+    (FValue: 1; FName: 'key')
+  );
+
+class function TConfigFlagsEntry.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CConfigFlagsEntryFieldSeeds, CConfigFlagsEntryFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CConfigFieldSeeds: array [0 .. 3] of Int32 = (
+    0, 1, 10, 0
+  );
+  CConfigFieldNames: array [0 .. 3] of NamedValue = (
+    (FValue: 1; FName: 'settings'),
+    (FValue: 3; FName: 'flags'),
+    (FValue: 2; FName: 'limits'),
+    (FValue: 4; FName: 'name')
+  );
+
+class function TConfig.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CConfigFieldSeeds, CConfigFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+procedure TConfigSettingsMap.Reindex;
+var
+  I: Integer;
+  Count: Integer;
+  Slot: Integer;
+begin
+  // a key found twice keeps the position of its first entry and the value of its last one, as in protobuf
+  SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+  FSlots := nil;
+  SetLength(FSlots, MapHash.SlotCount(Length(FEntries)));
+  Count := 0;
+  for I := 0 to High(FEntries) do
+    if Find(FEntries[I].FKey, Slot) then
+      FEntries[FSlots[Slot] - 1].FValue := FEntries[I].FValue
+    else
+      begin
+        if Count < I then
+          FEntries[Count] := FEntries[I];
+        Inc(Count);
+        FSlots[Slot] := Count;
+      end;
+  SetLength(FEntries, Count);
+  FIndexed := Count;
+end;
+
+procedure TConfigSettingsMap.EnsureIndexed;
+begin
+  if FIndexed <> Length(FEntries) then
+    Reindex; // entries were appended by a table-driven or native decoder
+end;
+
+function TConfigSettingsMap.Find(const AKey: string; out ASlot: Integer): Boolean;
+var
+  Index: Integer;
+begin
+  if FSlots = nil then
+    Exit(False);
+  ASlot := MapHash.Hash(AKey) and High(FSlots);
+  Index := FSlots[ASlot];
+  while Index <> 0 do
+    begin
+      if FEntries[Index - 1].FKey = AKey then
+        Exit(True);
+      ASlot := (ASlot + 1) and High(FSlots);
+      Index := FSlots[ASlot];
+    end;
+  Result := False;
+end;
+
+function TConfigSettingsMap.GetItem(const AKey: string): string;
+begin
+  TryGetValue(AKey, Result); // an absent key reads as the default value, as in protobuf
+end;
+
+procedure TConfigSettingsMap.SetItem(const AKey: string; const AValue: string);
+begin
+  AddOrSetValue(AKey, AValue);
+end;
+
+function TConfigSettingsMap.GetCount: Integer;
+begin
+  EnsureIndexed;
+  Result := Length(FEntries);
+end;
+
+function TConfigSettingsMap.GetEntries: TArray<TConfigSettingsEntry>;
+begin
+  EnsureIndexed;
+  Result := FEntries;
+end;
+
+function TConfigSettingsMap.ContainsKey(const AKey: string): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+end;
+
+function TConfigSettingsMap.TryGetValue(const AKey: string; out AValue: string): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    AValue := FEntries[FSlots[Slot] - 1].FValue
+  else
+    AValue := Default(string);
+end;
+
+procedure TConfigSettingsMap.AddOrSetValue(const AKey: string; const AValue: string);
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  if Find(AKey, Slot) then
+    begin
+      SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+      FEntries[FSlots[Slot] - 1].FValue := AValue;
+      Exit;
+    end;
+  SetLength(FEntries, Length(FEntries) + 1);
+  FEntries[High(FEntries)].FKey := AKey;
+  FEntries[High(FEntries)].FValue := AValue;
+  if 2 * Length(FEntries) > Length(FSlots) then
+    Reindex // grows the slots, so that at most half of them are in use
+  else
+    begin
+      SetLength(FSlots, Length(FSlots)); // copies the slots if they are shared
+      FSlots[Slot] := Length(FEntries);
+      FIndexed := Length(FEntries);
+    end;
+end;
+
+function TConfigSettingsMap.Remove(const AKey: string): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    begin
+      // the other entries keep their order, and the slots are rebuilt since their indexes change
+      SetLength(FEntries, Length(FEntries));
+      Delete(FEntries, FSlots[Slot] - 1, 1);
+      Reindex;
+    end;
+end;
+
+procedure TConfigSettingsMap.Clear;
+begin
+  FEntries := nil;
+  FSlots := nil;
+  FIndexed := 0;
+end;
+
+procedure TConfigSettingsMap.MergeFrom(AReader: TReader);
+var
+  Entry: TConfigSettingsEntry;
+begin
+  Entry := Default(TConfigSettingsEntry);
+  AReader.BeginLengthPrefixed;
+  Entry.ParseFrom(AReader);
+  AReader.EndLengthPrefixed;
+  AddOrSetValue(Entry.FKey, Entry.FValue);
+end;
+
+procedure TConfigLimitsMap.Reindex;
+var
+  I: Integer;
+  Count: Integer;
+  Slot: Integer;
+begin
+  // a key found twice keeps the position of its first entry and the value of its last one, as in protobuf
+  SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+  FSlots := nil;
+  SetLength(FSlots, MapHash.SlotCount(Length(FEntries)));
+  Count := 0;
+  for I := 0 to High(FEntries) do
+    if Find(FEntries[I].FKey, Slot) then
+      FEntries[FSlots[Slot] - 1].FValue := FEntries[I].FValue
+    else
+      begin
+        if Count < I then
+          FEntries[Count] := FEntries[I];
+        Inc(Count);
+        FSlots[Slot] := Count;
+      end;
+  SetLength(FEntries, Count);
+  FIndexed := Count;
+end;
+
+procedure TConfigLimitsMap.EnsureIndexed;
+begin
+  if FIndexed <> Length(FEntries) then
+    Reindex; // entries were appended by a table-driven or native decoder
+end;
+
+function TConfigLimitsMap.Find(const AKey: int32; out ASlot: Integer): Boolean;
+var
+  Index: Integer;
+begin
+  if FSlots = nil then
+    Exit(False);
+  ASlot := MapHash.Hash(UInt64(AKey)) and High(FSlots);
+  Index := FSlots[ASlot];
+  while Index <> 0 do
+    begin
+      if FEntries[Index - 1].FKey = AKey then
+        Exit(True);
+      ASlot := (ASlot + 1) and High(FSlots);
+      Index := FSlots[ASlot];
+    end;
+  Result := False;
+end;
+
+function TConfigLimitsMap.GetItem(const AKey: int32): TLimit;
+begin
+  TryGetValue(AKey, Result); // an absent key reads as the default value, as in protobuf
+end;
+
+procedure TConfigLimitsMap.SetItem(const AKey: int32; const AValue: TLimit);
+begin
+  AddOrSetValue(AKey, AValue);
+end;
+
+function TConfigLimitsMap.GetCount: Integer;
+begin
+  EnsureIndexed;
+  Result := Length(FEntries);
+end;
+
+function TConfigLimitsMap.GetEntries: TArray<TConfigLimitsEntry>;
+begin
+  EnsureIndexed;
+  Result := FEntries;
+end;
+
+function TConfigLimitsMap.ContainsKey(const AKey: int32): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+end;
+
+function TConfigLimitsMap.TryGetValue(const AKey: int32; out AValue: TLimit): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    AValue := FEntries[FSlots[Slot] - 1].FValue
+  else
+    AValue := Default(TLimit);
+end;
+
+procedure TConfigLimitsMap.AddOrSetValue(const AKey: int32; const AValue: TLimit);
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  if Find(AKey, Slot) then
+    begin
+      SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+      FEntries[FSlots[Slot] - 1].FValue := AValue;
+      Exit;
+    end;
+  SetLength(FEntries, Length(FEntries) + 1);
+  FEntries[High(FEntries)].FKey := AKey;
+  FEntries[High(FEntries)].FValue := AValue;
+  if 2 * Length(FEntries) > Length(FSlots) then
+    Reindex // grows the slots, so that at most half of them are in use
+  else
+    begin
+      SetLength(FSlots, Length(FSlots)); // copies the slots if they are shared
+      FSlots[Slot] := Length(FEntries);
+      FIndexed := Length(FEntries);
+    end;
+end;
+
+function TConfigLimitsMap.Remove(const AKey: int32): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    begin
+      // the other entries keep their order, and the slots are rebuilt since their indexes change
+      SetLength(FEntries, Length(FEntries));
+      Delete(FEntries, FSlots[Slot] - 1, 1);
+      Reindex;
+    end;
+end;
+
+procedure TConfigLimitsMap.Clear;
+begin
+  FEntries := nil;
+  FSlots := nil;
+  FIndexed := 0;
+end;
+
+procedure TConfigLimitsMap.MergeFrom(AReader: TReader);
+var
+  Entry: TConfigLimitsEntry;
+begin
+  Entry := Default(TConfigLimitsEntry);
+  AReader.BeginLengthPrefixed;
+  Entry.ParseFrom(AReader);
+  AReader.EndLengthPrefixed;
+  AddOrSetValue(Entry.FKey, Entry.FValue);
+end;
+
+procedure TConfigFlagsMap.Reindex;
+var
+  I: Integer;
+  Count: Integer;
+  Slot: Integer;
+begin
+  // a key found twice keeps the position of its first entry and the value of its last one, as in protobuf
+  SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+  FSlots := nil;
+  SetLength(FSlots, MapHash.SlotCount(Length(FEntries)));
+  Count := 0;
+  for I := 0 to High(FEntries) do
+    if Find(FEntries[I].FKey, Slot) then
+      FEntries[FSlots[Slot] - 1].FValue := FEntries[I].FValue
+    else
+      begin
+        if Count < I then
+          FEntries[Count] := FEntries[I];
+        Inc(Count);
+        FSlots[Slot] := Count;
+      end;
+  SetLength(FEntries, Count);
+  FIndexed := Count;
+end;
+
+procedure TConfigFlagsMap.EnsureIndexed;
+begin
+  if FIndexed <> Length(FEntries) then
+    Reindex; // entries were appended by a table-driven or native decoder
+end;
+
+function TConfigFlagsMap.Find(const AKey: sint64; out ASlot: Integer): Boolean;
+var
+  Index: Integer;
+begin
+  if FSlots = nil then
+    Exit(False);
+  ASlot := MapHash.Hash(UInt64(AKey)) and High(FSlots);
+  Index := FSlots[ASlot];
+  while Index <> 0 do
+    begin
+      if FEntries[Index - 1].FKey = AKey then
+        Exit(True);
+      ASlot := (ASlot + 1) and High(FSlots);
+      Index := FSlots[ASlot];
+    end;
+  Result := False;
+end;
+
+function TConfigFlagsMap.GetItem(const AKey: sint64): bool;
+begin
+  TryGetValue(AKey, Result); // an absent key reads as the default value, as in protobuf
+end;
+
+procedure TConfigFlagsMap.SetItem(const AKey: sint64; const AValue: bool);
+begin
+  AddOrSetValue(AKey, AValue);
+end;
+
+function TConfigFlagsMap.GetCount: Integer;
+begin
+  EnsureIndexed;
+  Result := Length(FEntries);
+end;
+
+function TConfigFlagsMap.GetEntries: TArray<TConfigFlagsEntry>;
+begin
+  EnsureIndexed;
+  Result := FEntries;
+end;
+
+function TConfigFlagsMap.ContainsKey(const AKey: sint64): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+end;
+
+function TConfigFlagsMap.TryGetValue(const AKey: sint64; out AValue: bool): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    AValue := FEntries[FSlots[Slot] - 1].FValue
+  else
+    AValue := Default(bool);
+end;
+
+procedure TConfigFlagsMap.AddOrSetValue(const AKey: sint64; const AValue: bool);
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  if Find(AKey, Slot) then
+    begin
+      SetLength(FEntries, Length(FEntries)); // copies the entries if they are shared
+      FEntries[FSlots[Slot] - 1].FValue := AValue;
+      Exit;
+    end;
+  SetLength(FEntries, Length(FEntries) + 1);
+  FEntries[High(FEntries)].FKey := AKey;
+  FEntries[High(FEntries)].FValue := AValue;
+  if 2 * Length(FEntries) > Length(FSlots) then
+    Reindex // grows the slots, so that at most half of them are in use
+  else
+    begin
+      SetLength(FSlots, Length(FSlots)); // copies the slots if they are shared
+      FSlots[Slot] := Length(FEntries);
+      FIndexed := Length(FEntries);
+    end;
+end;
+
+function TConfigFlagsMap.Remove(const AKey: sint64): Boolean;
+var
+  Slot: Integer;
+begin
+  EnsureIndexed;
+  Result := Find(AKey, Slot);
+  if Result then
+    begin
+      // the other entries keep their order, and the slots are rebuilt since their indexes change
+      SetLength(FEntries, Length(FEntries));
+      Delete(FEntries, FSlots[Slot] - 1, 1);
+      Reindex;
+    end;
+end;
+
+procedure TConfigFlagsMap.Clear;
+begin
+  FEntries := nil;
+  FSlots := nil;
+  FIndexed := 0;
+end;
+
+procedure TConfigFlagsMap.MergeFrom(AReader: TReader);
+var
+  Entry: TConfigFlagsEntry;
+begin
+  Entry := Default(TConfigFlagsEntry);
+  AReader.BeginLengthPrefixed;
+  Entry.ParseFrom(AReader);
+  AReader.EndLengthPrefixed;
+  AddOrSetValue(Entry.FKey, Entry.FValue);
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag1LengthPrefixed: EncodedTag = (FBytes: $0A; FCount: 1);
+  CTag2VarInt: EncodedTag = (FBytes: $10; FCount: 1);
+  CTag2LengthPrefixed: EncodedTag = (FBytes: $12; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+
+procedure TLimit.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TLimit.EncodeTo(AWriter: TWriter);
+begin
+  if FLow <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FLow));
+    end;
+  if FHigh <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(FHigh));
+    end;
+end;
+
+function TLimit.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FLow <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FLow));
+    end;
+  if FHigh <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FHigh));
+    end;
+end;
+
+procedure TLimit.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FLow := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FHigh := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TConfigSettingsEntry.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TConfigSettingsEntry.EncodeTo(AWriter: TWriter);
+begin
+  if FKey <> '' then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(FKey, AWriter.NextSize);
+    end;
+  if FValue <> '' then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(FValue, AWriter.NextSize);
+    end;
+end;
+
+function TConfigSettingsEntry.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FKey <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FKey));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FValue <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FValue));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TConfigSettingsEntry.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FKey);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TConfigLimitsEntry.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TConfigLimitsEntry.EncodeTo(AWriter: TWriter);
+var
+  Size: Integer;
+begin
+  if FKey <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FKey));
+    end;
+  Size := AWriter.NextSize;
+  if Size > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(Size));
+      FValue.EncodeTo(AWriter);
+    end;
+end;
+
+function TConfigLimitsEntry.ComputeSize(AWriter: TWriter): Integer;
+var
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FKey <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FKey));
+    end;
+  Slot := AWriter.ReserveSize;
+  Size := AWriter.StoreSize(Slot, FValue.ComputeSize(AWriter));
+  if Size > 0 then
+    Inc(Result, 1 + VarInt.ByteCount(Size) + Size)
+  else
+    AWriter.ReleaseSizes(Slot);
+end;
+
+procedure TConfigLimitsEntry.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FKey := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              FValue.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TConfigFlagsEntry.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TConfigFlagsEntry.EncodeTo(AWriter: TWriter);
+begin
+  if FKey <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(SignedInt(Int64(FKey)));
+    end;
+  if FValue then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(Ord(FValue)));
+    end;
+end;
+
+function TConfigFlagsEntry.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FKey <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FKey)));
+    end;
+  if FValue then
+    begin
+      Inc(Result, 1 + 1);
+    end;
+end;
+
+procedure TConfigFlagsEntry.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FKey := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FValue := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TConfig.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TConfig.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  for I := 0 to High(FSettings.FEntries) do
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FSettings.FEntries[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FLimits.FEntries) do
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FLimits.FEntries[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FFlags.FEntries) do
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FFlags.FEntries[I].EncodeTo(AWriter);
+    end;
+  if FName <> '' then
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(FName, AWriter.NextSize);
+    end;
+end;
+
+function TConfig.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  FSettings.EnsureIndexed;
+  for I := 0 to High(FSettings.FEntries) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FSettings.FEntries[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  FLimits.EnsureIndexed;
+  for I := 0 to High(FLimits.FEntries) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FLimits.FEntries[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  FFlags.EnsureIndexed;
+  for I := 0 to High(FFlags.FEntries) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FFlags.FEntries[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FName <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FName));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TConfig.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FSettings.MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FLimits.MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FFlags.MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FName);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+class function TLimitView.Create(const AMessage: MessageView): TLimitView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TLimitView.Create(const AValue: FieldValue): TLimitView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TLimitView.HasLow: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TLimitView.GetLow: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TLimitView.HasHigh: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TLimitView.GetHigh: int32;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsInt32;
+end;
+
+class function TConfigSettingsEntryView.Create(const AMessage: MessageView): TConfigSettingsEntryView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TConfigSettingsEntryView.Create(const AValue: FieldValue): TConfigSettingsEntryView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TConfigSettingsEntryView.HasKey: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.LengthPrefixed);
+end;
+
+function TConfigSettingsEntryView.GetKey: ByteSlice;
+begin
+  Result := FMessage.Find(1, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TConfigSettingsEntryView.HasValue: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TConfigSettingsEntryView.GetValue: ByteSlice;
+begin
+  Result := FMessage.Find(2, TWireType.LengthPrefixed).AsSlice;
+end;
+
+class function TConfigLimitsEntryView.Create(const AMessage: MessageView): TConfigLimitsEntryView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TConfigLimitsEntryView.Create(const AValue: FieldValue): TConfigLimitsEntryView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TConfigLimitsEntryView.HasKey: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TConfigLimitsEntryView.GetKey: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TConfigLimitsEntryView.HasValue: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TConfigLimitsEntryView.GetValue: TLimitView;
+begin
+  Result := TLimitView.Create(FMessage.Find(2, TWireType.LengthPrefixed));
+end;
+
+class function TConfigFlagsEntryView.Create(const AMessage: MessageView): TConfigFlagsEntryView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TConfigFlagsEntryView.Create(const AValue: FieldValue): TConfigFlagsEntryView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TConfigFlagsEntryView.HasKey: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TConfigFlagsEntryView.GetKey: sint64;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsSInt64;
+end;
+
+function TConfigFlagsEntryView.HasValue: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TConfigFlagsEntryView.GetValue: bool;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsBoolean;
+end;
+
+class function TConfigView.Create(const AMessage: MessageView): TConfigView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TConfigView.Create(const AValue: FieldValue): TConfigView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TConfigView.GetSettings: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.LengthPrefixed);
+end;
+
+function TConfigView.GetLimits: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.LengthPrefixed);
+end;
+
+function TConfigView.GetFlags: FieldCursor;
+begin
+  Result := FMessage.Values(3, TWireType.LengthPrefixed);
+end;
+
+function TConfigView.HasName: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.LengthPrefixed);
+end;
+
+function TConfigView.GetName: ByteSlice;
+begin
+  Result := FMessage.Find(4, TWireType.LengthPrefixed).AsSlice;
+end;
+
+initialization
+
+TLimit.Table := MessageTable.Create(TypeInfo(TLimit), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TLimit(nil^).FLow),
+  FieldEntry.Create(2, TFieldKind.Int32, [], @TLimit(nil^).FHigh)]);
+TConfigSettingsEntry.Table := MessageTable.Create(TypeInfo(TConfigSettingsEntry), [
+  FieldEntry.Create(1, TFieldKind.&String, [], @TConfigSettingsEntry(nil^).FKey),
+  FieldEntry.Create(2, TFieldKind.&String, [], @TConfigSettingsEntry(nil^).FValue)]);
+TConfigLimitsEntry.Table := MessageTable.Create(TypeInfo(TConfigLimitsEntry), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TConfigLimitsEntry(nil^).FKey),
+  FieldEntry.Create(2, TFieldKind.Message, [], @TConfigLimitsEntry(nil^).FValue, nil, @TLimit.Table)]);
+TConfigFlagsEntry.Table := MessageTable.Create(TypeInfo(TConfigFlagsEntry), [
+  FieldEntry.Create(1, TFieldKind.SInt64, [], @TConfigFlagsEntry(nil^).FKey),
+  FieldEntry.Create(2, TFieldKind.Bool, [], @TConfigFlagsEntry(nil^).FValue)]);
+TConfig.Table := MessageTable.Create(TypeInfo(TConfig), [
+  FieldEntry.Create(1, TFieldKind.Message, [TFieldFlag.Repeated], @TConfig(nil^).FSettings, TypeInfo(TArray<TConfigSettingsEntry>), @TConfigSettingsEntry.Table),
+  FieldEntry.Create(2, TFieldKind.Message, [TFieldFlag.Repeated], @TConfig(nil^).FLimits, TypeInfo(TArray<TConfigLimitsEntry>), @TConfigLimitsEntry.Table),
+  FieldEntry.Create(3, TFieldKind.Message, [TFieldFlag.Repeated], @TConfig(nil^).FFlags, TypeInfo(TArray<TConfigFlagsEntry>), @TConfigFlagsEntry.Table),
+  FieldEntry.Create(4, TFieldKind.&String, [], @TConfig(nil^).FName)]);
+
+end.
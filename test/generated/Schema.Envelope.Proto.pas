@@ -0,0 +1,691 @@
+unit Schema.Envelope.Proto;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
+
+type
+
+  TMotion = record
+    [Tag(1), Name('x')] FX: double;
+    [Tag(2), Name('y')] FY: double;
+    [Tag(3), Name('time')] FTime: sint64;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TMotionView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TMotionView; overload; static;
+    class function Create(const AValue: FieldValue): TMotionView; overload; static;
+    function HasX: Boolean;
+    function GetX: double;
+    function HasY: Boolean;
+    function GetY: double;
+    function HasTime: Boolean;
+    function GetTime: sint64;
+  end;
+
+  TRemark = record
+    [Tag(1), Name('text')] FText: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TRemarkView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TRemarkView; overload; static;
+    class function Create(const AValue: FieldValue): TRemarkView; overload; static;
+    function HasText: Boolean;
+    function GetText: ByteSlice;
+  end;
+
+  TEnvelopeEventCase = (
+    &EnvelopeEventUnspecified = 0,
+    &EnvelopeNote = 1,
+    &EnvelopeRemark = 2,
+    &EnvelopeMove = 3,
+    &EnvelopePing = 4,
+    &EnvelopeClick = 5,
+    &EnvelopeCode = 6
+  );
+
+  TEnvelope = record
+    [Tag(1), Name('id')] FId: fixed64;
+    [Oneof] FEvent: record
+      [Oneof] FCase: TEnvelopeEventCase;
+      [Tag(3), Name('note')] FNote: string;
+      [Tag(4), Name('remark')] FRemark: TRemark;
+      case Byte of
+        3: ([Tag(2), Name('move')] FMove: TMotion);
+        4: ([Tag(5), Name('ping')] FPing: bool);
+        5: ([Tag(6), Name('click')] FClick: TMotion);
+        6: ([Tag(7), Name('code')] FCode: int32);
+    end;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TEnvelopeView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TEnvelopeView; overload; static;
+    class function Create(const AValue: FieldValue): TEnvelopeView; overload; static;
+    function HasId: Boolean;
+    function GetId: fixed64;
+    function HasMove: Boolean;
+    function GetMove: TMotionView;
+    function HasNote: Boolean;
+    function GetNote: ByteSlice;
+    function HasRemark: Boolean;
+    function GetRemark: TRemarkView;
+    function HasPing: Boolean;
+    function GetPing: bool;
+    function HasClick: Boolean;
+    function GetClick: TMotionView;
+    function HasCode: Boolean;
+    function GetCode: int32;
+  end;
+
+implementation
+
+const
+  CMotionFieldSeeds: array [0 .. 2] of Int32 = (
+    0, -1, 214
+  );
+  CMotionFieldNames: array [0 .. 2] of NamedValue = (
+    (FValue: 3; FName: 'time'),
+    (FValue: 2; FName: 'y'),
+    (FValue: 1; FName: 'x')
+  );
+
+class function TMotion.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CMotionFieldSeeds, CMotionFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CRemarkFieldSeeds: array [0 .. 0] of Int32 = (
+    -1
+  );
+  CRemarkFieldNames: array [0 .. 0] of NamedValue = (
+    (FValue: 1; FName: 'text')
+  );
+
+class function TRemark.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CRemarkFieldSeeds, CRemarkFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CEnvelopeFieldSeeds: array [0 .. 6] of Int32 = (
+    1, -1, -5, -7, 0, 0, 3
+  );
+  CEnvelopeFieldNames: array [0 .. 6] of NamedValue = (
+    (FValue: 1; FName: 'id'),
+    (FValue: 4; FName: 'remark'),
+    (FValue: 7; FName: 'code'),
+    (FValue: 5; FName: 'ping'),
+    (FValue: 6; FName: 'click'),
+    (FValue: 2; FName: 'move'),
+    (FValue: 3; FName: 'note')
+  );
+
+class function TEnvelope.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CEnvelopeFieldSeeds, CEnvelopeFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CTag1Fixed64: EncodedTag = (FBytes: $09; FCount: 1);
+  CTag1LengthPrefixed: EncodedTag = (FBytes: $0A; FCount: 1);
+  CTag2Fixed64: EncodedTag = (FBytes: $11; FCount: 1);
+  CTag2LengthPrefixed: EncodedTag = (FBytes: $12; FCount: 1);
+  CTag3VarInt: EncodedTag = (FBytes: $18; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5VarInt: EncodedTag = (FBytes: $28; FCount: 1);
+  CTag6LengthPrefixed: EncodedTag = (FBytes: $32; FCount: 1);
+  CTag7VarInt: EncodedTag = (FBytes: $38; FCount: 1);
+
+procedure TMotion.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TMotion.EncodeTo(AWriter: TWriter);
+begin
+  if FX <> 0 then
+    begin
+      AWriter.Pack(CTag1Fixed64);
+      AWriter.Pack(FixedInt64(FX));
+    end;
+  if FY <> 0 then
+    begin
+      AWriter.Pack(CTag2Fixed64);
+      AWriter.Pack(FixedInt64(FY));
+    end;
+  if FTime <> 0 then
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(SignedInt(Int64(FTime)));
+    end;
+end;
+
+function TMotion.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FX <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FY <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FTime <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FTime)));
+    end;
+end;
+
+procedure TMotion.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FX := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FY := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FTime := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TRemark.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TRemark.EncodeTo(AWriter: TWriter);
+begin
+  if FText <> '' then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(FText, AWriter.NextSize);
+    end;
+end;
+
+function TRemark.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FText <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FText));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TRemark.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FText);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TEnvelope.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TEnvelope.EncodeTo(AWriter: TWriter);
+begin
+  if FId <> 0 then
+    begin
+      AWriter.Pack(CTag1Fixed64);
+      AWriter.Pack(FixedInt64(UInt64(FId)));
+    end;
+  case Ord(FEvent.FCase) of
+    1:
+      begin
+        AWriter.Pack(CTag3LengthPrefixed);
+        AWriter.Pack(FEvent.FNote, AWriter.NextSize);
+      end;
+    2:
+      begin
+        AWriter.Pack(CTag4LengthPrefixed);
+        AWriter.Pack(VarInt(AWriter.NextSize));
+        FEvent.FRemark.EncodeTo(AWriter);
+      end;
+    3:
+      begin
+        AWriter.Pack(CTag2LengthPrefixed);
+        AWriter.Pack(VarInt(AWriter.NextSize));
+        FEvent.FMove.EncodeTo(AWriter);
+      end;
+    4:
+      begin
+        AWriter.Pack(CTag5VarInt);
+        AWriter.Pack(VarInt(Ord(FEvent.FPing)));
+      end;
+    5:
+      begin
+        AWriter.Pack(CTag6LengthPrefixed);
+        AWriter.Pack(VarInt(AWriter.NextSize));
+        FEvent.FClick.EncodeTo(AWriter);
+      end;
+    6:
+      begin
+        AWriter.Pack(CTag7VarInt);
+        AWriter.Pack(VarInt(FEvent.FCode));
+      end;
+  end;
+end;
+
+function TEnvelope.ComputeSize(AWriter: TWriter): Integer;
+var
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FId <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  case Ord(FEvent.FCase) of
+    1:
+      begin
+        Size := AWriter.StoreSize(TWriter.ByteCount(FEvent.FNote));
+        Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+      end;
+    2:
+      begin
+        Slot := AWriter.ReserveSize;
+        Size := AWriter.StoreSize(Slot, FEvent.FRemark.ComputeSize(AWriter));
+        Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+      end;
+    3:
+      begin
+        Slot := AWriter.ReserveSize;
+        Size := AWriter.StoreSize(Slot, FEvent.FMove.ComputeSize(AWriter));
+        Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+      end;
+    4:
+      begin
+        Inc(Result, 1 + 1);
+      end;
+    5:
+      begin
+        Slot := AWriter.ReserveSize;
+        Size := AWriter.StoreSize(Slot, FEvent.FClick.ComputeSize(AWriter));
+        Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+      end;
+    6:
+      begin
+        Inc(Result, 1 + VarInt.ByteCount(FEvent.FCode));
+      end;
+  end;
+end;
+
+procedure TEnvelope.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FId := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopeMove then
+                begin
+                  case FEvent.FCase of
+                    TEnvelopeEventCase.&EnvelopeNote:
+                      FEvent.FNote := Default(string);
+                    TEnvelopeEventCase.&EnvelopeRemark:
+                      FEvent.FRemark := Default(TRemark);
+                  end;
+                  FEvent.FMove := Default(TMotion);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopeMove;
+              AReader.BeginLengthPrefixed;
+              FEvent.FMove.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopeNote then
+                case FEvent.FCase of
+                  TEnvelopeEventCase.&EnvelopeRemark:
+                    FEvent.FRemark := Default(TRemark);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopeNote;
+              AReader.Parse(FEvent.FNote);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopeRemark then
+                case FEvent.FCase of
+                  TEnvelopeEventCase.&EnvelopeNote:
+                    FEvent.FNote := Default(string);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopeRemark;
+              AReader.BeginLengthPrefixed;
+              FEvent.FRemark.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.VarInt then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopePing then
+                case FEvent.FCase of
+                  TEnvelopeEventCase.&EnvelopeNote:
+                    FEvent.FNote := Default(string);
+                  TEnvelopeEventCase.&EnvelopeRemark:
+                    FEvent.FRemark := Default(TRemark);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopePing;
+              AReader.Parse(VarIntValue);
+              FEvent.FPing := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopeClick then
+                begin
+                  case FEvent.FCase of
+                    TEnvelopeEventCase.&EnvelopeNote:
+                      FEvent.FNote := Default(string);
+                    TEnvelopeEventCase.&EnvelopeRemark:
+                      FEvent.FRemark := Default(TRemark);
+                  end;
+                  FEvent.FClick := Default(TMotion);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopeClick;
+              AReader.BeginLengthPrefixed;
+              FEvent.FClick.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              if FEvent.FCase <> TEnvelopeEventCase.&EnvelopeCode then
+                case FEvent.FCase of
+                  TEnvelopeEventCase.&EnvelopeNote:
+                    FEvent.FNote := Default(string);
+                  TEnvelopeEventCase.&EnvelopeRemark:
+                    FEvent.FRemark := Default(TRemark);
+                end;
+              FEvent.FCase := TEnvelopeEventCase.&EnvelopeCode;
+              AReader.Parse(VarIntValue);
+              FEvent.FCode := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+class function TMotionView.Create(const AMessage: MessageView): TMotionView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TMotionView.Create(const AValue: FieldValue): TMotionView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TMotionView.HasX: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.Fixed64);
+end;
+
+function TMotionView.GetX: double;
+begin
+  Result := FMessage.Find(1, TWireType.Fixed64).AsDouble;
+end;
+
+function TMotionView.HasY: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.Fixed64);
+end;
+
+function TMotionView.GetY: double;
+begin
+  Result := FMessage.Find(2, TWireType.Fixed64).AsDouble;
+end;
+
+function TMotionView.HasTime: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TMotionView.GetTime: sint64;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsSInt64;
+end;
+
+class function TRemarkView.Create(const AMessage: MessageView): TRemarkView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TRemarkView.Create(const AValue: FieldValue): TRemarkView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TRemarkView.HasText: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.LengthPrefixed);
+end;
+
+function TRemarkView.GetText: ByteSlice;
+begin
+  Result := FMessage.Find(1, TWireType.LengthPrefixed).AsSlice;
+end;
+
+class function TEnvelopeView.Create(const AMessage: MessageView): TEnvelopeView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TEnvelopeView.Create(const AValue: FieldValue): TEnvelopeView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TEnvelopeView.HasId: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.Fixed64);
+end;
+
+function TEnvelopeView.GetId: fixed64;
+begin
+  Result := FMessage.Find(1, TWireType.Fixed64).AsUInt64;
+end;
+
+function TEnvelopeView.HasMove: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TEnvelopeView.GetMove: TMotionView;
+begin
+  Result := TMotionView.Create(FMessage.Find(2, TWireType.LengthPrefixed));
+end;
+
+function TEnvelopeView.HasNote: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.LengthPrefixed);
+end;
+
+function TEnvelopeView.GetNote: ByteSlice;
+begin
+  Result := FMessage.Find(3, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TEnvelopeView.HasRemark: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.LengthPrefixed);
+end;
+
+function TEnvelopeView.GetRemark: TRemarkView;
+begin
+  Result := TRemarkView.Create(FMessage.Find(4, TWireType.LengthPrefixed));
+end;
+
+function TEnvelopeView.HasPing: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.VarInt);
+end;
+
+function TEnvelopeView.GetPing: bool;
+begin
+  Result := FMessage.Find(5, TWireType.VarInt).AsBoolean;
+end;
+
+function TEnvelopeView.HasClick: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.LengthPrefixed);
+end;
+
+function TEnvelopeView.GetClick: TMotionView;
+begin
+  Result := TMotionView.Create(FMessage.Find(6, TWireType.LengthPrefixed));
+end;
+
+function TEnvelopeView.HasCode: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TEnvelopeView.GetCode: int32;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsInt32;
+end;
+
+initialization
+
+TMotion.Table := MessageTable.Create(TypeInfo(TMotion), [
+  FieldEntry.Create(1, TFieldKind.Double, [], @TMotion(nil^).FX),
+  FieldEntry.Create(2, TFieldKind.Double, [], @TMotion(nil^).FY),
+  FieldEntry.Create(3, TFieldKind.SInt64, [], @TMotion(nil^).FTime)]);
+TRemark.Table := MessageTable.Create(TypeInfo(TRemark), [
+  FieldEntry.Create(1, TFieldKind.&String, [], @TRemark(nil^).FText)]);
+TEnvelope.Table := MessageTable.Create(TypeInfo(TEnvelope), [
+  FieldEntry.Create(1, TFieldKind.Fixed64, [], @TEnvelope(nil^).FId),
+  FieldEntry.Create(2, TFieldKind.Message, [TFieldFlag.Oneof, TFieldFlag.Overlaid], @TEnvelope(nil^).FEvent.FMove, nil, @TMotion.Table, @TEnvelope(nil^).FEvent.FCase, 3),
+  FieldEntry.Create(3, TFieldKind.&String, [TFieldFlag.Oneof], @TEnvelope(nil^).FEvent.FNote, nil, nil, @TEnvelope(nil^).FEvent.FCase, 1),
+  FieldEntry.Create(4, TFieldKind.Message, [TFieldFlag.Oneof], @TEnvelope(nil^).FEvent.FRemark, nil, @TRemark.Table, @TEnvelope(nil^).FEvent.FCase, 2),
+  FieldEntry.Create(5, TFieldKind.Bool, [TFieldFlag.Oneof, TFieldFlag.Overlaid], @TEnvelope(nil^).FEvent.FPing, nil, nil, @TEnvelope(nil^).FEvent.FCase, 4),
+  FieldEntry.Create(6, TFieldKind.Message, [TFieldFlag.Oneof, TFieldFlag.Overlaid], @TEnvelope(nil^).FEvent.FClick, nil, @TMotion.Table, @TEnvelope(nil^).FEvent.FCase, 5),
+  FieldEntry.Create(7, TFieldKind.Int32, [TFieldFlag.Oneof, TFieldFlag.Overlaid], @TEnvelope(nil^).FEvent.FCode, nil, nil, @TEnvelope(nil^).FEvent.FCase, 6)]);
+
+end.
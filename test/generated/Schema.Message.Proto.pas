@@ -5,7 +5,12 @@ unit Schema.Message.Proto;
 interface
 
 uses
-  Delphi.Serial;
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
 
 type
 
@@ -32,6 +37,51 @@ type
     [Tag(14), Name('string')] FString: string;
     [Tag(15), Name('bytes')] FBytes: bytes;
     [Tag(16), Name('enum')] FEnum: TEnum;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TOptionalView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TOptionalView; overload; static;
+    class function Create(const AValue: FieldValue): TOptionalView; overload; static;
+    function HasDouble: Boolean;
+    function GetDouble: double;
+    function HasFloat: Boolean;
+    function GetFloat: float;
+    function HasInt32: Boolean;
+    function GetInt32: int32;
+    function HasInt64: Boolean;
+    function GetInt64: int64;
+    function HasUint32: Boolean;
+    function GetUint32: uint32;
+    function HasUint64: Boolean;
+    function GetUint64: uint64;
+    function HasSint32: Boolean;
+    function GetSint32: sint32;
+    function HasSint64: Boolean;
+    function GetSint64: sint64;
+    function HasFixed32: Boolean;
+    function GetFixed32: fixed32;
+    function HasFixed64: Boolean;
+    function GetFixed64: fixed64;
+    function HasSfixed32: Boolean;
+    function GetSfixed32: sfixed32;
+    function HasSfixed64: Boolean;
+    function GetSfixed64: sfixed64;
+    function HasBool: Boolean;
+    function GetBool: bool;
+    function HasString: Boolean;
+    function GetString: ByteSlice;
+    function HasBytes: Boolean;
+    function GetBytes: ByteSlice;
+    function HasEnum: Boolean;
+    function GetEnum: TEnum;
   end;
 
   TDefault = record
@@ -51,6 +101,51 @@ type
     [Tag(14), Default('a'), Name('string')] FString: string;
     [Tag(15), Default(#171#14), Name('bytes')] FBytes: bytes;
     [Tag(16), Default(2), Name('enum')] FEnum: TEnum;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TDefaultView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TDefaultView; overload; static;
+    class function Create(const AValue: FieldValue): TDefaultView; overload; static;
+    function HasDouble: Boolean;
+    function GetDouble: double;
+    function HasFloat: Boolean;
+    function GetFloat: float;
+    function HasInt32: Boolean;
+    function GetInt32: int32;
+    function HasInt64: Boolean;
+    function GetInt64: int64;
+    function HasUint32: Boolean;
+    function GetUint32: uint32;
+    function HasUint64: Boolean;
+    function GetUint64: uint64;
+    function HasSint32: Boolean;
+    function GetSint32: sint32;
+    function HasSint64: Boolean;
+    function GetSint64: sint64;
+    function HasFixed32: Boolean;
+    function GetFixed32: fixed32;
+    function HasFixed64: Boolean;
+    function GetFixed64: fixed64;
+    function HasSfixed32: Boolean;
+    function GetSfixed32: sfixed32;
+    function HasSfixed64: Boolean;
+    function GetSfixed64: sfixed64;
+    function HasBool: Boolean;
+    function GetBool: bool;
+    function HasString: Boolean;
+    function GetString: ByteSlice;
+    function HasBytes: Boolean;
+    function GetBytes: ByteSlice;
+    function HasEnum: Boolean;
+    function GetEnum: TEnum;
   end;
 
   TRequired = record
@@ -70,6 +165,51 @@ type
     [Tag(14), Required, Name('string')] FString: string;
     [Tag(15), Required, Name('bytes')] FBytes: bytes;
     [Tag(16), Required, Name('enum')] FEnum: TEnum;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TRequiredView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TRequiredView; overload; static;
+    class function Create(const AValue: FieldValue): TRequiredView; overload; static;
+    function HasDouble: Boolean;
+    function GetDouble: double;
+    function HasFloat: Boolean;
+    function GetFloat: float;
+    function HasInt32: Boolean;
+    function GetInt32: int32;
+    function HasInt64: Boolean;
+    function GetInt64: int64;
+    function HasUint32: Boolean;
+    function GetUint32: uint32;
+    function HasUint64: Boolean;
+    function GetUint64: uint64;
+    function HasSint32: Boolean;
+    function GetSint32: sint32;
+    function HasSint64: Boolean;
+    function GetSint64: sint64;
+    function HasFixed32: Boolean;
+    function GetFixed32: fixed32;
+    function HasFixed64: Boolean;
+    function GetFixed64: fixed64;
+    function HasSfixed32: Boolean;
+    function GetSfixed32: sfixed32;
+    function HasSfixed64: Boolean;
+    function GetSfixed64: sfixed64;
+    function HasBool: Boolean;
+    function GetBool: bool;
+    function HasString: Boolean;
+    function GetString: ByteSlice;
+    function HasBytes: Boolean;
+    function GetBytes: ByteSlice;
+    function HasEnum: Boolean;
+    function GetEnum: TEnum;
   end;
 
   TRepeated = record
@@ -89,6 +229,35 @@ type
     [Tag(14), Name('string')] FString: TArray<string>;
     [Tag(15), Name('bytes')] FBytes: TArray<bytes>;
     [Tag(16), Name('enum')] FEnum: TArray<TEnum>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TRepeatedView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TRepeatedView; overload; static;
+    class function Create(const AValue: FieldValue): TRepeatedView; overload; static;
+    function GetDouble: FieldCursor;
+    function GetFloat: FieldCursor;
+    function GetInt32: FieldCursor;
+    function GetInt64: FieldCursor;
+    function GetUint32: FieldCursor;
+    function GetUint64: FieldCursor;
+    function GetSint32: FieldCursor;
+    function GetSint64: FieldCursor;
+    function GetFixed32: FieldCursor;
+    function GetFixed64: FieldCursor;
+    function GetSfixed32: FieldCursor;
+    function GetSfixed64: FieldCursor;
+    function GetBool: FieldCursor;
+    function GetString: FieldCursor;
+    function GetBytes: FieldCursor;
+    function GetEnum: FieldCursor;
   end;
 
   TUnPacked = record
@@ -106,6 +275,33 @@ type
     [Tag(12), UnPacked, Name('sfixed64')] FSfixed64: TArray<sfixed64>;
     [Tag(13), UnPacked, Name('bool')] FBool: TArray<bool>;
     [Tag(16), UnPacked, Name('enum')] FEnum: TArray<TEnum>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TUnPackedView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TUnPackedView; overload; static;
+    class function Create(const AValue: FieldValue): TUnPackedView; overload; static;
+    function GetDouble: FieldCursor;
+    function GetFloat: FieldCursor;
+    function GetInt32: FieldCursor;
+    function GetInt64: FieldCursor;
+    function GetUint32: FieldCursor;
+    function GetUint64: FieldCursor;
+    function GetSint32: FieldCursor;
+    function GetSint64: FieldCursor;
+    function GetFixed32: FieldCursor;
+    function GetFixed64: FieldCursor;
+    function GetSfixed32: FieldCursor;
+    function GetSfixed64: FieldCursor;
+    function GetBool: FieldCursor;
+    function GetEnum: FieldCursor;
   end;
 
   TMessage = record
@@ -114,8 +310,3789 @@ type
     [Tag(3), Name('required')] FRequired: TArray<TRequired>;
     [Tag(4), Name('repeated')] FRepeated: TArray<TRepeated>;
     [Tag(5), Name('unpacked')] FUnpacked: TArray<TUnPacked>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TMessageView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TMessageView; overload; static;
+    class function Create(const AValue: FieldValue): TMessageView; overload; static;
+    function GetOptional: FieldCursor;
+    function GetDefault: FieldCursor;
+    function GetRequired: FieldCursor;
+    function GetRepeated: FieldCursor;
+    function GetUnpacked: FieldCursor;
+  end;
+
+  TSparse = type Int32;
+
+  TSparseHelper = record helper for TSparse
+    const
+      &Minus = TSparse(-1);
+      &Zero = TSparse(0);
+      &Million = TSparse(1000000);
+    function TryGetName(out AName: string): Boolean;
+    class function TryParse(const AName: string; out AValue: TSparse): Boolean; static;
+  end;
+
+  TSparseValues = record
+    [Tag(1), Name('sparse')] FSparse: TSparse;
+    [Tag(2), Name('sparses')] FSparses: TArray<TSparse>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TSparseValuesView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TSparseValuesView; overload; static;
+    class function Create(const AValue: FieldValue): TSparseValuesView; overload; static;
+    function HasSparse: Boolean;
+    function GetSparse: TSparse;
+    function GetSparses: FieldCursor;
+  end;
+
+  TLazyOptional = record
+    private
+      FValue: TOptional;
+      FEncoded: Bytes; // the encoding of the value, until it is first accessed
+      FParsed: Boolean;
+      function GetValue: TOptional;
+      procedure SetValue(const AValue: TOptional);
+    public
+      property Value: TOptional read GetValue write SetValue;
+      property Parsed: Boolean read FParsed;
+      function ComputeSize(AWriter: TWriter): Integer;
+      procedure EncodeTo(AWriter: TWriter);
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TLazyRepeated = record
+    private
+      FValue: TRepeated;
+      FEncoded: Bytes; // the encoding of the value, until it is first accessed
+      FParsed: Boolean;
+      function GetValue: TRepeated;
+      procedure SetValue(const AValue: TRepeated);
+    public
+      property Value: TRepeated read GetValue write SetValue;
+      property Parsed: Boolean read FParsed;
+      function ComputeSize(AWriter: TWriter): Integer;
+      procedure EncodeTo(AWriter: TWriter);
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TLazyFields = record
+    [Tag(1), Name('optional')] FOptional: TLazyOptional;
+    [Tag(2), Name('repeated')] FRepeated: TArray<TLazyRepeated>;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TLazyFieldsView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TLazyFieldsView; overload; static;
+    class function Create(const AValue: FieldValue): TLazyFieldsView; overload; static;
+    function HasOptional: Boolean;
+    function GetOptional: TOptionalView;
+    function GetRepeated: FieldCursor;
+  end;
+
+  TJsonNames = record
+    [Tag(1), Name('firstName')] FFirstName: int32;
+    [Tag(2), Name('first_name')] FAlias: int32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TJsonNamesView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TJsonNamesView; overload; static;
+    class function Create(const AValue: FieldValue): TJsonNamesView; overload; static;
+    function HasFirstName: Boolean;
+    function GetFirstName: int32;
+    function HasAlias: Boolean;
+    function GetAlias: int32;
   end;
 
 implementation
 
+uses
+  System.Classes,
+  Delphi.Serial.Protobuf.Schema;
+
+const
+  CSparseByValue: array [0 .. 2] of NamedValue = (
+    (FValue: -1; FName: 'Minus'),
+    (FValue: 0; FName: 'Zero'),
+    (FValue: 1000000; FName: 'Million')
+  );
+  CSparseByName: array [0 .. 2] of NamedValue = (
+    (FValue: 1000000; FName: 'Million'),
+    (FValue: -1; FName: 'Minus'),
+    (FValue: 0; FName: 'Zero')
+  );
+
+function TSparseHelper.TryGetName(out AName: string): Boolean;
+begin
+  Result := SparseEnum.TryGetName(CSparseByValue, Self, AName);
+end;
+
+class function TSparseHelper.TryParse(const AName: string; out AValue: TSparse): Boolean;
+begin
+  Result := SparseEnum.TryGetValue(CSparseByName, AName, Int32(AValue));
+end;
+
+const
+  CEnumByValue: array [0 .. 2] of string = (
+    'Value0',
+    '',
+    'Value2'
+  );
+
+const
+  COptionalFieldSeeds: array [0 .. 15] of Int32 = (
+    -4, 13, 0, 2, 0, 0, 2, 0, -6, -8, 5, 0, -9, 0, 0, -15
+  );
+  COptionalFieldNames: array [0 .. 15] of NamedValue = (
+    (FValue: 8; FName: 'sint64'),
+    (FValue: 5; FName: 'uint32'),
+    (FValue: 2; FName: 'float'),
+    (FValue: 4; FName: 'int64'),
+    (FValue: 9; FName: 'fixed32'),
+    (FValue: 16; FName: 'enum'),
+    (FValue: 15; FName: 'bytes'),
+    (FValue: 7; FName: 'sint32'),
+    (FValue: 13; FName: 'bool'),
+    (FValue: 12; FName: 'sfixed64'),
+    (FValue: 11; FName: 'sfixed32'),
+    (FValue: 14; FName: 'string'),
+    (FValue: 1; FName: 'double'),
+    (FValue: 10; FName: 'fixed64'),
+    (FValue: 3; FName: 'int32'),
+    (FValue: 6; FName: 'uint64')
+  );
+
+class function TOptional.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(COptionalFieldSeeds, COptionalFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CDefaultFieldSeeds: array [0 .. 15] of Int32 = (
+    -4, 13, 0, 2, 0, 0, 2, 0, -6, -8, 5, 0, -9, 0, 0, -15
+  );
+  CDefaultFieldNames: array [0 .. 15] of NamedValue = (
+    (FValue: 8; FName: 'sint64'),
+    (FValue: 5; FName: 'uint32'),
+    (FValue: 2; FName: 'float'),
+    (FValue: 4; FName: 'int64'),
+    (FValue: 9; FName: 'fixed32'),
+    (FValue: 16; FName: 'enum'),
+    (FValue: 15; FName: 'bytes'),
+    (FValue: 7; FName: 'sint32'),
+    (FValue: 13; FName: 'bool'),
+    (FValue: 12; FName: 'sfixed64'),
+    (FValue: 11; FName: 'sfixed32'),
+    (FValue: 14; FName: 'string'),
+    (FValue: 1; FName: 'double'),
+    (FValue: 10; FName: 'fixed64'),
+    (FValue: 3; FName: 'int32'),
+    (FValue: 6; FName: 'uint64')
+  );
+
+class function TDefault.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CDefaultFieldSeeds, CDefaultFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CRequiredFieldSeeds: array [0 .. 15] of Int32 = (
+    -4, 13, 0, 2, 0, 0, 2, 0, -6, -8, 5, 0, -9, 0, 0, -15
+  );
+  CRequiredFieldNames: array [0 .. 15] of NamedValue = (
+    (FValue: 8; FName: 'sint64'),
+    (FValue: 5; FName: 'uint32'),
+    (FValue: 2; FName: 'float'),
+    (FValue: 4; FName: 'int64'),
+    (FValue: 9; FName: 'fixed32'),
+    (FValue: 16; FName: 'enum'),
+    (FValue: 15; FName: 'bytes'),
+    (FValue: 7; FName: 'sint32'),
+    (FValue: 13; FName: 'bool'),
+    (FValue: 12; FName: 'sfixed64'),
+    (FValue: 11; FName: 'sfixed32'),
+    (FValue: 14; FName: 'string'),
+    (FValue: 1; FName: 'double'),
+    (FValue: 10; FName: 'fixed64'),
+    (FValue: 3; FName: 'int32'),
+    (FValue: 6; FName: 'uint64')
+  );
+
+class function TRequired.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CRequiredFieldSeeds, CRequiredFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CRepeatedFieldSeeds: array [0 .. 15] of Int32 = (
+    -4, 13, 0, 2, 0, 0, 2, 0, -6, -8, 5, 0, -9, 0, 0, -15
+  );
+  CRepeatedFieldNames: array [0 .. 15] of NamedValue = (
+    (FValue: 8; FName: 'sint64'),
+    (FValue: 5; FName: 'uint32'),
+    (FValue: 2; FName: 'float'),
+    (FValue: 4; FName: 'int64'),
+    (FValue: 9; FName: 'fixed32'),
+    (FValue: 16; FName: 'enum'),
+    (FValue: 15; FName: 'bytes'),
+    (FValue: 7; FName: 'sint32'),
+    (FValue: 13; FName: 'bool'),
+    (FValue: 12; FName: 'sfixed64'),
+    (FValue: 11; FName: 'sfixed32'),
+    (FValue: 14; FName: 'string'),
+    (FValue: 1; FName: 'double'),
+    (FValue: 10; FName: 'fixed64'),
+    (FValue: 3; FName: 'int32'),
+    (FValue: 6; FName: 'uint64')
+  );
+
+class function TRepeated.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CRepeatedFieldSeeds, CRepeatedFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CUnPackedFieldSeeds: array [0 .. 13] of Int32 = (
+    1, 0, -5, 1, 0, 1, 0, -7, 3, 1, -10, 0, 0, -12
+  );
+  CUnPackedFieldNames: array [0 .. 13] of NamedValue = (
+    (FValue: 6; FName: 'uint64'),
+    (FValue: 12; FName: 'sfixed64'),
+    (FValue: 9; FName: 'fixed32'),
+    (FValue: 10; FName: 'fixed64'),
+    (FValue: 5; FName: 'uint32'),
+    (FValue: 1; FName: 'double'),
+    (FValue: 16; FName: 'enum'),
+    (FValue: 7; FName: 'sint32'),
+    (FValue: 11; FName: 'sfixed32'),
+    (FValue: 13; FName: 'bool'),
+    (FValue: 8; FName: 'sint64'),
+    (FValue: 3; FName: 'int32'),
+    (FValue: 4; FName: 'int64'),
+    (FValue: 2; FName: 'float')
+  );
+
+class function TUnPacked.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CUnPackedFieldSeeds, CUnPackedFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CMessageFieldSeeds: array [0 .. 4] of Int32 = (
+    0, 1, 9, 0, 0
+  );
+  CMessageFieldNames: array [0 .. 4] of NamedValue = (
+    (FValue: 5; FName: 'unpacked'),
+    (FValue: 2; FName: 'default'),
+    (FValue: 3; FName: 'required'),
+    (FValue: 4; FName: 'repeated'),
+    (FValue: 1; FName: 'optional')
+  );
+
+class function TMessage.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CMessageFieldSeeds, CMessageFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CSparseValuesFieldSeeds: array [0 .. 1] of Int32 = (
+    -1, -2
+  );
+  CSparseValuesFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 1; FName: 'sparse'),
+    (FValue: 2; FName: 'sparses')
+  );
+
+class function TSparseValues.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CSparseValuesFieldSeeds, CSparseValuesFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CLazyFieldsFieldSeeds: array [0 .. 1] of Int32 = (
+    4, 0
+  );
+  CLazyFieldsFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 1; FName: 'optional'),
+    (FValue: 2; FName: 'repeated')
+  );
+
+class function TLazyFields.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CLazyFieldsFieldSeeds, CLazyFieldsFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CJsonNamesFieldSeeds: array [0 .. 2] of Int32 = (
+    0, -3, 5
+  );
+  CJsonNamesFieldNames: array [0 .. 2] of NamedValue = (
+    (FValue: 2; FName: 'first_name'),
+    (FValue: 1; FName: 'firstName'),
+    (FValue: 2; FName: 'alias')
+  );
+
+class function TJsonNames.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CJsonNamesFieldSeeds, CJsonNamesFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag1Fixed64: EncodedTag = (FBytes: $09; FCount: 1);
+  CTag1LengthPrefixed: EncodedTag = (FBytes: $0A; FCount: 1);
+  CTag2VarInt: EncodedTag = (FBytes: $10; FCount: 1);
+  CTag2LengthPrefixed: EncodedTag = (FBytes: $12; FCount: 1);
+  CTag2Fixed32: EncodedTag = (FBytes: $15; FCount: 1);
+  CTag3VarInt: EncodedTag = (FBytes: $18; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4VarInt: EncodedTag = (FBytes: $20; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5VarInt: EncodedTag = (FBytes: $28; FCount: 1);
+  CTag5LengthPrefixed: EncodedTag = (FBytes: $2A; FCount: 1);
+  CTag6VarInt: EncodedTag = (FBytes: $30; FCount: 1);
+  CTag6LengthPrefixed: EncodedTag = (FBytes: $32; FCount: 1);
+  CTag7VarInt: EncodedTag = (FBytes: $38; FCount: 1);
+  CTag7LengthPrefixed: EncodedTag = (FBytes: $3A; FCount: 1);
+  CTag8VarInt: EncodedTag = (FBytes: $40; FCount: 1);
+  CTag8LengthPrefixed: EncodedTag = (FBytes: $42; FCount: 1);
+  CTag9LengthPrefixed: EncodedTag = (FBytes: $4A; FCount: 1);
+  CTag9Fixed32: EncodedTag = (FBytes: $4D; FCount: 1);
+  CTag10Fixed64: EncodedTag = (FBytes: $51; FCount: 1);
+  CTag10LengthPrefixed: EncodedTag = (FBytes: $52; FCount: 1);
+  CTag11LengthPrefixed: EncodedTag = (FBytes: $5A; FCount: 1);
+  CTag11Fixed32: EncodedTag = (FBytes: $5D; FCount: 1);
+  CTag12Fixed64: EncodedTag = (FBytes: $61; FCount: 1);
+  CTag12LengthPrefixed: EncodedTag = (FBytes: $62; FCount: 1);
+  CTag13VarInt: EncodedTag = (FBytes: $68; FCount: 1);
+  CTag13LengthPrefixed: EncodedTag = (FBytes: $6A; FCount: 1);
+  CTag14LengthPrefixed: EncodedTag = (FBytes: $72; FCount: 1);
+  CTag15LengthPrefixed: EncodedTag = (FBytes: $7A; FCount: 1);
+  CTag16VarInt: EncodedTag = (FBytes: $0180; FCount: 2);
+  CTag16LengthPrefixed: EncodedTag = (FBytes: $0182; FCount: 2);
+
+function TLazyOptional.GetValue: TOptional;
+var
+  Stream: TBytesStream;
+  Reader: TReader;
+begin
+  if not FParsed then
+    begin
+      Stream := TBytesStream.Create(FEncoded);
+      try
+        Reader := TReader.Create(Stream);
+        try
+          FValue.ParseFrom(Reader);
+        finally
+          Reader.Free;
+        end;
+      finally
+        Stream.Free;
+      end;
+      FEncoded := nil;
+      FParsed := True;
+    end;
+  Result := FValue;
+end;
+
+procedure TLazyOptional.SetValue(const AValue: TOptional);
+begin
+  FValue := AValue;
+  FEncoded := nil;
+  FParsed := True;
+end;
+
+function TLazyOptional.ComputeSize(AWriter: TWriter): Integer;
+begin
+  if FParsed then
+    Result := FValue.ComputeSize(AWriter)
+  else
+    Result := Length(FEncoded);
+end;
+
+procedure TLazyOptional.EncodeTo(AWriter: TWriter);
+begin
+  if FParsed then
+    FValue.EncodeTo(AWriter)
+  else if Length(FEncoded) > 0 then
+    AWriter.Write(FEncoded[0], Length(FEncoded)); // copied as it was parsed
+end;
+
+procedure TLazyOptional.MergeFrom(AReader: TReader);
+var
+  Encoded: Bytes;
+begin
+  if FParsed then
+    begin
+      AReader.BeginLengthPrefixed;
+      FValue.ParseFrom(AReader);
+      AReader.EndLengthPrefixed;
+    end
+  else
+    begin
+      // parsing the concatenation of several encodings merges the messages they hold
+      AReader.Parse(Encoded);
+      FEncoded := FEncoded + Encoded;
+    end;
+end;
+
+function TLazyRepeated.GetValue: TRepeated;
+var
+  Stream: TBytesStream;
+  Reader: TReader;
+begin
+  if not FParsed then
+    begin
+      Stream := TBytesStream.Create(FEncoded);
+      try
+        Reader := TReader.Create(Stream);
+        try
+          FValue.ParseFrom(Reader);
+        finally
+          Reader.Free;
+        end;
+      finally
+        Stream.Free;
+      end;
+      FEncoded := nil;
+      FParsed := True;
+    end;
+  Result := FValue;
+end;
+
+procedure TLazyRepeated.SetValue(const AValue: TRepeated);
+begin
+  FValue := AValue;
+  FEncoded := nil;
+  FParsed := True;
+end;
+
+function TLazyRepeated.ComputeSize(AWriter: TWriter): Integer;
+begin
+  if FParsed then
+    Result := FValue.ComputeSize(AWriter)
+  else
+    Result := Length(FEncoded);
+end;
+
+procedure TLazyRepeated.EncodeTo(AWriter: TWriter);
+begin
+  if FParsed then
+    FValue.EncodeTo(AWriter)
+  else if Length(FEncoded) > 0 then
+    AWriter.Write(FEncoded[0], Length(FEncoded)); // copied as it was parsed
+end;
+
+procedure TLazyRepeated.MergeFrom(AReader: TReader);
+var
+  Encoded: Bytes;
+begin
+  if FParsed then
+    begin
+      AReader.BeginLengthPrefixed;
+      FValue.ParseFrom(AReader);
+      AReader.EndLengthPrefixed;
+    end
+  else
+    begin
+      // parsing the concatenation of several encodings merges the messages they hold
+      AReader.Parse(Encoded);
+      FEncoded := FEncoded + Encoded;
+    end;
+end;
+
+procedure TOptional.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TOptional.EncodeTo(AWriter: TWriter);
+begin
+  if FDouble <> 0 then
+    begin
+      AWriter.Pack(CTag1Fixed64);
+      AWriter.Pack(FixedInt64(FDouble));
+    end;
+  if FFloat <> 0 then
+    begin
+      AWriter.Pack(CTag2Fixed32);
+      AWriter.Pack(FixedInt32(FFloat));
+    end;
+  if FInt32 <> 0 then
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(VarInt(FInt32));
+    end;
+  if FInt64 <> 0 then
+    begin
+      AWriter.Pack(CTag4VarInt);
+      AWriter.Pack(VarInt(FInt64));
+    end;
+  if FUint32 <> 0 then
+    begin
+      AWriter.Pack(CTag5VarInt);
+      AWriter.Pack(VarInt(FUint32));
+    end;
+  if FUint64 <> 0 then
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(VarInt(FUint64));
+    end;
+  if FSint32 <> 0 then
+    begin
+      AWriter.Pack(CTag7VarInt);
+      AWriter.Pack(SignedInt(Int32(FSint32)));
+    end;
+  if FSint64 <> 0 then
+    begin
+      AWriter.Pack(CTag8VarInt);
+      AWriter.Pack(SignedInt(Int64(FSint64)));
+    end;
+  if FFixed32 <> 0 then
+    begin
+      AWriter.Pack(CTag9Fixed32);
+      AWriter.Pack(FixedInt32(UInt32(FFixed32)));
+    end;
+  if FFixed64 <> 0 then
+    begin
+      AWriter.Pack(CTag10Fixed64);
+      AWriter.Pack(FixedInt64(UInt64(FFixed64)));
+    end;
+  if FSfixed32 <> 0 then
+    begin
+      AWriter.Pack(CTag11Fixed32);
+      AWriter.Pack(FixedInt32(Int32(FSfixed32)));
+    end;
+  if FSfixed64 <> 0 then
+    begin
+      AWriter.Pack(CTag12Fixed64);
+      AWriter.Pack(FixedInt64(Int64(FSfixed64)));
+    end;
+  if FBool then
+    begin
+      AWriter.Pack(CTag13VarInt);
+      AWriter.Pack(VarInt(Ord(FBool)));
+    end;
+  if FString <> '' then
+    begin
+      AWriter.Pack(CTag14LengthPrefixed);
+      AWriter.Pack(FString, AWriter.NextSize);
+    end;
+  if Length(FBytes) > 0 then
+    begin
+      AWriter.Pack(CTag15LengthPrefixed);
+      AWriter.Pack(FBytes);
+    end;
+  if Ord(FEnum) <> 0 then
+    begin
+      AWriter.Pack(CTag16VarInt);
+      AWriter.Pack(VarInt(Ord(FEnum)));
+    end;
+end;
+
+function TOptional.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FDouble <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FFloat <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FInt32 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt32));
+    end;
+  if FInt64 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt64));
+    end;
+  if FUint32 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint32));
+    end;
+  if FUint64 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint64));
+    end;
+  if FSint32 <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int32(FSint32)));
+    end;
+  if FSint64 <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FSint64)));
+    end;
+  if FFixed32 <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FFixed64 <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FSfixed32 <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FSfixed64 <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FBool then
+    begin
+      Inc(Result, 1 + 1);
+    end;
+  if FString <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FString));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FBytes) > 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FBytes)) + Length(FBytes));
+    end;
+  if Ord(FEnum) <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(Ord(FEnum)));
+    end;
+end;
+
+procedure TOptional.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed32Value: FixedInt32;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FDouble := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFloat := Single(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt32 := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt64 := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint32 := UInt32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint64 := UInt64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint32 := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint64 := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFixed32 := UInt32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FFixed64 := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FSfixed32 := Int32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FSfixed64 := Int64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBool := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        14:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FString);
+            end
+          else
+            AReader.SkipField(WireType);
+        15:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FBytes);
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FEnum := TEnum(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TDefault.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TDefault.EncodeTo(AWriter: TWriter);
+begin
+  if FDouble <> 0 then
+    begin
+      AWriter.Pack(CTag1Fixed64);
+      AWriter.Pack(FixedInt64(FDouble));
+    end;
+  if FFloat <> 0 then
+    begin
+      AWriter.Pack(CTag2Fixed32);
+      AWriter.Pack(FixedInt32(FFloat));
+    end;
+  if FInt32 <> 0 then
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(VarInt(FInt32));
+    end;
+  if FInt64 <> 0 then
+    begin
+      AWriter.Pack(CTag4VarInt);
+      AWriter.Pack(VarInt(FInt64));
+    end;
+  if FUint32 <> 0 then
+    begin
+      AWriter.Pack(CTag5VarInt);
+      AWriter.Pack(VarInt(FUint32));
+    end;
+  if FUint64 <> 0 then
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(VarInt(FUint64));
+    end;
+  if FSint32 <> 0 then
+    begin
+      AWriter.Pack(CTag7VarInt);
+      AWriter.Pack(SignedInt(Int32(FSint32)));
+    end;
+  if FSint64 <> 0 then
+    begin
+      AWriter.Pack(CTag8VarInt);
+      AWriter.Pack(SignedInt(Int64(FSint64)));
+    end;
+  if FFixed32 <> 0 then
+    begin
+      AWriter.Pack(CTag9Fixed32);
+      AWriter.Pack(FixedInt32(UInt32(FFixed32)));
+    end;
+  if FFixed64 <> 0 then
+    begin
+      AWriter.Pack(CTag10Fixed64);
+      AWriter.Pack(FixedInt64(UInt64(FFixed64)));
+    end;
+  if FSfixed32 <> 0 then
+    begin
+      AWriter.Pack(CTag11Fixed32);
+      AWriter.Pack(FixedInt32(Int32(FSfixed32)));
+    end;
+  if FSfixed64 <> 0 then
+    begin
+      AWriter.Pack(CTag12Fixed64);
+      AWriter.Pack(FixedInt64(Int64(FSfixed64)));
+    end;
+  if FBool then
+    begin
+      AWriter.Pack(CTag13VarInt);
+      AWriter.Pack(VarInt(Ord(FBool)));
+    end;
+  if FString <> '' then
+    begin
+      AWriter.Pack(CTag14LengthPrefixed);
+      AWriter.Pack(FString, AWriter.NextSize);
+    end;
+  if Length(FBytes) > 0 then
+    begin
+      AWriter.Pack(CTag15LengthPrefixed);
+      AWriter.Pack(FBytes);
+    end;
+  if Ord(FEnum) <> 0 then
+    begin
+      AWriter.Pack(CTag16VarInt);
+      AWriter.Pack(VarInt(Ord(FEnum)));
+    end;
+end;
+
+function TDefault.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FDouble <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FFloat <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FInt32 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt32));
+    end;
+  if FInt64 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt64));
+    end;
+  if FUint32 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint32));
+    end;
+  if FUint64 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint64));
+    end;
+  if FSint32 <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int32(FSint32)));
+    end;
+  if FSint64 <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FSint64)));
+    end;
+  if FFixed32 <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FFixed64 <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FSfixed32 <> 0 then
+    begin
+      Inc(Result, 1 + 4);
+    end;
+  if FSfixed64 <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FBool then
+    begin
+      Inc(Result, 1 + 1);
+    end;
+  if FString <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FString));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FBytes) > 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FBytes)) + Length(FBytes));
+    end;
+  if Ord(FEnum) <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(Ord(FEnum)));
+    end;
+end;
+
+procedure TDefault.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed32Value: FixedInt32;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FDouble := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFloat := Single(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt32 := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt64 := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint32 := UInt32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint64 := UInt64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint32 := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint64 := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFixed32 := UInt32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FFixed64 := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FSfixed32 := Int32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FSfixed64 := Int64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBool := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        14:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FString);
+            end
+          else
+            AReader.SkipField(WireType);
+        15:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FBytes);
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FEnum := TEnum(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TRequired.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TRequired.EncodeTo(AWriter: TWriter);
+begin
+  AWriter.Pack(CTag1Fixed64);
+  AWriter.Pack(FixedInt64(FDouble));
+  AWriter.Pack(CTag2Fixed32);
+  AWriter.Pack(FixedInt32(FFloat));
+  AWriter.Pack(CTag3VarInt);
+  AWriter.Pack(VarInt(FInt32));
+  AWriter.Pack(CTag4VarInt);
+  AWriter.Pack(VarInt(FInt64));
+  AWriter.Pack(CTag5VarInt);
+  AWriter.Pack(VarInt(FUint32));
+  AWriter.Pack(CTag6VarInt);
+  AWriter.Pack(VarInt(FUint64));
+  AWriter.Pack(CTag7VarInt);
+  AWriter.Pack(SignedInt(Int32(FSint32)));
+  AWriter.Pack(CTag8VarInt);
+  AWriter.Pack(SignedInt(Int64(FSint64)));
+  AWriter.Pack(CTag9Fixed32);
+  AWriter.Pack(FixedInt32(UInt32(FFixed32)));
+  AWriter.Pack(CTag10Fixed64);
+  AWriter.Pack(FixedInt64(UInt64(FFixed64)));
+  AWriter.Pack(CTag11Fixed32);
+  AWriter.Pack(FixedInt32(Int32(FSfixed32)));
+  AWriter.Pack(CTag12Fixed64);
+  AWriter.Pack(FixedInt64(Int64(FSfixed64)));
+  AWriter.Pack(CTag13VarInt);
+  AWriter.Pack(VarInt(Ord(FBool)));
+  AWriter.Pack(CTag14LengthPrefixed);
+  AWriter.Pack(FString, AWriter.NextSize);
+  AWriter.Pack(CTag15LengthPrefixed);
+  AWriter.Pack(FBytes);
+  AWriter.Pack(CTag16VarInt);
+  AWriter.Pack(VarInt(Ord(FEnum)));
+end;
+
+function TRequired.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  Inc(Result, 1 + 8);
+  Inc(Result, 1 + 4);
+  Inc(Result, 1 + VarInt.ByteCount(FInt32));
+  Inc(Result, 1 + VarInt.ByteCount(FInt64));
+  Inc(Result, 1 + VarInt.ByteCount(FUint32));
+  Inc(Result, 1 + VarInt.ByteCount(FUint64));
+  Inc(Result, 1 + SignedInt.ByteCount(Int32(FSint32)));
+  Inc(Result, 1 + SignedInt.ByteCount(Int64(FSint64)));
+  Inc(Result, 1 + 4);
+  Inc(Result, 1 + 8);
+  Inc(Result, 1 + 4);
+  Inc(Result, 1 + 8);
+  Inc(Result, 1 + 1);
+  Size := AWriter.StoreSize(TWriter.ByteCount(FString));
+  Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+  Inc(Result, 1 + VarInt.ByteCount(Length(FBytes)) + Length(FBytes));
+  Inc(Result, 2 + VarInt.ByteCount(Ord(FEnum)));
+end;
+
+procedure TRequired.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed32Value: FixedInt32;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FDouble := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFloat := Single(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt32 := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt64 := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint32 := UInt32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUint64 := UInt64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint32 := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint64 := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FFixed32 := UInt32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FFixed64 := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.Fixed32 then
+            begin
+              AReader.Parse(Fixed32Value);
+              FSfixed32 := Int32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FSfixed64 := Int64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBool := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        14:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FString);
+            end
+          else
+            AReader.SkipField(WireType);
+        15:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FBytes);
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FEnum := TEnum(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TRepeated.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TRepeated.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  if Length(FDouble) > 0 then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FDouble) * 8));
+      for I := 0 to High(FDouble) do
+        AWriter.Pack(FixedInt64(FDouble[I]));
+    end;
+  if Length(FFloat) > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FFloat) * 4));
+      for I := 0 to High(FFloat) do
+        AWriter.Pack(FixedInt32(FFloat[I]));
+    end;
+  if Length(FInt32) > 0 then
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FInt32) do
+        AWriter.Pack(VarInt(FInt32[I]));
+    end;
+  if Length(FInt64) > 0 then
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FInt64) do
+        AWriter.Pack(VarInt(FInt64[I]));
+    end;
+  if Length(FUint32) > 0 then
+    begin
+      AWriter.Pack(CTag5LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FUint32) do
+        AWriter.Pack(VarInt(FUint32[I]));
+    end;
+  if Length(FUint64) > 0 then
+    begin
+      AWriter.Pack(CTag6LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FUint64) do
+        AWriter.Pack(VarInt(FUint64[I]));
+    end;
+  if Length(FSint32) > 0 then
+    begin
+      AWriter.Pack(CTag7LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FSint32) do
+        AWriter.Pack(SignedInt(Int32(FSint32[I])));
+    end;
+  if Length(FSint64) > 0 then
+    begin
+      AWriter.Pack(CTag8LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FSint64) do
+        AWriter.Pack(SignedInt(Int64(FSint64[I])));
+    end;
+  if Length(FFixed32) > 0 then
+    begin
+      AWriter.Pack(CTag9LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FFixed32) * 4));
+      for I := 0 to High(FFixed32) do
+        AWriter.Pack(FixedInt32(UInt32(FFixed32[I])));
+    end;
+  if Length(FFixed64) > 0 then
+    begin
+      AWriter.Pack(CTag10LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FFixed64) * 8));
+      for I := 0 to High(FFixed64) do
+        AWriter.Pack(FixedInt64(UInt64(FFixed64[I])));
+    end;
+  if Length(FSfixed32) > 0 then
+    begin
+      AWriter.Pack(CTag11LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FSfixed32) * 4));
+      for I := 0 to High(FSfixed32) do
+        AWriter.Pack(FixedInt32(Int32(FSfixed32[I])));
+    end;
+  if Length(FSfixed64) > 0 then
+    begin
+      AWriter.Pack(CTag12LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FSfixed64) * 8));
+      for I := 0 to High(FSfixed64) do
+        AWriter.Pack(FixedInt64(Int64(FSfixed64[I])));
+    end;
+  if Length(FBool) > 0 then
+    begin
+      AWriter.Pack(CTag13LengthPrefixed);
+      AWriter.Pack(VarInt(Length(FBool) * 1));
+      for I := 0 to High(FBool) do
+        AWriter.Pack(VarInt(Ord(FBool[I])));
+    end;
+  for I := 0 to High(FString) do
+    begin
+      AWriter.Pack(CTag14LengthPrefixed);
+      AWriter.Pack(FString[I], AWriter.NextSize);
+    end;
+  for I := 0 to High(FBytes) do
+    begin
+      AWriter.Pack(CTag15LengthPrefixed);
+      AWriter.Pack(FBytes[I]);
+    end;
+  if Length(FEnum) > 0 then
+    begin
+      AWriter.Pack(CTag16LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FEnum) do
+        AWriter.Pack(VarInt(Ord(FEnum[I])));
+    end;
+end;
+
+function TRepeated.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if Length(FDouble) > 0 then
+    begin
+      Size := Length(FDouble) * 8;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FFloat) > 0 then
+    begin
+      Size := Length(FFloat) * 4;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FInt32) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FInt32) do
+        Inc(Size, VarInt.ByteCount(FInt32[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FInt64) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FInt64) do
+        Inc(Size, VarInt.ByteCount(FInt64[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FUint32) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FUint32) do
+        Inc(Size, VarInt.ByteCount(FUint32[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FUint64) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FUint64) do
+        Inc(Size, VarInt.ByteCount(FUint64[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FSint32) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FSint32) do
+        Inc(Size, SignedInt.ByteCount(Int32(FSint32[I])));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FSint64) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FSint64) do
+        Inc(Size, SignedInt.ByteCount(Int64(FSint64[I])));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FFixed32) > 0 then
+    begin
+      Size := Length(FFixed32) * 4;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FFixed64) > 0 then
+    begin
+      Size := Length(FFixed64) * 8;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FSfixed32) > 0 then
+    begin
+      Size := Length(FSfixed32) * 4;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FSfixed64) > 0 then
+    begin
+      Size := Length(FSfixed64) * 8;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FBool) > 0 then
+    begin
+      Size := Length(FBool) * 1;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FString) do
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FString[I]));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FBytes) do
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FBytes[I])) + Length(FBytes[I]));
+    end;
+  if Length(FEnum) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FEnum) do
+        Inc(Size, VarInt.ByteCount(Ord(FEnum[I])));
+      AWriter.StoreSize(Size);
+      Inc(Result, 2 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TRepeated.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed32Value: FixedInt32;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FDouble, Length(FDouble) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FDouble[High(FDouble)] := Double(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FDouble, Length(FDouble) + 1);
+              AReader.Parse(Fixed64Value);
+              FDouble[High(FDouble)] := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFloat, Length(FFloat) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FFloat[High(FFloat)] := Single(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FFloat, Length(FFloat) + 1);
+              AReader.Parse(Fixed32Value);
+              FFloat[High(FFloat)] := Single(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FInt32, Length(FInt32) + 1);
+                  AReader.Parse(VarIntValue);
+                  FInt32[High(FInt32)] := Int32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FInt32, Length(FInt32) + 1);
+              AReader.Parse(VarIntValue);
+              FInt32[High(FInt32)] := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FInt64, Length(FInt64) + 1);
+                  AReader.Parse(VarIntValue);
+                  FInt64[High(FInt64)] := Int64(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FInt64, Length(FInt64) + 1);
+              AReader.Parse(VarIntValue);
+              FInt64[High(FInt64)] := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FUint32, Length(FUint32) + 1);
+                  AReader.Parse(VarIntValue);
+                  FUint32[High(FUint32)] := UInt32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FUint32, Length(FUint32) + 1);
+              AReader.Parse(VarIntValue);
+              FUint32[High(FUint32)] := UInt32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FUint64, Length(FUint64) + 1);
+                  AReader.Parse(VarIntValue);
+                  FUint64[High(FUint64)] := UInt64(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FUint64, Length(FUint64) + 1);
+              AReader.Parse(VarIntValue);
+              FUint64[High(FUint64)] := UInt64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSint32, Length(FSint32) + 1);
+                  AReader.Parse(SignedIntValue);
+                  FSint32[High(FSint32)] := Int32(SignedIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FSint32, Length(FSint32) + 1);
+              AReader.Parse(SignedIntValue);
+              FSint32[High(FSint32)] := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSint64, Length(FSint64) + 1);
+                  AReader.Parse(SignedIntValue);
+                  FSint64[High(FSint64)] := Int64(SignedIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FSint64, Length(FSint64) + 1);
+              AReader.Parse(SignedIntValue);
+              FSint64[High(FSint64)] := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFixed32, Length(FFixed32) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FFixed32[High(FFixed32)] := UInt32(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FFixed32, Length(FFixed32) + 1);
+              AReader.Parse(Fixed32Value);
+              FFixed32[High(FFixed32)] := UInt32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFixed64, Length(FFixed64) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FFixed64[High(FFixed64)] := UInt64(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FFixed64, Length(FFixed64) + 1);
+              AReader.Parse(Fixed64Value);
+              FFixed64[High(FFixed64)] := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSfixed32, Length(FSfixed32) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FSfixed32[High(FSfixed32)] := Int32(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FSfixed32, Length(FSfixed32) + 1);
+              AReader.Parse(Fixed32Value);
+              FSfixed32[High(FSfixed32)] := Int32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSfixed64, Length(FSfixed64) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FSfixed64[High(FSfixed64)] := Int64(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FSfixed64, Length(FSfixed64) + 1);
+              AReader.Parse(Fixed64Value);
+              FSfixed64[High(FSfixed64)] := Int64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FBool, Length(FBool) + 1);
+                  AReader.Parse(VarIntValue);
+                  FBool[High(FBool)] := UInt64(VarIntValue) <> 0;
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FBool, Length(FBool) + 1);
+              AReader.Parse(VarIntValue);
+              FBool[High(FBool)] := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        14:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FString, Length(FString) + 1);
+              AReader.Parse(FString[High(FString)]);
+            end
+          else
+            AReader.SkipField(WireType);
+        15:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FBytes, Length(FBytes) + 1);
+              AReader.Parse(FBytes[High(FBytes)]);
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FEnum, Length(FEnum) + 1);
+                  AReader.Parse(VarIntValue);
+                  FEnum[High(FEnum)] := TEnum(Int32(VarIntValue));
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FEnum, Length(FEnum) + 1);
+              AReader.Parse(VarIntValue);
+              FEnum[High(FEnum)] := TEnum(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TUnPacked.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TUnPacked.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  for I := 0 to High(FDouble) do
+    begin
+      AWriter.Pack(CTag1Fixed64);
+      AWriter.Pack(FixedInt64(FDouble[I]));
+    end;
+  for I := 0 to High(FFloat) do
+    begin
+      AWriter.Pack(CTag2Fixed32);
+      AWriter.Pack(FixedInt32(FFloat[I]));
+    end;
+  for I := 0 to High(FInt32) do
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(VarInt(FInt32[I]));
+    end;
+  for I := 0 to High(FInt64) do
+    begin
+      AWriter.Pack(CTag4VarInt);
+      AWriter.Pack(VarInt(FInt64[I]));
+    end;
+  for I := 0 to High(FUint32) do
+    begin
+      AWriter.Pack(CTag5VarInt);
+      AWriter.Pack(VarInt(FUint32[I]));
+    end;
+  for I := 0 to High(FUint64) do
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(VarInt(FUint64[I]));
+    end;
+  for I := 0 to High(FSint32) do
+    begin
+      AWriter.Pack(CTag7VarInt);
+      AWriter.Pack(SignedInt(Int32(FSint32[I])));
+    end;
+  for I := 0 to High(FSint64) do
+    begin
+      AWriter.Pack(CTag8VarInt);
+      AWriter.Pack(SignedInt(Int64(FSint64[I])));
+    end;
+  for I := 0 to High(FFixed32) do
+    begin
+      AWriter.Pack(CTag9Fixed32);
+      AWriter.Pack(FixedInt32(UInt32(FFixed32[I])));
+    end;
+  for I := 0 to High(FFixed64) do
+    begin
+      AWriter.Pack(CTag10Fixed64);
+      AWriter.Pack(FixedInt64(UInt64(FFixed64[I])));
+    end;
+  for I := 0 to High(FSfixed32) do
+    begin
+      AWriter.Pack(CTag11Fixed32);
+      AWriter.Pack(FixedInt32(Int32(FSfixed32[I])));
+    end;
+  for I := 0 to High(FSfixed64) do
+    begin
+      AWriter.Pack(CTag12Fixed64);
+      AWriter.Pack(FixedInt64(Int64(FSfixed64[I])));
+    end;
+  for I := 0 to High(FBool) do
+    begin
+      AWriter.Pack(CTag13VarInt);
+      AWriter.Pack(VarInt(Ord(FBool[I])));
+    end;
+  for I := 0 to High(FEnum) do
+    begin
+      AWriter.Pack(CTag16VarInt);
+      AWriter.Pack(VarInt(Ord(FEnum[I])));
+    end;
+end;
+
+function TUnPacked.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+begin
+  Result := 0;
+  Inc(Result, Length(FDouble) * (1 + 8));
+  Inc(Result, Length(FFloat) * (1 + 4));
+  for I := 0 to High(FInt32) do
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt32[I]));
+    end;
+  for I := 0 to High(FInt64) do
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt64[I]));
+    end;
+  for I := 0 to High(FUint32) do
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint32[I]));
+    end;
+  for I := 0 to High(FUint64) do
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FUint64[I]));
+    end;
+  for I := 0 to High(FSint32) do
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int32(FSint32[I])));
+    end;
+  for I := 0 to High(FSint64) do
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FSint64[I])));
+    end;
+  Inc(Result, Length(FFixed32) * (1 + 4));
+  Inc(Result, Length(FFixed64) * (1 + 8));
+  Inc(Result, Length(FSfixed32) * (1 + 4));
+  Inc(Result, Length(FSfixed64) * (1 + 8));
+  Inc(Result, Length(FBool) * (1 + 1));
+  for I := 0 to High(FEnum) do
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(Ord(FEnum[I])));
+    end;
+end;
+
+procedure TUnPacked.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed32Value: FixedInt32;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FDouble, Length(FDouble) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FDouble[High(FDouble)] := Double(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FDouble, Length(FDouble) + 1);
+              AReader.Parse(Fixed64Value);
+              FDouble[High(FDouble)] := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFloat, Length(FFloat) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FFloat[High(FFloat)] := Single(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FFloat, Length(FFloat) + 1);
+              AReader.Parse(Fixed32Value);
+              FFloat[High(FFloat)] := Single(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FInt32, Length(FInt32) + 1);
+                  AReader.Parse(VarIntValue);
+                  FInt32[High(FInt32)] := Int32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FInt32, Length(FInt32) + 1);
+              AReader.Parse(VarIntValue);
+              FInt32[High(FInt32)] := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FInt64, Length(FInt64) + 1);
+                  AReader.Parse(VarIntValue);
+                  FInt64[High(FInt64)] := Int64(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FInt64, Length(FInt64) + 1);
+              AReader.Parse(VarIntValue);
+              FInt64[High(FInt64)] := Int64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FUint32, Length(FUint32) + 1);
+                  AReader.Parse(VarIntValue);
+                  FUint32[High(FUint32)] := UInt32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FUint32, Length(FUint32) + 1);
+              AReader.Parse(VarIntValue);
+              FUint32[High(FUint32)] := UInt32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FUint64, Length(FUint64) + 1);
+                  AReader.Parse(VarIntValue);
+                  FUint64[High(FUint64)] := UInt64(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FUint64, Length(FUint64) + 1);
+              AReader.Parse(VarIntValue);
+              FUint64[High(FUint64)] := UInt64(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSint32, Length(FSint32) + 1);
+                  AReader.Parse(SignedIntValue);
+                  FSint32[High(FSint32)] := Int32(SignedIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FSint32, Length(FSint32) + 1);
+              AReader.Parse(SignedIntValue);
+              FSint32[High(FSint32)] := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSint64, Length(FSint64) + 1);
+                  AReader.Parse(SignedIntValue);
+                  FSint64[High(FSint64)] := Int64(SignedIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FSint64, Length(FSint64) + 1);
+              AReader.Parse(SignedIntValue);
+              FSint64[High(FSint64)] := Int64(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFixed32, Length(FFixed32) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FFixed32[High(FFixed32)] := UInt32(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FFixed32, Length(FFixed32) + 1);
+              AReader.Parse(Fixed32Value);
+              FFixed32[High(FFixed32)] := UInt32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FFixed64, Length(FFixed64) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FFixed64[High(FFixed64)] := UInt64(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FFixed64, Length(FFixed64) + 1);
+              AReader.Parse(Fixed64Value);
+              FFixed64[High(FFixed64)] := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSfixed32, Length(FSfixed32) + 1);
+                  AReader.Parse(Fixed32Value);
+                  FSfixed32[High(FSfixed32)] := Int32(Fixed32Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed32 then
+            begin
+              SetLength(FSfixed32, Length(FSfixed32) + 1);
+              AReader.Parse(Fixed32Value);
+              FSfixed32[High(FSfixed32)] := Int32(Fixed32Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSfixed64, Length(FSfixed64) + 1);
+                  AReader.Parse(Fixed64Value);
+                  FSfixed64[High(FSfixed64)] := Int64(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              SetLength(FSfixed64, Length(FSfixed64) + 1);
+              AReader.Parse(Fixed64Value);
+              FSfixed64[High(FSfixed64)] := Int64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FBool, Length(FBool) + 1);
+                  AReader.Parse(VarIntValue);
+                  FBool[High(FBool)] := UInt64(VarIntValue) <> 0;
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FBool, Length(FBool) + 1);
+              AReader.Parse(VarIntValue);
+              FBool[High(FBool)] := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FEnum, Length(FEnum) + 1);
+                  AReader.Parse(VarIntValue);
+                  FEnum[High(FEnum)] := TEnum(Int32(VarIntValue));
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FEnum, Length(FEnum) + 1);
+              AReader.Parse(VarIntValue);
+              FEnum[High(FEnum)] := TEnum(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TMessage.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TMessage.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  for I := 0 to High(FOptional) do
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FOptional[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FDefault) do
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FDefault[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FRequired) do
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FRequired[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FRepeated) do
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FRepeated[I].EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FUnpacked) do
+    begin
+      AWriter.Pack(CTag5LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FUnpacked[I].EncodeTo(AWriter);
+    end;
+end;
+
+function TMessage.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  for I := 0 to High(FOptional) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FOptional[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FDefault) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FDefault[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FRequired) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FRequired[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FRepeated) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FRepeated[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to High(FUnpacked) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FUnpacked[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TMessage.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FOptional, Length(FOptional) + 1);
+              AReader.BeginLengthPrefixed;
+              FOptional[High(FOptional)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FDefault, Length(FDefault) + 1);
+              AReader.BeginLengthPrefixed;
+              FDefault[High(FDefault)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FRequired, Length(FRequired) + 1);
+              AReader.BeginLengthPrefixed;
+              FRequired[High(FRequired)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FRepeated, Length(FRepeated) + 1);
+              AReader.BeginLengthPrefixed;
+              FRepeated[High(FRepeated)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FUnpacked, Length(FUnpacked) + 1);
+              AReader.BeginLengthPrefixed;
+              FUnpacked[High(FUnpacked)].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TSparseValues.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TSparseValues.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  if Ord(FSparse) <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(Ord(FSparse)));
+    end;
+  if Length(FSparses) > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FSparses) do
+        AWriter.Pack(VarInt(Ord(FSparses[I])));
+    end;
+end;
+
+function TSparseValues.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if Ord(FSparse) <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Ord(FSparse)));
+    end;
+  if Length(FSparses) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FSparses) do
+        Inc(Size, VarInt.ByteCount(Ord(FSparses[I])));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TSparseValues.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FSparse := TSparse(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FSparses, Length(FSparses) + 1);
+                  AReader.Parse(VarIntValue);
+                  FSparses[High(FSparses)] := TSparse(Int32(VarIntValue));
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FSparses, Length(FSparses) + 1);
+              AReader.Parse(VarIntValue);
+              FSparses[High(FSparses)] := TSparse(Int32(VarIntValue));
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TLazyFields.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TLazyFields.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+  Size: Integer;
+begin
+  Size := AWriter.NextSize;
+  if Size > 0 then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(Size));
+      FOptional.EncodeTo(AWriter);
+    end;
+  for I := 0 to High(FRepeated) do
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FRepeated[I].EncodeTo(AWriter);
+    end;
+end;
+
+function TLazyFields.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  Slot := AWriter.ReserveSize;
+  Size := AWriter.StoreSize(Slot, FOptional.ComputeSize(AWriter));
+  if Size > 0 then
+    Inc(Result, 1 + VarInt.ByteCount(Size) + Size)
+  else
+    AWriter.ReleaseSizes(Slot);
+  for I := 0 to High(FRepeated) do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FRepeated[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TLazyFields.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FOptional.MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FRepeated, Length(FRepeated) + 1);
+              FRepeated[High(FRepeated)].MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TJsonNames.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TJsonNames.EncodeTo(AWriter: TWriter);
+begin
+  if FFirstName <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FFirstName));
+    end;
+  if FAlias <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(FAlias));
+    end;
+end;
+
+function TJsonNames.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FFirstName <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FFirstName));
+    end;
+  if FAlias <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FAlias));
+    end;
+end;
+
+procedure TJsonNames.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FFirstName := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FAlias := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+class function TOptionalView.Create(const AMessage: MessageView): TOptionalView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TOptionalView.Create(const AValue: FieldValue): TOptionalView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TOptionalView.HasDouble: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.Fixed64);
+end;
+
+function TOptionalView.GetDouble: double;
+begin
+  Result := FMessage.Find(1, TWireType.Fixed64).AsDouble;
+end;
+
+function TOptionalView.HasFloat: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.Fixed32);
+end;
+
+function TOptionalView.GetFloat: float;
+begin
+  Result := FMessage.Find(2, TWireType.Fixed32).AsSingle;
+end;
+
+function TOptionalView.HasInt32: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TOptionalView.GetInt32: int32;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsInt32;
+end;
+
+function TOptionalView.HasInt64: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.VarInt);
+end;
+
+function TOptionalView.GetInt64: int64;
+begin
+  Result := FMessage.Find(4, TWireType.VarInt).AsInt64;
+end;
+
+function TOptionalView.HasUint32: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.VarInt);
+end;
+
+function TOptionalView.GetUint32: uint32;
+begin
+  Result := FMessage.Find(5, TWireType.VarInt).AsUInt32;
+end;
+
+function TOptionalView.HasUint64: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TOptionalView.GetUint64: uint64;
+begin
+  Result := FMessage.Find(6, TWireType.VarInt).AsUInt64;
+end;
+
+function TOptionalView.HasSint32: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TOptionalView.GetSint32: sint32;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsSInt32;
+end;
+
+function TOptionalView.HasSint64: Boolean;
+begin
+  Result := FMessage.Contains(8, TWireType.VarInt);
+end;
+
+function TOptionalView.GetSint64: sint64;
+begin
+  Result := FMessage.Find(8, TWireType.VarInt).AsSInt64;
+end;
+
+function TOptionalView.HasFixed32: Boolean;
+begin
+  Result := FMessage.Contains(9, TWireType.Fixed32);
+end;
+
+function TOptionalView.GetFixed32: fixed32;
+begin
+  Result := FMessage.Find(9, TWireType.Fixed32).AsUInt32;
+end;
+
+function TOptionalView.HasFixed64: Boolean;
+begin
+  Result := FMessage.Contains(10, TWireType.Fixed64);
+end;
+
+function TOptionalView.GetFixed64: fixed64;
+begin
+  Result := FMessage.Find(10, TWireType.Fixed64).AsUInt64;
+end;
+
+function TOptionalView.HasSfixed32: Boolean;
+begin
+  Result := FMessage.Contains(11, TWireType.Fixed32);
+end;
+
+function TOptionalView.GetSfixed32: sfixed32;
+begin
+  Result := FMessage.Find(11, TWireType.Fixed32).AsInt32;
+end;
+
+function TOptionalView.HasSfixed64: Boolean;
+begin
+  Result := FMessage.Contains(12, TWireType.Fixed64);
+end;
+
+function TOptionalView.GetSfixed64: sfixed64;
+begin
+  Result := FMessage.Find(12, TWireType.Fixed64).AsInt64;
+end;
+
+function TOptionalView.HasBool: Boolean;
+begin
+  Result := FMessage.Contains(13, TWireType.VarInt);
+end;
+
+function TOptionalView.GetBool: bool;
+begin
+  Result := FMessage.Find(13, TWireType.VarInt).AsBoolean;
+end;
+
+function TOptionalView.HasString: Boolean;
+begin
+  Result := FMessage.Contains(14, TWireType.LengthPrefixed);
+end;
+
+function TOptionalView.GetString: ByteSlice;
+begin
+  Result := FMessage.Find(14, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TOptionalView.HasBytes: Boolean;
+begin
+  Result := FMessage.Contains(15, TWireType.LengthPrefixed);
+end;
+
+function TOptionalView.GetBytes: ByteSlice;
+begin
+  Result := FMessage.Find(15, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TOptionalView.HasEnum: Boolean;
+begin
+  Result := FMessage.Contains(16, TWireType.VarInt);
+end;
+
+function TOptionalView.GetEnum: TEnum;
+begin
+  Result := TEnum(FMessage.Find(16, TWireType.VarInt).AsInt32);
+end;
+
+class function TDefaultView.Create(const AMessage: MessageView): TDefaultView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TDefaultView.Create(const AValue: FieldValue): TDefaultView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TDefaultView.HasDouble: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.Fixed64);
+end;
+
+function TDefaultView.GetDouble: double;
+begin
+  Result := FMessage.Find(1, TWireType.Fixed64).AsDouble;
+end;
+
+function TDefaultView.HasFloat: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.Fixed32);
+end;
+
+function TDefaultView.GetFloat: float;
+begin
+  Result := FMessage.Find(2, TWireType.Fixed32).AsSingle;
+end;
+
+function TDefaultView.HasInt32: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TDefaultView.GetInt32: int32;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsInt32;
+end;
+
+function TDefaultView.HasInt64: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.VarInt);
+end;
+
+function TDefaultView.GetInt64: int64;
+begin
+  Result := FMessage.Find(4, TWireType.VarInt).AsInt64;
+end;
+
+function TDefaultView.HasUint32: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.VarInt);
+end;
+
+function TDefaultView.GetUint32: uint32;
+begin
+  Result := FMessage.Find(5, TWireType.VarInt).AsUInt32;
+end;
+
+function TDefaultView.HasUint64: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TDefaultView.GetUint64: uint64;
+begin
+  Result := FMessage.Find(6, TWireType.VarInt).AsUInt64;
+end;
+
+function TDefaultView.HasSint32: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TDefaultView.GetSint32: sint32;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsSInt32;
+end;
+
+function TDefaultView.HasSint64: Boolean;
+begin
+  Result := FMessage.Contains(8, TWireType.VarInt);
+end;
+
+function TDefaultView.GetSint64: sint64;
+begin
+  Result := FMessage.Find(8, TWireType.VarInt).AsSInt64;
+end;
+
+function TDefaultView.HasFixed32: Boolean;
+begin
+  Result := FMessage.Contains(9, TWireType.Fixed32);
+end;
+
+function TDefaultView.GetFixed32: fixed32;
+begin
+  Result := FMessage.Find(9, TWireType.Fixed32).AsUInt32;
+end;
+
+function TDefaultView.HasFixed64: Boolean;
+begin
+  Result := FMessage.Contains(10, TWireType.Fixed64);
+end;
+
+function TDefaultView.GetFixed64: fixed64;
+begin
+  Result := FMessage.Find(10, TWireType.Fixed64).AsUInt64;
+end;
+
+function TDefaultView.HasSfixed32: Boolean;
+begin
+  Result := FMessage.Contains(11, TWireType.Fixed32);
+end;
+
+function TDefaultView.GetSfixed32: sfixed32;
+begin
+  Result := FMessage.Find(11, TWireType.Fixed32).AsInt32;
+end;
+
+function TDefaultView.HasSfixed64: Boolean;
+begin
+  Result := FMessage.Contains(12, TWireType.Fixed64);
+end;
+
+function TDefaultView.GetSfixed64: sfixed64;
+begin
+  Result := FMessage.Find(12, TWireType.Fixed64).AsInt64;
+end;
+
+function TDefaultView.HasBool: Boolean;
+begin
+  Result := FMessage.Contains(13, TWireType.VarInt);
+end;
+
+function TDefaultView.GetBool: bool;
+begin
+  Result := FMessage.Find(13, TWireType.VarInt).AsBoolean;
+end;
+
+function TDefaultView.HasString: Boolean;
+begin
+  Result := FMessage.Contains(14, TWireType.LengthPrefixed);
+end;
+
+function TDefaultView.GetString: ByteSlice;
+begin
+  Result := FMessage.Find(14, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TDefaultView.HasBytes: Boolean;
+begin
+  Result := FMessage.Contains(15, TWireType.LengthPrefixed);
+end;
+
+function TDefaultView.GetBytes: ByteSlice;
+begin
+  Result := FMessage.Find(15, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TDefaultView.HasEnum: Boolean;
+begin
+  Result := FMessage.Contains(16, TWireType.VarInt);
+end;
+
+function TDefaultView.GetEnum: TEnum;
+begin
+  Result := TEnum(FMessage.Find(16, TWireType.VarInt).AsInt32);
+end;
+
+class function TRequiredView.Create(const AMessage: MessageView): TRequiredView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TRequiredView.Create(const AValue: FieldValue): TRequiredView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TRequiredView.HasDouble: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.Fixed64);
+end;
+
+function TRequiredView.GetDouble: double;
+begin
+  Result := FMessage.Find(1, TWireType.Fixed64).AsDouble;
+end;
+
+function TRequiredView.HasFloat: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.Fixed32);
+end;
+
+function TRequiredView.GetFloat: float;
+begin
+  Result := FMessage.Find(2, TWireType.Fixed32).AsSingle;
+end;
+
+function TRequiredView.HasInt32: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TRequiredView.GetInt32: int32;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsInt32;
+end;
+
+function TRequiredView.HasInt64: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.VarInt);
+end;
+
+function TRequiredView.GetInt64: int64;
+begin
+  Result := FMessage.Find(4, TWireType.VarInt).AsInt64;
+end;
+
+function TRequiredView.HasUint32: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.VarInt);
+end;
+
+function TRequiredView.GetUint32: uint32;
+begin
+  Result := FMessage.Find(5, TWireType.VarInt).AsUInt32;
+end;
+
+function TRequiredView.HasUint64: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TRequiredView.GetUint64: uint64;
+begin
+  Result := FMessage.Find(6, TWireType.VarInt).AsUInt64;
+end;
+
+function TRequiredView.HasSint32: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TRequiredView.GetSint32: sint32;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsSInt32;
+end;
+
+function TRequiredView.HasSint64: Boolean;
+begin
+  Result := FMessage.Contains(8, TWireType.VarInt);
+end;
+
+function TRequiredView.GetSint64: sint64;
+begin
+  Result := FMessage.Find(8, TWireType.VarInt).AsSInt64;
+end;
+
+function TRequiredView.HasFixed32: Boolean;
+begin
+  Result := FMessage.Contains(9, TWireType.Fixed32);
+end;
+
+function TRequiredView.GetFixed32: fixed32;
+begin
+  Result := FMessage.Find(9, TWireType.Fixed32).AsUInt32;
+end;
+
+function TRequiredView.HasFixed64: Boolean;
+begin
+  Result := FMessage.Contains(10, TWireType.Fixed64);
+end;
+
+function TRequiredView.GetFixed64: fixed64;
+begin
+  Result := FMessage.Find(10, TWireType.Fixed64).AsUInt64;
+end;
+
+function TRequiredView.HasSfixed32: Boolean;
+begin
+  Result := FMessage.Contains(11, TWireType.Fixed32);
+end;
+
+function TRequiredView.GetSfixed32: sfixed32;
+begin
+  Result := FMessage.Find(11, TWireType.Fixed32).AsInt32;
+end;
+
+function TRequiredView.HasSfixed64: Boolean;
+begin
+  Result := FMessage.Contains(12, TWireType.Fixed64);
+end;
+
+function TRequiredView.GetSfixed64: sfixed64;
+begin
+  Result := FMessage.Find(12, TWireType.Fixed64).AsInt64;
+end;
+
+function TRequiredView.HasBool: Boolean;
+begin
+  Result := FMessage.Contains(13, TWireType.VarInt);
+end;
+
+function TRequiredView.GetBool: bool;
+begin
+  Result := FMessage.Find(13, TWireType.VarInt).AsBoolean;
+end;
+
+function TRequiredView.HasString: Boolean;
+begin
+  Result := FMessage.Contains(14, TWireType.LengthPrefixed);
+end;
+
+function TRequiredView.GetString: ByteSlice;
+begin
+  Result := FMessage.Find(14, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TRequiredView.HasBytes: Boolean;
+begin
+  Result := FMessage.Contains(15, TWireType.LengthPrefixed);
+end;
+
+function TRequiredView.GetBytes: ByteSlice;
+begin
+  Result := FMessage.Find(15, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TRequiredView.HasEnum: Boolean;
+begin
+  Result := FMessage.Contains(16, TWireType.VarInt);
+end;
+
+function TRequiredView.GetEnum: TEnum;
+begin
+  Result := TEnum(FMessage.Find(16, TWireType.VarInt).AsInt32);
+end;
+
+class function TRepeatedView.Create(const AMessage: MessageView): TRepeatedView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TRepeatedView.Create(const AValue: FieldValue): TRepeatedView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TRepeatedView.GetDouble: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.Fixed64);
+end;
+
+function TRepeatedView.GetFloat: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.Fixed32);
+end;
+
+function TRepeatedView.GetInt32: FieldCursor;
+begin
+  Result := FMessage.Values(3, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetInt64: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetUint32: FieldCursor;
+begin
+  Result := FMessage.Values(5, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetUint64: FieldCursor;
+begin
+  Result := FMessage.Values(6, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetSint32: FieldCursor;
+begin
+  Result := FMessage.Values(7, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetSint64: FieldCursor;
+begin
+  Result := FMessage.Values(8, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetFixed32: FieldCursor;
+begin
+  Result := FMessage.Values(9, TWireType.Fixed32);
+end;
+
+function TRepeatedView.GetFixed64: FieldCursor;
+begin
+  Result := FMessage.Values(10, TWireType.Fixed64);
+end;
+
+function TRepeatedView.GetSfixed32: FieldCursor;
+begin
+  Result := FMessage.Values(11, TWireType.Fixed32);
+end;
+
+function TRepeatedView.GetSfixed64: FieldCursor;
+begin
+  Result := FMessage.Values(12, TWireType.Fixed64);
+end;
+
+function TRepeatedView.GetBool: FieldCursor;
+begin
+  Result := FMessage.Values(13, TWireType.VarInt);
+end;
+
+function TRepeatedView.GetString: FieldCursor;
+begin
+  Result := FMessage.Values(14, TWireType.LengthPrefixed);
+end;
+
+function TRepeatedView.GetBytes: FieldCursor;
+begin
+  Result := FMessage.Values(15, TWireType.LengthPrefixed);
+end;
+
+function TRepeatedView.GetEnum: FieldCursor;
+begin
+  Result := FMessage.Values(16, TWireType.VarInt);
+end;
+
+class function TUnPackedView.Create(const AMessage: MessageView): TUnPackedView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TUnPackedView.Create(const AValue: FieldValue): TUnPackedView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TUnPackedView.GetDouble: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.Fixed64);
+end;
+
+function TUnPackedView.GetFloat: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.Fixed32);
+end;
+
+function TUnPackedView.GetInt32: FieldCursor;
+begin
+  Result := FMessage.Values(3, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetInt64: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetUint32: FieldCursor;
+begin
+  Result := FMessage.Values(5, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetUint64: FieldCursor;
+begin
+  Result := FMessage.Values(6, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetSint32: FieldCursor;
+begin
+  Result := FMessage.Values(7, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetSint64: FieldCursor;
+begin
+  Result := FMessage.Values(8, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetFixed32: FieldCursor;
+begin
+  Result := FMessage.Values(9, TWireType.Fixed32);
+end;
+
+function TUnPackedView.GetFixed64: FieldCursor;
+begin
+  Result := FMessage.Values(10, TWireType.Fixed64);
+end;
+
+function TUnPackedView.GetSfixed32: FieldCursor;
+begin
+  Result := FMessage.Values(11, TWireType.Fixed32);
+end;
+
+function TUnPackedView.GetSfixed64: FieldCursor;
+begin
+  Result := FMessage.Values(12, TWireType.Fixed64);
+end;
+
+function TUnPackedView.GetBool: FieldCursor;
+begin
+  Result := FMessage.Values(13, TWireType.VarInt);
+end;
+
+function TUnPackedView.GetEnum: FieldCursor;
+begin
+  Result := FMessage.Values(16, TWireType.VarInt);
+end;
+
+class function TMessageView.Create(const AMessage: MessageView): TMessageView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TMessageView.Create(const AValue: FieldValue): TMessageView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TMessageView.GetOptional: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.LengthPrefixed);
+end;
+
+function TMessageView.GetDefault: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.LengthPrefixed);
+end;
+
+function TMessageView.GetRequired: FieldCursor;
+begin
+  Result := FMessage.Values(3, TWireType.LengthPrefixed);
+end;
+
+function TMessageView.GetRepeated: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.LengthPrefixed);
+end;
+
+function TMessageView.GetUnpacked: FieldCursor;
+begin
+  Result := FMessage.Values(5, TWireType.LengthPrefixed);
+end;
+
+class function TSparseValuesView.Create(const AMessage: MessageView): TSparseValuesView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TSparseValuesView.Create(const AValue: FieldValue): TSparseValuesView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TSparseValuesView.HasSparse: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TSparseValuesView.GetSparse: TSparse;
+begin
+  Result := TSparse(FMessage.Find(1, TWireType.VarInt).AsInt32);
+end;
+
+function TSparseValuesView.GetSparses: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.VarInt);
+end;
+
+class function TLazyFieldsView.Create(const AMessage: MessageView): TLazyFieldsView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TLazyFieldsView.Create(const AValue: FieldValue): TLazyFieldsView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TLazyFieldsView.HasOptional: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.LengthPrefixed);
+end;
+
+function TLazyFieldsView.GetOptional: TOptionalView;
+begin
+  Result := TOptionalView.Create(FMessage.Find(1, TWireType.LengthPrefixed));
+end;
+
+function TLazyFieldsView.GetRepeated: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.LengthPrefixed);
+end;
+
+class function TJsonNamesView.Create(const AMessage: MessageView): TJsonNamesView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TJsonNamesView.Create(const AValue: FieldValue): TJsonNamesView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TJsonNamesView.HasFirstName: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TJsonNamesView.GetFirstName: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TJsonNamesView.HasAlias: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TJsonNamesView.GetAlias: int32;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsInt32;
+end;
+
+const
+  CSchema: array [0 .. 2659] of Byte = (
+    $0A, $E1, $14, $0A, $14, $73, $63, $68, $65, $6D, $61, $2F, $6D, $65, $73, $73,
+    $61, $67, $65, $2E, $70, $72, $6F, $74, $6F, $22, $8D, $03, $0A, $08, $4F, $70,
+    $74, $69, $6F, $6E, $61, $6C, $12, $16, $0A, $06, $64, $6F, $75, $62, $6C, $65,
+    $18, $01, $20, $01, $28, $01, $52, $06, $64, $6F, $75, $62, $6C, $65, $12, $14,
+    $0A, $05, $66, $6C, $6F, $61, $74, $18, $02, $20, $01, $28, $02, $52, $05, $66,
+    $6C, $6F, $61, $74, $12, $14, $0A, $05, $69, $6E, $74, $33, $32, $18, $03, $20,
+    $01, $28, $05, $52, $05, $69, $6E, $74, $33, $32, $12, $14, $0A, $05, $69, $6E,
+    $74, $36, $34, $18, $04, $20, $01, $28, $03, $52, $05, $69, $6E, $74, $36, $34,
+    $12, $16, $0A, $06, $75, $69, $6E, $74, $33, $32, $18, $05, $20, $01, $28, $0D,
+    $52, $06, $75, $69, $6E, $74, $33, $32, $12, $16, $0A, $06, $75, $69, $6E, $74,
+    $36, $34, $18, $06, $20, $01, $28, $04, $52, $06, $75, $69, $6E, $74, $36, $34,
+    $12, $16, $0A, $06, $73, $69, $6E, $74, $33, $32, $18, $07, $20, $01, $28, $11,
+    $52, $06, $73, $69, $6E, $74, $33, $32, $12, $16, $0A, $06, $73, $69, $6E, $74,
+    $36, $34, $18, $08, $20, $01, $28, $12, $52, $06, $73, $69, $6E, $74, $36, $34,
+    $12, $18, $0A, $07, $66, $69, $78, $65, $64, $33, $32, $18, $09, $20, $01, $28,
+    $07, $52, $07, $66, $69, $78, $65, $64, $33, $32, $12, $18, $0A, $07, $66, $69,
+    $78, $65, $64, $36, $34, $18, $0A, $20, $01, $28, $06, $52, $07, $66, $69, $78,
+    $65, $64, $36, $34, $12, $1A, $0A, $08, $73, $66, $69, $78, $65, $64, $33, $32,
+    $18, $0B, $20, $01, $28, $0F, $52, $08, $73, $66, $69, $78, $65, $64, $33, $32,
+    $12, $1A, $0A, $08, $73, $66, $69, $78, $65, $64, $36, $34, $18, $0C, $20, $01,
+    $28, $10, $52, $08, $73, $66, $69, $78, $65, $64, $36, $34, $12, $12, $0A, $04,
+    $62, $6F, $6F, $6C, $18, $0D, $20, $01, $28, $08, $52, $04, $62, $6F, $6F, $6C,
+    $12, $16, $0A, $06, $73, $74, $72, $69, $6E, $67, $18, $0E, $20, $01, $28, $09,
+    $52, $06, $73, $74, $72, $69, $6E, $67, $12, $14, $0A, $05, $62, $79, $74, $65,
+    $73, $18, $0F, $20, $01, $28, $0C, $52, $05, $62, $79, $74, $65, $73, $12, $19,
+    $0A, $04, $65, $6E, $75, $6D, $18, $10, $20, $01, $28, $0E, $32, $05, $2E, $45,
+    $6E, $75, $6D, $52, $04, $65, $6E, $75, $6D, $22, $CB, $03, $0A, $07, $44, $65,
+    $66, $61, $75, $6C, $74, $12, $19, $0A, $06, $64, $6F, $75, $62, $6C, $65, $18,
+    $01, $20, $01, $28, $01, $3A, $01, $31, $52, $06, $64, $6F, $75, $62, $6C, $65,
+    $12, $17, $0A, $05, $66, $6C, $6F, $61, $74, $18, $02, $20, $01, $28, $02, $3A,
+    $01, $31, $52, $05, $66, $6C, $6F, $61, $74, $12, $17, $0A, $05, $69, $6E, $74,
+    $33, $32, $18, $03, $20, $01, $28, $05, $3A, $01, $31, $52, $05, $69, $6E, $74,
+    $33, $32, $12, $17, $0A, $05, $69, $6E, $74, $36, $34, $18, $04, $20, $01, $28,
+    $03, $3A, $01, $31, $52, $05, $69, $6E, $74, $36, $34, $12, $19, $0A, $06, $75,
+    $69, $6E, $74, $33, $32, $18, $05, $20, $01, $28, $0D, $3A, $01, $31, $52, $06,
+    $75, $69, $6E, $74, $33, $32, $12, $19, $0A, $06, $75, $69, $6E, $74, $36, $34,
+    $18, $06, $20, $01, $28, $04, $3A, $01, $31, $52, $06, $75, $69, $6E, $74, $36,
+    $34, $12, $19, $0A, $06, $73, $69, $6E, $74, $33, $32, $18, $07, $20, $01, $28,
+    $11, $3A, $01, $31, $52, $06, $73, $69, $6E, $74, $33, $32, $12, $19, $0A, $06,
+    $73, $69, $6E, $74, $36, $34, $18, $08, $20, $01, $28, $12, $3A, $01, $31, $52,
+    $06, $73, $69, $6E, $74, $36, $34, $12, $1B, $0A, $07, $66, $69, $78, $65, $64,
+    $33, $32, $18, $09, $20, $01, $28, $07, $3A, $01, $31, $52, $07, $66, $69, $78,
+    $65, $64, $33, $32, $12, $1B, $0A, $07, $66, $69, $78, $65, $64, $36, $34, $18,
+    $0A, $20, $01, $28, $06, $3A, $01, $31, $52, $07, $66, $69, $78, $65, $64, $36,
+    $34, $12, $1D, $0A, $08, $73, $66, $69, $78, $65, $64, $33, $32, $18, $0B, $20,
+    $01, $28, $0F, $3A, $01, $31, $52, $08, $73, $66, $69, $78, $65, $64, $33, $32,
+    $12, $1D, $0A, $08, $73, $66, $69, $78, $65, $64, $36, $34, $18, $0C, $20, $01,
+    $28, $10, $3A, $01, $31, $52, $08, $73, $66, $69, $78, $65, $64, $36, $34, $12,
+    $18, $0A, $04, $62, $6F, $6F, $6C, $18, $0D, $20, $01, $28, $08, $3A, $04, $74,
+    $72, $75, $65, $52, $04, $62, $6F, $6F, $6C, $12, $19, $0A, $06, $73, $74, $72,
+    $69, $6E, $67, $18, $0E, $20, $01, $28, $09, $3A, $01, $61, $52, $06, $73, $74,
+    $72, $69, $6E, $67, $12, $1E, $0A, $05, $62, $79, $74, $65, $73, $18, $0F, $20,
+    $01, $28, $0C, $3A, $08, $5C, $32, $35, $33, $5C, $30, $31, $36, $52, $05, $62,
+    $79, $74, $65, $73, $12, $21, $0A, $04, $65, $6E, $75, $6D, $18, $10, $20, $01,
+    $28, $0E, $32, $05, $2E, $45, $6E, $75, $6D, $3A, $06, $56, $41, $4C, $55, $45,
+    $32, $52, $04, $65, $6E, $75, $6D, $22, $8D, $03, $0A, $08, $52, $65, $71, $75,
+    $69, $72, $65, $64, $12, $16, $0A, $06, $64, $6F, $75, $62, $6C, $65, $18, $01,
+    $20, $02, $28, $01, $52, $06, $64, $6F, $75, $62, $6C, $65, $12, $14, $0A, $05,
+    $66, $6C, $6F, $61, $74, $18, $02, $20, $02, $28, $02, $52, $05, $66, $6C, $6F,
+    $61, $74, $12, $14, $0A, $05, $69, $6E, $74, $33, $32, $18, $03, $20, $02, $28,
+    $05, $52, $05, $69, $6E, $74, $33, $32, $12, $14, $0A, $05, $69, $6E, $74, $36,
+    $34, $18, $04, $20, $02, $28, $03, $52, $05, $69, $6E, $74, $36, $34, $12, $16,
+    $0A, $06, $75, $69, $6E, $74, $33, $32, $18, $05, $20, $02, $28, $0D, $52, $06,
+    $75, $69, $6E, $74, $33, $32, $12, $16, $0A, $06, $75, $69, $6E, $74, $36, $34,
+    $18, $06, $20, $02, $28, $04, $52, $06, $75, $69, $6E, $74, $36, $34, $12, $16,
+    $0A, $06, $73, $69, $6E, $74, $33, $32, $18, $07, $20, $02, $28, $11, $52, $06,
+    $73, $69, $6E, $74, $33, $32, $12, $16, $0A, $06, $73, $69, $6E, $74, $36, $34,
+    $18, $08, $20, $02, $28, $12, $52, $06, $73, $69, $6E, $74, $36, $34, $12, $18,
+    $0A, $07, $66, $69, $78, $65, $64, $33, $32, $18, $09, $20, $02, $28, $07, $52,
+    $07, $66, $69, $78, $65, $64, $33, $32, $12, $18, $0A, $07, $66, $69, $78, $65,
+    $64, $36, $34, $18, $0A, $20, $02, $28, $06, $52, $07, $66, $69, $78, $65, $64,
+    $36, $34, $12, $1A, $0A, $08, $73, $66, $69, $78, $65, $64, $33, $32, $18, $0B,
+    $20, $02, $28, $0F, $52, $08, $73, $66, $69, $78, $65, $64, $33, $32, $12, $1A,
+    $0A, $08, $73, $66, $69, $78, $65, $64, $36, $34, $18, $0C, $20, $02, $28, $10,
+    $52, $08, $73, $66, $69, $78, $65, $64, $36, $34, $12, $12, $0A, $04, $62, $6F,
+    $6F, $6C, $18, $0D, $20, $02, $28, $08, $52, $04, $62, $6F, $6F, $6C, $12, $16,
+    $0A, $06, $73, $74, $72, $69, $6E, $67, $18, $0E, $20, $02, $28, $09, $52, $06,
+    $73, $74, $72, $69, $6E, $67, $12, $14, $0A, $05, $62, $79, $74, $65, $73, $18,
+    $0F, $20, $02, $28, $0C, $52, $05, $62, $79, $74, $65, $73, $12, $19, $0A, $04,
+    $65, $6E, $75, $6D, $18, $10, $20, $02, $28, $0E, $32, $05, $2E, $45, $6E, $75,
+    $6D, $52, $04, $65, $6E, $75, $6D, $22, $C5, $03, $0A, $08, $52, $65, $70, $65,
+    $61, $74, $65, $64, $12, $1A, $0A, $06, $64, $6F, $75, $62, $6C, $65, $18, $01,
+    $20, $03, $28, $01, $42, $02, $10, $01, $52, $06, $64, $6F, $75, $62, $6C, $65,
+    $12, $18, $0A, $05, $66, $6C, $6F, $61, $74, $18, $02, $20, $03, $28, $02, $42,
+    $02, $10, $01, $52, $05, $66, $6C, $6F, $61, $74, $12, $18, $0A, $05, $69, $6E,
+    $74, $33, $32, $18, $03, $20, $03, $28, $05, $42, $02, $10, $01, $52, $05, $69,
+    $6E, $74, $33, $32, $12, $18, $0A, $05, $69, $6E, $74, $36, $34, $18, $04, $20,
+    $03, $28, $03, $42, $02, $10, $01, $52, $05, $69, $6E, $74, $36, $34, $12, $1A,
+    $0A, $06, $75, $69, $6E, $74, $33, $32, $18, $05, $20, $03, $28, $0D, $42, $02,
+    $10, $01, $52, $06, $75, $69, $6E, $74, $33, $32, $12, $1A, $0A, $06, $75, $69,
+    $6E, $74, $36, $34, $18, $06, $20, $03, $28, $04, $42, $02, $10, $01, $52, $06,
+    $75, $69, $6E, $74, $36, $34, $12, $1A, $0A, $06, $73, $69, $6E, $74, $33, $32,
+    $18, $07, $20, $03, $28, $11, $42, $02, $10, $01, $52, $06, $73, $69, $6E, $74,
+    $33, $32, $12, $1A, $0A, $06, $73, $69, $6E, $74, $36, $34, $18, $08, $20, $03,
+    $28, $12, $42, $02, $10, $01, $52, $06, $73, $69, $6E, $74, $36, $34, $12, $1C,
+    $0A, $07, $66, $69, $78, $65, $64, $33, $32, $18, $09, $20, $03, $28, $07, $42,
+    $02, $10, $01, $52, $07, $66, $69, $78, $65, $64, $33, $32, $12, $1C, $0A, $07,
+    $66, $69, $78, $65, $64, $36, $34, $18, $0A, $20, $03, $28, $06, $42, $02, $10,
+    $01, $52, $07, $66, $69, $78, $65, $64, $36, $34, $12, $1E, $0A, $08, $73, $66,
+    $69, $78, $65, $64, $33, $32, $18, $0B, $20, $03, $28, $0F, $42, $02, $10, $01,
+    $52, $08, $73, $66, $69, $78, $65, $64, $33, $32, $12, $1E, $0A, $08, $73, $66,
+    $69, $78, $65, $64, $36, $34, $18, $0C, $20, $03, $28, $10, $42, $02, $10, $01,
+    $52, $08, $73, $66, $69, $78, $65, $64, $36, $34, $12, $16, $0A, $04, $62, $6F,
+    $6F, $6C, $18, $0D, $20, $03, $28, $08, $42, $02, $10, $01, $52, $04, $62, $6F,
+    $6F, $6C, $12, $16, $0A, $06, $73, $74, $72, $69, $6E, $67, $18, $0E, $20, $03,
+    $28, $09, $52, $06, $73, $74, $72, $69, $6E, $67, $12, $14, $0A, $05, $62, $79,
+    $74, $65, $73, $18, $0F, $20, $03, $28, $0C, $52, $05, $62, $79, $74, $65, $73,
+    $12, $1D, $0A, $04, $65, $6E, $75, $6D, $18, $10, $20, $03, $28, $0E, $32, $05,
+    $2E, $45, $6E, $75, $6D, $42, $02, $10, $01, $52, $04, $65, $6E, $75, $6D, $22,
+    $DF, $02, $0A, $08, $55, $6E, $50, $61, $63, $6B, $65, $64, $12, $16, $0A, $06,
+    $64, $6F, $75, $62, $6C, $65, $18, $01, $20, $03, $28, $01, $52, $06, $64, $6F,
+    $75, $62, $6C, $65, $12, $14, $0A, $05, $66, $6C, $6F, $61, $74, $18, $02, $20,
+    $03, $28, $02, $52, $05, $66, $6C, $6F, $61, $74, $12, $14, $0A, $05, $69, $6E,
+    $74, $33, $32, $18, $03, $20, $03, $28, $05, $52, $05, $69, $6E, $74, $33, $32,
+    $12, $14, $0A, $05, $69, $6E, $74, $36, $34, $18, $04, $20, $03, $28, $03, $52,
+    $05, $69, $6E, $74, $36, $34, $12, $16, $0A, $06, $75, $69, $6E, $74, $33, $32,
+    $18, $05, $20, $03, $28, $0D, $52, $06, $75, $69, $6E, $74, $33, $32, $12, $16,
+    $0A, $06, $75, $69, $6E, $74, $36, $34, $18, $06, $20, $03, $28, $04, $52, $06,
+    $75, $69, $6E, $74, $36, $34, $12, $16, $0A, $06, $73, $69, $6E, $74, $33, $32,
+    $18, $07, $20, $03, $28, $11, $52, $06, $73, $69, $6E, $74, $33, $32, $12, $16,
+    $0A, $06, $73, $69, $6E, $74, $36, $34, $18, $08, $20, $03, $28, $12, $52, $06,
+    $73, $69, $6E, $74, $36, $34, $12, $18, $0A, $07, $66, $69, $78, $65, $64, $33,
+    $32, $18, $09, $20, $03, $28, $07, $52, $07, $66, $69, $78, $65, $64, $33, $32,
+    $12, $18, $0A, $07, $66, $69, $78, $65, $64, $36, $34, $18, $0A, $20, $03, $28,
+    $06, $52, $07, $66, $69, $78, $65, $64, $36, $34, $12, $1A, $0A, $08, $73, $66,
+    $69, $78, $65, $64, $33, $32, $18, $0B, $20, $03, $28, $0F, $52, $08, $73, $66,
+    $69, $78, $65, $64, $33, $32, $12, $1A, $0A, $08, $73, $66, $69, $78, $65, $64,
+    $36, $34, $18, $0C, $20, $03, $28, $10, $52, $08, $73, $66, $69, $78, $65, $64,
+    $36, $34, $12, $12, $0A, $04, $62, $6F, $6F, $6C, $18, $0D, $20, $03, $28, $08,
+    $52, $04, $62, $6F, $6F, $6C, $12, $19, $0A, $04, $65, $6E, $75, $6D, $18, $10,
+    $20, $03, $28, $0E, $32, $05, $2E, $45, $6E, $75, $6D, $52, $04, $65, $6E, $75,
+    $6D, $22, $C9, $01, $0A, $07, $4D, $65, $73, $73, $61, $67, $65, $12, $25, $0A,
+    $08, $6F, $70, $74, $69, $6F, $6E, $61, $6C, $18, $01, $20, $03, $28, $0B, $32,
+    $09, $2E, $4F, $70, $74, $69, $6F, $6E, $61, $6C, $52, $08, $6F, $70, $74, $69,
+    $6F, $6E, $61, $6C, $12, $22, $0A, $07, $64, $65, $66, $61, $75, $6C, $74, $18,
+    $02, $20, $03, $28, $0B, $32, $08, $2E, $44, $65, $66, $61, $75, $6C, $74, $52,
+    $07, $64, $65, $66, $61, $75, $6C, $74, $12, $25, $0A, $08, $72, $65, $71, $75,
+    $69, $72, $65, $64, $18, $03, $20, $03, $28, $0B, $32, $09, $2E, $52, $65, $71,
+    $75, $69, $72, $65, $64, $52, $08, $72, $65, $71, $75, $69, $72, $65, $64, $12,
+    $25, $0A, $08, $72, $65, $70, $65, $61, $74, $65, $64, $18, $04, $20, $03, $28,
+    $0B, $32, $09, $2E, $52, $65, $70, $65, $61, $74, $65, $64, $52, $08, $72, $65,
+    $70, $65, $61, $74, $65, $64, $12, $25, $0A, $08, $75, $6E, $70, $61, $63, $6B,
+    $65, $64, $18, $05, $20, $03, $28, $0B, $32, $09, $2E, $55, $6E, $50, $61, $63,
+    $6B, $65, $64, $52, $08, $75, $6E, $70, $61, $63, $6B, $65, $64, $22, $56, $0A,
+    $0C, $53, $70, $61, $72, $73, $65, $56, $61, $6C, $75, $65, $73, $12, $1F, $0A,
+    $06, $73, $70, $61, $72, $73, $65, $18, $01, $20, $01, $28, $0E, $32, $07, $2E,
+    $53, $70, $61, $72, $73, $65, $52, $06, $73, $70, $61, $72, $73, $65, $12, $25,
+    $0A, $07, $73, $70, $61, $72, $73, $65, $73, $18, $02, $20, $03, $28, $0E, $32,
+    $07, $2E, $53, $70, $61, $72, $73, $65, $42, $02, $10, $01, $52, $07, $73, $70,
+    $61, $72, $73, $65, $73, $22, $5A, $0A, $0A, $4C, $61, $7A, $79, $46, $69, $65,
+    $6C, $64, $73, $12, $25, $0A, $08, $6F, $70, $74, $69, $6F, $6E, $61, $6C, $18,
+    $01, $20, $01, $28, $0B, $32, $09, $2E, $4F, $70, $74, $69, $6F, $6E, $61, $6C,
+    $52, $08, $6F, $70, $74, $69, $6F, $6E, $61, $6C, $12, $25, $0A, $08, $72, $65,
+    $70, $65, $61, $74, $65, $64, $18, $02, $20, $03, $28, $0B, $32, $09, $2E, $52,
+    $65, $70, $65, $61, $74, $65, $64, $52, $08, $72, $65, $70, $65, $61, $74, $65,
+    $64, $22, $45, $0A, $09, $4A, $73, $6F, $6E, $4E, $61, $6D, $65, $73, $12, $1D,
+    $0A, $0A, $66, $69, $72, $73, $74, $5F, $6E, $61, $6D, $65, $18, $01, $20, $01,
+    $28, $05, $52, $09, $66, $69, $72, $73, $74, $4E, $61, $6D, $65, $12, $19, $0A,
+    $05, $61, $6C, $69, $61, $73, $18, $02, $20, $01, $28, $05, $52, $0A, $66, $69,
+    $72, $73, $74, $5F, $6E, $61, $6D, $65, $2A, $1E, $0A, $04, $45, $6E, $75, $6D,
+    $12, $0A, $0A, $06, $56, $41, $4C, $55, $45, $30, $10, $00, $12, $0A, $0A, $06,
+    $56, $41, $4C, $55, $45, $32, $10, $02, $2A, $4A, $0A, $06, $53, $70, $61, $72,
+    $73, $65, $12, $0F, $0A, $0B, $53, $50, $41, $52, $53, $45, $5F, $5A, $45, $52,
+    $4F, $10, $00, $12, $19, $0A, $0C, $53, $50, $41, $52, $53, $45, $5F, $4D, $49,
+    $4E, $55, $53, $10, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $FF, $01, $12, $14,
+    $0A, $0E, $53, $50, $41, $52, $53, $45, $5F, $4D, $49, $4C, $4C, $49, $4F, $4E,
+    $10, $C0, $84, $3D
+  );
+
+initialization
+
+SchemaRegistry.Register(CSchema);
+EnumRegistry.Register(TypeInfo(TEnum), CEnumByValue);
+TOptional.Table := MessageTable.Create(TypeInfo(TOptional), [
+  FieldEntry.Create(1, TFieldKind.Double, [], @TOptional(nil^).FDouble),
+  FieldEntry.Create(2, TFieldKind.Float, [], @TOptional(nil^).FFloat),
+  FieldEntry.Create(3, TFieldKind.Int32, [], @TOptional(nil^).FInt32),
+  FieldEntry.Create(4, TFieldKind.Int64, [], @TOptional(nil^).FInt64),
+  FieldEntry.Create(5, TFieldKind.UInt32, [], @TOptional(nil^).FUint32),
+  FieldEntry.Create(6, TFieldKind.UInt64, [], @TOptional(nil^).FUint64),
+  FieldEntry.Create(7, TFieldKind.SInt32, [], @TOptional(nil^).FSint32),
+  FieldEntry.Create(8, TFieldKind.SInt64, [], @TOptional(nil^).FSint64),
+  FieldEntry.Create(9, TFieldKind.Fixed32, [], @TOptional(nil^).FFixed32),
+  FieldEntry.Create(10, TFieldKind.Fixed64, [], @TOptional(nil^).FFixed64),
+  FieldEntry.Create(11, TFieldKind.SFixed32, [], @TOptional(nil^).FSfixed32),
+  FieldEntry.Create(12, TFieldKind.SFixed64, [], @TOptional(nil^).FSfixed64),
+  FieldEntry.Create(13, TFieldKind.Bool, [], @TOptional(nil^).FBool),
+  FieldEntry.Create(14, TFieldKind.&String, [], @TOptional(nil^).FString),
+  FieldEntry.Create(15, TFieldKind.Bytes, [], @TOptional(nil^).FBytes),
+  FieldEntry.Create(16, TFieldKind.Enum8, [], @TOptional(nil^).FEnum)]);
+TDefault.Table := MessageTable.Create(TypeInfo(TDefault), [
+  FieldEntry.Create(1, TFieldKind.Double, [], @TDefault(nil^).FDouble),
+  FieldEntry.Create(2, TFieldKind.Float, [], @TDefault(nil^).FFloat),
+  FieldEntry.Create(3, TFieldKind.Int32, [], @TDefault(nil^).FInt32),
+  FieldEntry.Create(4, TFieldKind.Int64, [], @TDefault(nil^).FInt64),
+  FieldEntry.Create(5, TFieldKind.UInt32, [], @TDefault(nil^).FUint32),
+  FieldEntry.Create(6, TFieldKind.UInt64, [], @TDefault(nil^).FUint64),
+  FieldEntry.Create(7, TFieldKind.SInt32, [], @TDefault(nil^).FSint32),
+  FieldEntry.Create(8, TFieldKind.SInt64, [], @TDefault(nil^).FSint64),
+  FieldEntry.Create(9, TFieldKind.Fixed32, [], @TDefault(nil^).FFixed32),
+  FieldEntry.Create(10, TFieldKind.Fixed64, [], @TDefault(nil^).FFixed64),
+  FieldEntry.Create(11, TFieldKind.SFixed32, [], @TDefault(nil^).FSfixed32),
+  FieldEntry.Create(12, TFieldKind.SFixed64, [], @TDefault(nil^).FSfixed64),
+  FieldEntry.Create(13, TFieldKind.Bool, [], @TDefault(nil^).FBool),
+  FieldEntry.Create(14, TFieldKind.&String, [], @TDefault(nil^).FString),
+  FieldEntry.Create(15, TFieldKind.Bytes, [], @TDefault(nil^).FBytes),
+  FieldEntry.Create(16, TFieldKind.Enum8, [], @TDefault(nil^).FEnum)]);
+TRequired.Table := MessageTable.Create(TypeInfo(TRequired), [
+  FieldEntry.Create(1, TFieldKind.Double, [TFieldFlag.Required], @TRequired(nil^).FDouble),
+  FieldEntry.Create(2, TFieldKind.Float, [TFieldFlag.Required], @TRequired(nil^).FFloat),
+  FieldEntry.Create(3, TFieldKind.Int32, [TFieldFlag.Required], @TRequired(nil^).FInt32),
+  FieldEntry.Create(4, TFieldKind.Int64, [TFieldFlag.Required], @TRequired(nil^).FInt64),
+  FieldEntry.Create(5, TFieldKind.UInt32, [TFieldFlag.Required], @TRequired(nil^).FUint32),
+  FieldEntry.Create(6, TFieldKind.UInt64, [TFieldFlag.Required], @TRequired(nil^).FUint64),
+  FieldEntry.Create(7, TFieldKind.SInt32, [TFieldFlag.Required], @TRequired(nil^).FSint32),
+  FieldEntry.Create(8, TFieldKind.SInt64, [TFieldFlag.Required], @TRequired(nil^).FSint64),
+  FieldEntry.Create(9, TFieldKind.Fixed32, [TFieldFlag.Required], @TRequired(nil^).FFixed32),
+  FieldEntry.Create(10, TFieldKind.Fixed64, [TFieldFlag.Required], @TRequired(nil^).FFixed64),
+  FieldEntry.Create(11, TFieldKind.SFixed32, [TFieldFlag.Required], @TRequired(nil^).FSfixed32),
+  FieldEntry.Create(12, TFieldKind.SFixed64, [TFieldFlag.Required], @TRequired(nil^).FSfixed64),
+  FieldEntry.Create(13, TFieldKind.Bool, [TFieldFlag.Required], @TRequired(nil^).FBool),
+  FieldEntry.Create(14, TFieldKind.&String, [TFieldFlag.Required], @TRequired(nil^).FString),
+  FieldEntry.Create(15, TFieldKind.Bytes, [TFieldFlag.Required], @TRequired(nil^).FBytes),
+  FieldEntry.Create(16, TFieldKind.Enum8, [TFieldFlag.Required], @TRequired(nil^).FEnum)]);
+TRepeated.Table := MessageTable.Create(TypeInfo(TRepeated), [
+  FieldEntry.Create(1, TFieldKind.Double, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FDouble, TypeInfo(TArray<double>), nil),
+  FieldEntry.Create(2, TFieldKind.Float, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FFloat, TypeInfo(TArray<float>), nil),
+  FieldEntry.Create(3, TFieldKind.Int32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FInt32, TypeInfo(TArray<int32>), nil),
+  FieldEntry.Create(4, TFieldKind.Int64, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FInt64, TypeInfo(TArray<int64>), nil),
+  FieldEntry.Create(5, TFieldKind.UInt32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FUint32, TypeInfo(TArray<uint32>), nil),
+  FieldEntry.Create(6, TFieldKind.UInt64, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FUint64, TypeInfo(TArray<uint64>), nil),
+  FieldEntry.Create(7, TFieldKind.SInt32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FSint32, TypeInfo(TArray<sint32>), nil),
+  FieldEntry.Create(8, TFieldKind.SInt64, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FSint64, TypeInfo(TArray<sint64>), nil),
+  FieldEntry.Create(9, TFieldKind.Fixed32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FFixed32, TypeInfo(TArray<fixed32>), nil),
+  FieldEntry.Create(10, TFieldKind.Fixed64, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FFixed64, TypeInfo(TArray<fixed64>), nil),
+  FieldEntry.Create(11, TFieldKind.SFixed32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FSfixed32, TypeInfo(TArray<sfixed32>), nil),
+  FieldEntry.Create(12, TFieldKind.SFixed64, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FSfixed64, TypeInfo(TArray<sfixed64>), nil),
+  FieldEntry.Create(13, TFieldKind.Bool, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FBool, TypeInfo(TArray<bool>), nil),
+  FieldEntry.Create(14, TFieldKind.&String, [TFieldFlag.Repeated], @TRepeated(nil^).FString, TypeInfo(TArray<string>), nil),
+  FieldEntry.Create(15, TFieldKind.Bytes, [TFieldFlag.Repeated], @TRepeated(nil^).FBytes, TypeInfo(TArray<bytes>), nil),
+  FieldEntry.Create(16, TFieldKind.Enum8, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TRepeated(nil^).FEnum, TypeInfo(TArray<TEnum>), nil)]);
+TUnPacked.Table := MessageTable.Create(TypeInfo(TUnPacked), [
+  FieldEntry.Create(1, TFieldKind.Double, [TFieldFlag.Repeated], @TUnPacked(nil^).FDouble, TypeInfo(TArray<double>), nil),
+  FieldEntry.Create(2, TFieldKind.Float, [TFieldFlag.Repeated], @TUnPacked(nil^).FFloat, TypeInfo(TArray<float>), nil),
+  FieldEntry.Create(3, TFieldKind.Int32, [TFieldFlag.Repeated], @TUnPacked(nil^).FInt32, TypeInfo(TArray<int32>), nil),
+  FieldEntry.Create(4, TFieldKind.Int64, [TFieldFlag.Repeated], @TUnPacked(nil^).FInt64, TypeInfo(TArray<int64>), nil),
+  FieldEntry.Create(5, TFieldKind.UInt32, [TFieldFlag.Repeated], @TUnPacked(nil^).FUint32, TypeInfo(TArray<uint32>), nil),
+  FieldEntry.Create(6, TFieldKind.UInt64, [TFieldFlag.Repeated], @TUnPacked(nil^).FUint64, TypeInfo(TArray<uint64>), nil),
+  FieldEntry.Create(7, TFieldKind.SInt32, [TFieldFlag.Repeated], @TUnPacked(nil^).FSint32, TypeInfo(TArray<sint32>), nil),
+  FieldEntry.Create(8, TFieldKind.SInt64, [TFieldFlag.Repeated], @TUnPacked(nil^).FSint64, TypeInfo(TArray<sint64>), nil),
+  FieldEntry.Create(9, TFieldKind.Fixed32, [TFieldFlag.Repeated], @TUnPacked(nil^).FFixed32, TypeInfo(TArray<fixed32>), nil),
+  FieldEntry.Create(10, TFieldKind.Fixed64, [TFieldFlag.Repeated], @TUnPacked(nil^).FFixed64, TypeInfo(TArray<fixed64>), nil),
+  FieldEntry.Create(11, TFieldKind.SFixed32, [TFieldFlag.Repeated], @TUnPacked(nil^).FSfixed32, TypeInfo(TArray<sfixed32>), nil),
+  FieldEntry.Create(12, TFieldKind.SFixed64, [TFieldFlag.Repeated], @TUnPacked(nil^).FSfixed64, TypeInfo(TArray<sfixed64>), nil),
+  FieldEntry.Create(13, TFieldKind.Bool, [TFieldFlag.Repeated], @TUnPacked(nil^).FBool, TypeInfo(TArray<bool>), nil),
+  FieldEntry.Create(16, TFieldKind.Enum8, [TFieldFlag.Repeated], @TUnPacked(nil^).FEnum, TypeInfo(TArray<TEnum>), nil)]);
+TMessage.Table := MessageTable.Create(TypeInfo(TMessage), [
+  FieldEntry.Create(1, TFieldKind.Message, [TFieldFlag.Repeated], @TMessage(nil^).FOptional, TypeInfo(TArray<TOptional>), @TOptional.Table),
+  FieldEntry.Create(2, TFieldKind.Message, [TFieldFlag.Repeated], @TMessage(nil^).FDefault, TypeInfo(TArray<TDefault>), @TDefault.Table),
+  FieldEntry.Create(3, TFieldKind.Message, [TFieldFlag.Repeated], @TMessage(nil^).FRequired, TypeInfo(TArray<TRequired>), @TRequired.Table),
+  FieldEntry.Create(4, TFieldKind.Message, [TFieldFlag.Repeated], @TMessage(nil^).FRepeated, TypeInfo(TArray<TRepeated>), @TRepeated.Table),
+  FieldEntry.Create(5, TFieldKind.Message, [TFieldFlag.Repeated], @TMessage(nil^).FUnpacked, TypeInfo(TArray<TUnPacked>), @TUnPacked.Table)]);
+TSparseValues.Table := MessageTable.Create(TypeInfo(TSparseValues), [
+  FieldEntry.Create(1, TFieldKind.Enum32, [], @TSparseValues(nil^).FSparse),
+  FieldEntry.Create(2, TFieldKind.Enum32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TSparseValues(nil^).FSparses, TypeInfo(TArray<TSparse>), nil)]);
+TLazyFields.Table := MessageTable.Create(TypeInfo(TLazyFields), [
+  FieldEntry.Create(1, TFieldKind.Message, [TFieldFlag.Lazy], @TLazyFields(nil^).FOptional, nil, @TOptional.Table),
+  FieldEntry.Create(2, TFieldKind.Message, [TFieldFlag.Repeated, TFieldFlag.Lazy], @TLazyFields(nil^).FRepeated, TypeInfo(TArray<TLazyRepeated>), @TRepeated.Table)]);
+TJsonNames.Table := MessageTable.Create(TypeInfo(TJsonNames), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TJsonNames(nil^).FFirstName),
+  FieldEntry.Create(2, TFieldKind.Int32, [], @TJsonNames(nil^).FAlias)]);
+
 end.
@@ -0,0 +1,2765 @@
+unit Schema.Presence.Proto;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
+
+type
+
+  TInner = record
+    [Tag(1), Name('value')] FValue: int32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TInnerView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TInnerView; overload; static;
+    class function Create(const AValue: FieldValue): TInnerView; overload; static;
+    function HasValue: Boolean;
+    function GetValue: int32;
+  end;
+
+  TLevel = (
+    &None = 0,
+    &High = 1
+  );
+
+  TBoxedInner = record
+    private
+      FBox: TArray<TInner>; // empty while the message is absent
+      function GetValue: TInner;
+      procedure SetValue(const AValue: TInner);
+    public
+      property Value: TInner read GetValue write SetValue;
+      function HasValue: Boolean; inline;
+      procedure Clear; inline;
+      function ComputeSize(AWriter: TWriter): Integer;
+      procedure EncodeTo(AWriter: TWriter);
+      procedure MergeFrom(AReader: TReader);
+  end;
+
+  TPresenceChoiceCase = (
+    &PresenceChoiceUnspecified = 0,
+    &PresenceFirst = 1,
+    &PresenceSecond = 2
+  );
+
+  TPresence = record
+    [Tag(1), Name('int32')] FInt32: int32;
+    [Tag(2), Name('double')] FDouble: double;
+    [Tag(3), Name('bool')] FBool: bool;
+    [Tag(4), Name('string')] FString: string;
+    [Tag(5), Name('bytes')] FBytes: bytes;
+    [Tag(6), Name('level')] FLevel: TLevel;
+    [Tag(7), Name('sint64')] FSint64: sint64;
+    [Tag(8), Name('implicit')] FImplicit: int32;
+    [Tag(9), Name('repeated')] FRepeated: TArray<int32>;
+    [Oneof] FChoice: record
+      [Oneof] FCase: TPresenceChoiceCase;
+      [Tag(10), Name('first')] FFirst: int32;
+      [Tag(11), Name('second')] FSecond: string;
+    end;
+    [Tag(12), Name('inner')] FInner: TBoxedInner;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    function HasInt32: Boolean; inline;
+    procedure SetInt32(const AValue: int32); inline;
+    procedure ClearInt32; inline;
+    function HasDouble: Boolean; inline;
+    procedure SetDouble(const AValue: double); inline;
+    procedure ClearDouble; inline;
+    function HasBool: Boolean; inline;
+    procedure SetBool(const AValue: bool); inline;
+    procedure ClearBool; inline;
+    function HasString: Boolean; inline;
+    procedure SetString(const AValue: string); inline;
+    procedure ClearString; inline;
+    function HasBytes: Boolean; inline;
+    procedure SetBytes(const AValue: bytes); inline;
+    procedure ClearBytes; inline;
+    function HasLevel: Boolean; inline;
+    procedure SetLevel(const AValue: TLevel); inline;
+    procedure ClearLevel; inline;
+    function HasSint64: Boolean; inline;
+    procedure SetSint64(const AValue: sint64); inline;
+    procedure ClearSint64; inline;
+    private
+      FPresence: UInt32;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TPresenceView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TPresenceView; overload; static;
+    class function Create(const AValue: FieldValue): TPresenceView; overload; static;
+    function HasInt32: Boolean;
+    function GetInt32: int32;
+    function HasDouble: Boolean;
+    function GetDouble: double;
+    function HasBool: Boolean;
+    function GetBool: bool;
+    function HasString: Boolean;
+    function GetString: ByteSlice;
+    function HasBytes: Boolean;
+    function GetBytes: ByteSlice;
+    function HasLevel: Boolean;
+    function GetLevel: TLevel;
+    function HasSint64: Boolean;
+    function GetSint64: sint64;
+    function HasImplicit: Boolean;
+    function GetImplicit: int32;
+    function GetRepeated: FieldCursor;
+    function HasFirst: Boolean;
+    function GetFirst: int32;
+    function HasSecond: Boolean;
+    function GetSecond: ByteSlice;
+    function HasInner: Boolean;
+    function GetInner: TInnerView;
+  end;
+
+  TWidePresence = record
+    [Tag(1), Name('alpha')] FAlpha: int32;
+    [Tag(2), Name('bravo')] FBravo: int32;
+    [Tag(3), Name('charlie')] FCharlie: int32;
+    [Tag(4), Name('delta')] FDelta: int32;
+    [Tag(5), Name('echo')] FEcho: int32;
+    [Tag(6), Name('foxtrot')] FFoxtrot: int32;
+    [Tag(7), Name('golf')] FGolf: int32;
+    [Tag(8), Name('hotel')] FHotel: int32;
+    [Tag(9), Name('india')] FIndia: int32;
+    [Tag(10), Name('juliet')] FJuliet: int32;
+    [Tag(11), Name('kilo')] FKilo: int32;
+    [Tag(12), Name('lima')] FLima: int32;
+    [Tag(13), Name('mike')] FMike: int32;
+    [Tag(14), Name('november')] FNovember: int32;
+    [Tag(15), Name('oscar')] FOscar: int32;
+    [Tag(16), Name('papa')] FPapa: int32;
+    [Tag(17), Name('quebec')] FQuebec: int32;
+    [Tag(18), Name('romeo')] FRomeo: int32;
+    [Tag(19), Name('sierra')] FSierra: int32;
+    [Tag(20), Name('tango')] FTango: int32;
+    [Tag(21), Name('uniform')] FUniform: int32;
+    [Tag(22), Name('victor')] FVictor: int32;
+    [Tag(23), Name('whiskey')] FWhiskey: int32;
+    [Tag(24), Name('xray')] FXray: int32;
+    [Tag(25), Name('yankee')] FYankee: int32;
+    [Tag(26), Name('zulu')] FZulu: int32;
+    [Tag(27), Name('amber')] FAmber: int32;
+    [Tag(28), Name('bronze')] FBronze: int32;
+    [Tag(29), Name('copper')] FCopper: int32;
+    [Tag(30), Name('diamond')] FDiamond: int32;
+    [Tag(31), Name('emerald')] FEmerald: int32;
+    [Tag(32), Name('flint')] FFlint: int32;
+    [Tag(33), Name('garnet')] FGarnet: int32;
+    [Tag(34), Name('hematite')] FHematite: int32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    function HasAlpha: Boolean; inline;
+    procedure SetAlpha(const AValue: int32); inline;
+    procedure ClearAlpha; inline;
+    function HasBravo: Boolean; inline;
+    procedure SetBravo(const AValue: int32); inline;
+    procedure ClearBravo; inline;
+    function HasCharlie: Boolean; inline;
+    procedure SetCharlie(const AValue: int32); inline;
+    procedure ClearCharlie; inline;
+    function HasDelta: Boolean; inline;
+    procedure SetDelta(const AValue: int32); inline;
+    procedure ClearDelta; inline;
+    function HasEcho: Boolean; inline;
+    procedure SetEcho(const AValue: int32); inline;
+    procedure ClearEcho; inline;
+    function HasFoxtrot: Boolean; inline;
+    procedure SetFoxtrot(const AValue: int32); inline;
+    procedure ClearFoxtrot; inline;
+    function HasGolf: Boolean; inline;
+    procedure SetGolf(const AValue: int32); inline;
+    procedure ClearGolf; inline;
+    function HasHotel: Boolean; inline;
+    procedure SetHotel(const AValue: int32); inline;
+    procedure ClearHotel; inline;
+    function HasIndia: Boolean; inline;
+    procedure SetIndia(const AValue: int32); inline;
+    procedure ClearIndia; inline;
+    function HasJuliet: Boolean; inline;
+    procedure SetJuliet(const AValue: int32); inline;
+    procedure ClearJuliet; inline;
+    function HasKilo: Boolean; inline;
+    procedure SetKilo(const AValue: int32); inline;
+    procedure ClearKilo; inline;
+    function HasLima: Boolean; inline;
+    procedure SetLima(const AValue: int32); inline;
+    procedure ClearLima; inline;
+    function HasMike: Boolean; inline;
+    procedure SetMike(const AValue: int32); inline;
+    procedure ClearMike; inline;
+    function HasNovember: Boolean; inline;
+    procedure SetNovember(const AValue: int32); inline;
+    procedure ClearNovember; inline;
+    function HasOscar: Boolean; inline;
+    procedure SetOscar(const AValue: int32); inline;
+    procedure ClearOscar; inline;
+    function HasPapa: Boolean; inline;
+    procedure SetPapa(const AValue: int32); inline;
+    procedure ClearPapa; inline;
+    function HasQuebec: Boolean; inline;
+    procedure SetQuebec(const AValue: int32); inline;
+    procedure ClearQuebec; inline;
+    function HasRomeo: Boolean; inline;
+    procedure SetRomeo(const AValue: int32); inline;
+    procedure ClearRomeo; inline;
+    function HasSierra: Boolean; inline;
+    procedure SetSierra(const AValue: int32); inline;
+    procedure ClearSierra; inline;
+    function HasTango: Boolean; inline;
+    procedure SetTango(const AValue: int32); inline;
+    procedure ClearTango; inline;
+    function HasUniform: Boolean; inline;
+    procedure SetUniform(const AValue: int32); inline;
+    procedure ClearUniform; inline;
+    function HasVictor: Boolean; inline;
+    procedure SetVictor(const AValue: int32); inline;
+    procedure ClearVictor; inline;
+    function HasWhiskey: Boolean; inline;
+    procedure SetWhiskey(const AValue: int32); inline;
+    procedure ClearWhiskey; inline;
+    function HasXray: Boolean; inline;
+    procedure SetXray(const AValue: int32); inline;
+    procedure ClearXray; inline;
+    function HasYankee: Boolean; inline;
+    procedure SetYankee(const AValue: int32); inline;
+    procedure ClearYankee; inline;
+    function HasZulu: Boolean; inline;
+    procedure SetZulu(const AValue: int32); inline;
+    procedure ClearZulu; inline;
+    function HasAmber: Boolean; inline;
+    procedure SetAmber(const AValue: int32); inline;
+    procedure ClearAmber; inline;
+    function HasBronze: Boolean; inline;
+    procedure SetBronze(const AValue: int32); inline;
+    procedure ClearBronze; inline;
+    function HasCopper: Boolean; inline;
+    procedure SetCopper(const AValue: int32); inline;
+    procedure ClearCopper; inline;
+    function HasDiamond: Boolean; inline;
+    procedure SetDiamond(const AValue: int32); inline;
+    procedure ClearDiamond; inline;
+    function HasEmerald: Boolean; inline;
+    procedure SetEmerald(const AValue: int32); inline;
+    procedure ClearEmerald; inline;
+    function HasFlint: Boolean; inline;
+    procedure SetFlint(const AValue: int32); inline;
+    procedure ClearFlint; inline;
+    function HasGarnet: Boolean; inline;
+    procedure SetGarnet(const AValue: int32); inline;
+    procedure ClearGarnet; inline;
+    function HasHematite: Boolean; inline;
+    procedure SetHematite(const AValue: int32); inline;
+    procedure ClearHematite; inline;
+    private
+      FPresence: array [0 .. 1] of UInt32;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TWidePresenceView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TWidePresenceView; overload; static;
+    class function Create(const AValue: FieldValue): TWidePresenceView; overload; static;
+    function HasAlpha: Boolean;
+    function GetAlpha: int32;
+    function HasBravo: Boolean;
+    function GetBravo: int32;
+    function HasCharlie: Boolean;
+    function GetCharlie: int32;
+    function HasDelta: Boolean;
+    function GetDelta: int32;
+    function HasEcho: Boolean;
+    function GetEcho: int32;
+    function HasFoxtrot: Boolean;
+    function GetFoxtrot: int32;
+    function HasGolf: Boolean;
+    function GetGolf: int32;
+    function HasHotel: Boolean;
+    function GetHotel: int32;
+    function HasIndia: Boolean;
+    function GetIndia: int32;
+    function HasJuliet: Boolean;
+    function GetJuliet: int32;
+    function HasKilo: Boolean;
+    function GetKilo: int32;
+    function HasLima: Boolean;
+    function GetLima: int32;
+    function HasMike: Boolean;
+    function GetMike: int32;
+    function HasNovember: Boolean;
+    function GetNovember: int32;
+    function HasOscar: Boolean;
+    function GetOscar: int32;
+    function HasPapa: Boolean;
+    function GetPapa: int32;
+    function HasQuebec: Boolean;
+    function GetQuebec: int32;
+    function HasRomeo: Boolean;
+    function GetRomeo: int32;
+    function HasSierra: Boolean;
+    function GetSierra: int32;
+    function HasTango: Boolean;
+    function GetTango: int32;
+    function HasUniform: Boolean;
+    function GetUniform: int32;
+    function HasVictor: Boolean;
+    function GetVictor: int32;
+    function HasWhiskey: Boolean;
+    function GetWhiskey: int32;
+    function HasXray: Boolean;
+    function GetXray: int32;
+    function HasYankee: Boolean;
+    function GetYankee: int32;
+    function HasZulu: Boolean;
+    function GetZulu: int32;
+    function HasAmber: Boolean;
+    function GetAmber: int32;
+    function HasBronze: Boolean;
+    function GetBronze: int32;
+    function HasCopper: Boolean;
+    function GetCopper: int32;
+    function HasDiamond: Boolean;
+    function GetDiamond: int32;
+    function HasEmerald: Boolean;
+    function GetEmerald: int32;
+    function HasFlint: Boolean;
+    function GetFlint: int32;
+    function HasGarnet: Boolean;
+    function GetGarnet: int32;
+    function HasHematite: Boolean;
+    function GetHematite: int32;
+  end;
+
+implementation
+
+const
+  CLevelByValue: array [0 .. 1] of string = (
+    'None',
+    'High'
+  );
+
+const
+  CInnerFieldSeeds: array [0 .. 0] of Int32 = (
+    -1
+  );
+  CInnerFieldNames: array [0 .. 0] of NamedValue = (
+    (FValue: 1; FName: 'value')
+  );
+
+class function TInner.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CInnerFieldSeeds, CInnerFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CPresenceFieldSeeds: array [0 .. 11] of Int32 = (
+    -3, -5, 0, -7, 1, 0, 0, 2, -10, -11, 3, -12
+  );
+  CPresenceFieldNames: array [0 .. 11] of NamedValue = (
+    (FValue: 6; FName: 'level'),
+    (FValue: 5; FName: 'bytes'),
+    (FValue: 7; FName: 'sint64'),
+    (FValue: 2; FName: 'double'),
+    (FValue: 4; FName: 'string'),
+    (FValue: 12; FName: 'inner'),
+    (FValue: 10; FName: 'first'),
+    (FValue: 8; FName: 'implicit'),
+    (FValue: 9; FName: 'repeated'),
+    (FValue: 11; FName: 'second'),
+    (FValue: 3; FName: 'bool'),
+    (FValue: 1; FName: 'int32')
+  );
+
+class function TPresence.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CPresenceFieldSeeds, CPresenceFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CWidePresenceFieldSeeds: array [0 .. 33] of Int32 = (
+    -3, -7, -8, 0, 0, 0, -10, 0, 0, 1, -11, 1, -12, 2, 1, -16,
+    1, 0, 1, -18, -19, -20, 0, 2, 2, 1, 0, -22, -24, -28, 0, -30,
+    -31, 0
+  );
+  CWidePresenceFieldNames: array [0 .. 33] of NamedValue = (
+    (FValue: 31; FName: 'emerald'),
+    (FValue: 13; FName: 'mike'),
+    (FValue: 12; FName: 'lima'),
+    (FValue: 8; FName: 'hotel'),
+    (FValue: 4; FName: 'delta'),
+    (FValue: 28; FName: 'bronze'),
+    (FValue: 20; FName: 'tango'),
+    (FValue: 18; FName: 'romeo'),
+    (FValue: 25; FName: 'yankee'),
+    (FValue: 32; FName: 'flint'),
+    (FValue: 26; FName: 'zulu'),
+    (FValue: 1; FName: 'alpha'),
+    (FValue: 34; FName: 'hematite'),
+    (FValue: 14; FName: 'november'),
+    (FValue: 17; FName: 'quebec'),
+    (FValue: 16; FName: 'papa'),
+    (FValue: 23; FName: 'whiskey'),
+    (FValue: 22; FName: 'victor'),
+    (FValue: 29; FName: 'copper'),
+    (FValue: 2; FName: 'bravo'),
+    (FValue: 10; FName: 'juliet'),
+    (FValue: 3; FName: 'charlie'),
+    (FValue: 27; FName: 'amber'),
+    (FValue: 5; FName: 'echo'),
+    (FValue: 33; FName: 'garnet'),
+    (FValue: 11; FName: 'kilo'),
+    (FValue: 15; FName: 'oscar'),
+    (FValue: 21; FName: 'uniform'),
+    (FValue: 6; FName: 'foxtrot'),
+    (FValue: 7; FName: 'golf'),
+    (FValue: 9; FName: 'india'),
+    (FValue: 19; FName: 'sierra'),
+    (FValue: 30; FName: 'diamond'),
+    (FValue: 24; FName: 'xray')
+  );
+
+class function TWidePresence.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CWidePresenceFieldSeeds, CWidePresenceFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+function TBoxedInner.GetValue: TInner;
+begin
+  if FBox <> nil then
+    Result := FBox[0]
+  else
+    Result := Default(TInner);
+end;
+
+procedure TBoxedInner.SetValue(const AValue: TInner);
+begin
+  FBox := [AValue];
+end;
+
+function TBoxedInner.HasValue: Boolean;
+begin
+  Result := FBox <> nil;
+end;
+
+procedure TBoxedInner.Clear;
+begin
+  FBox := nil;
+end;
+
+function TBoxedInner.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := FBox[0].ComputeSize(AWriter);
+end;
+
+procedure TBoxedInner.EncodeTo(AWriter: TWriter);
+begin
+  FBox[0].EncodeTo(AWriter);
+end;
+
+procedure TBoxedInner.MergeFrom(AReader: TReader);
+begin
+  SetLength(FBox, 1); // allocates the box, or copies it if it is shared
+  AReader.BeginLengthPrefixed;
+  FBox[0].ParseFrom(AReader);
+  AReader.EndLengthPrefixed;
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag2VarInt: EncodedTag = (FBytes: $10; FCount: 1);
+  CTag2Fixed64: EncodedTag = (FBytes: $11; FCount: 1);
+  CTag3VarInt: EncodedTag = (FBytes: $18; FCount: 1);
+  CTag4VarInt: EncodedTag = (FBytes: $20; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5VarInt: EncodedTag = (FBytes: $28; FCount: 1);
+  CTag5LengthPrefixed: EncodedTag = (FBytes: $2A; FCount: 1);
+  CTag6VarInt: EncodedTag = (FBytes: $30; FCount: 1);
+  CTag7VarInt: EncodedTag = (FBytes: $38; FCount: 1);
+  CTag8VarInt: EncodedTag = (FBytes: $40; FCount: 1);
+  CTag9VarInt: EncodedTag = (FBytes: $48; FCount: 1);
+  CTag9LengthPrefixed: EncodedTag = (FBytes: $4A; FCount: 1);
+  CTag10VarInt: EncodedTag = (FBytes: $50; FCount: 1);
+  CTag11VarInt: EncodedTag = (FBytes: $58; FCount: 1);
+  CTag11LengthPrefixed: EncodedTag = (FBytes: $5A; FCount: 1);
+  CTag12VarInt: EncodedTag = (FBytes: $60; FCount: 1);
+  CTag12LengthPrefixed: EncodedTag = (FBytes: $62; FCount: 1);
+  CTag13VarInt: EncodedTag = (FBytes: $68; FCount: 1);
+  CTag14VarInt: EncodedTag = (FBytes: $70; FCount: 1);
+  CTag15VarInt: EncodedTag = (FBytes: $78; FCount: 1);
+  CTag16VarInt: EncodedTag = (FBytes: $0180; FCount: 2);
+  CTag17VarInt: EncodedTag = (FBytes: $0188; FCount: 2);
+  CTag18VarInt: EncodedTag = (FBytes: $0190; FCount: 2);
+  CTag19VarInt: EncodedTag = (FBytes: $0198; FCount: 2);
+  CTag20VarInt: EncodedTag = (FBytes: $01A0; FCount: 2);
+  CTag21VarInt: EncodedTag = (FBytes: $01A8; FCount: 2);
+  CTag22VarInt: EncodedTag = (FBytes: $01B0; FCount: 2);
+  CTag23VarInt: EncodedTag = (FBytes: $01B8; FCount: 2);
+  CTag24VarInt: EncodedTag = (FBytes: $01C0; FCount: 2);
+  CTag25VarInt: EncodedTag = (FBytes: $01C8; FCount: 2);
+  CTag26VarInt: EncodedTag = (FBytes: $01D0; FCount: 2);
+  CTag27VarInt: EncodedTag = (FBytes: $01D8; FCount: 2);
+  CTag28VarInt: EncodedTag = (FBytes: $01E0; FCount: 2);
+  CTag29VarInt: EncodedTag = (FBytes: $01E8; FCount: 2);
+  CTag30VarInt: EncodedTag = (FBytes: $01F0; FCount: 2);
+  CTag31VarInt: EncodedTag = (FBytes: $01F8; FCount: 2);
+  CTag32VarInt: EncodedTag = (FBytes: $0280; FCount: 2);
+  CTag33VarInt: EncodedTag = (FBytes: $0288; FCount: 2);
+  CTag34VarInt: EncodedTag = (FBytes: $0290; FCount: 2);
+
+procedure TInner.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TInner.EncodeTo(AWriter: TWriter);
+begin
+  if FValue <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FValue));
+    end;
+end;
+
+function TInner.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FValue <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FValue));
+    end;
+end;
+
+procedure TInner.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FValue := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TPresence.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TPresence.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  if FPresence and $1 <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FInt32));
+    end;
+  if FPresence and $2 <> 0 then
+    begin
+      AWriter.Pack(CTag2Fixed64);
+      AWriter.Pack(FixedInt64(FDouble));
+    end;
+  if FPresence and $4 <> 0 then
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(VarInt(Ord(FBool)));
+    end;
+  if FPresence and $8 <> 0 then
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(FString, AWriter.NextSize);
+    end;
+  if FPresence and $10 <> 0 then
+    begin
+      AWriter.Pack(CTag5LengthPrefixed);
+      AWriter.Pack(FBytes);
+    end;
+  if FPresence and $20 <> 0 then
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(VarInt(Ord(FLevel)));
+    end;
+  if FPresence and $40 <> 0 then
+    begin
+      AWriter.Pack(CTag7VarInt);
+      AWriter.Pack(SignedInt(Int64(FSint64)));
+    end;
+  if FImplicit <> 0 then
+    begin
+      AWriter.Pack(CTag8VarInt);
+      AWriter.Pack(VarInt(FImplicit));
+    end;
+  if Length(FRepeated) > 0 then
+    begin
+      AWriter.Pack(CTag9LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FRepeated) do
+        AWriter.Pack(VarInt(FRepeated[I]));
+    end;
+  case Ord(FChoice.FCase) of
+    1:
+      begin
+        AWriter.Pack(CTag10VarInt);
+        AWriter.Pack(VarInt(FChoice.FFirst));
+      end;
+    2:
+      begin
+        AWriter.Pack(CTag11LengthPrefixed);
+        AWriter.Pack(FChoice.FSecond, AWriter.NextSize);
+      end;
+  end;
+  if FInner.HasValue then
+    begin
+      AWriter.Pack(CTag12LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FInner.EncodeTo(AWriter);
+    end;
+end;
+
+function TPresence.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FPresence and $1 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FInt32));
+    end;
+  if FPresence and $2 <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FPresence and $4 <> 0 then
+    begin
+      Inc(Result, 1 + 1);
+    end;
+  if FPresence and $8 <> 0 then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FString));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FPresence and $10 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FBytes)) + Length(FBytes));
+    end;
+  if FPresence and $20 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Ord(FLevel)));
+    end;
+  if FPresence and $40 <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int64(FSint64)));
+    end;
+  if FImplicit <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FImplicit));
+    end;
+  if Length(FRepeated) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FRepeated) do
+        Inc(Size, VarInt.ByteCount(FRepeated[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  case Ord(FChoice.FCase) of
+    1:
+      begin
+        Inc(Result, 1 + VarInt.ByteCount(FChoice.FFirst));
+      end;
+    2:
+      begin
+        Size := AWriter.StoreSize(TWriter.ByteCount(FChoice.FSecond));
+        Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+      end;
+  end;
+  if FInner.HasValue then
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FInner.ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TPresence.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FInt32 := Int32(VarIntValue);
+              FPresence := FPresence or $1;
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FDouble := Double(Fixed64Value);
+              FPresence := FPresence or $2;
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBool := UInt64(VarIntValue) <> 0;
+              FPresence := FPresence or $4;
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FString);
+              FPresence := FPresence or $8;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FBytes);
+              FPresence := FPresence or $10;
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FLevel := TLevel(Int32(VarIntValue));
+              FPresence := FPresence or $20;
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FSint64 := Int64(SignedIntValue);
+              FPresence := FPresence or $40;
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FImplicit := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FRepeated, Length(FRepeated) + 1);
+                  AReader.Parse(VarIntValue);
+                  FRepeated[High(FRepeated)] := Int32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FRepeated, Length(FRepeated) + 1);
+              AReader.Parse(VarIntValue);
+              FRepeated[High(FRepeated)] := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.VarInt then
+            begin
+              if FChoice.FCase <> TPresenceChoiceCase.&PresenceFirst then
+                case FChoice.FCase of
+                  TPresenceChoiceCase.&PresenceSecond:
+                    FChoice.FSecond := Default(string);
+                end;
+              FChoice.FCase := TPresenceChoiceCase.&PresenceFirst;
+              AReader.Parse(VarIntValue);
+              FChoice.FFirst := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              if FChoice.FCase <> TPresenceChoiceCase.&PresenceSecond then
+                case FChoice.FCase of
+                  TPresenceChoiceCase.&PresenceFirst:
+                    FChoice.FFirst := Default(int32);
+                end;
+              FChoice.FCase := TPresenceChoiceCase.&PresenceSecond;
+              AReader.Parse(FChoice.FSecond);
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FInner.MergeFrom(AReader);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TWidePresence.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TWidePresence.EncodeTo(AWriter: TWriter);
+begin
+  if FPresence[0] and $1 <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FAlpha));
+    end;
+  if FPresence[0] and $2 <> 0 then
+    begin
+      AWriter.Pack(CTag2VarInt);
+      AWriter.Pack(VarInt(FBravo));
+    end;
+  if FPresence[0] and $4 <> 0 then
+    begin
+      AWriter.Pack(CTag3VarInt);
+      AWriter.Pack(VarInt(FCharlie));
+    end;
+  if FPresence[0] and $8 <> 0 then
+    begin
+      AWriter.Pack(CTag4VarInt);
+      AWriter.Pack(VarInt(FDelta));
+    end;
+  if FPresence[0] and $10 <> 0 then
+    begin
+      AWriter.Pack(CTag5VarInt);
+      AWriter.Pack(VarInt(FEcho));
+    end;
+  if FPresence[0] and $20 <> 0 then
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(VarInt(FFoxtrot));
+    end;
+  if FPresence[0] and $40 <> 0 then
+    begin
+      AWriter.Pack(CTag7VarInt);
+      AWriter.Pack(VarInt(FGolf));
+    end;
+  if FPresence[0] and $80 <> 0 then
+    begin
+      AWriter.Pack(CTag8VarInt);
+      AWriter.Pack(VarInt(FHotel));
+    end;
+  if FPresence[0] and $100 <> 0 then
+    begin
+      AWriter.Pack(CTag9VarInt);
+      AWriter.Pack(VarInt(FIndia));
+    end;
+  if FPresence[0] and $200 <> 0 then
+    begin
+      AWriter.Pack(CTag10VarInt);
+      AWriter.Pack(VarInt(FJuliet));
+    end;
+  if FPresence[0] and $400 <> 0 then
+    begin
+      AWriter.Pack(CTag11VarInt);
+      AWriter.Pack(VarInt(FKilo));
+    end;
+  if FPresence[0] and $800 <> 0 then
+    begin
+      AWriter.Pack(CTag12VarInt);
+      AWriter.Pack(VarInt(FLima));
+    end;
+  if FPresence[0] and $1000 <> 0 then
+    begin
+      AWriter.Pack(CTag13VarInt);
+      AWriter.Pack(VarInt(FMike));
+    end;
+  if FPresence[0] and $2000 <> 0 then
+    begin
+      AWriter.Pack(CTag14VarInt);
+      AWriter.Pack(VarInt(FNovember));
+    end;
+  if FPresence[0] and $4000 <> 0 then
+    begin
+      AWriter.Pack(CTag15VarInt);
+      AWriter.Pack(VarInt(FOscar));
+    end;
+  if FPresence[0] and $8000 <> 0 then
+    begin
+      AWriter.Pack(CTag16VarInt);
+      AWriter.Pack(VarInt(FPapa));
+    end;
+  if FPresence[0] and $10000 <> 0 then
+    begin
+      AWriter.Pack(CTag17VarInt);
+      AWriter.Pack(VarInt(FQuebec));
+    end;
+  if FPresence[0] and $20000 <> 0 then
+    begin
+      AWriter.Pack(CTag18VarInt);
+      AWriter.Pack(VarInt(FRomeo));
+    end;
+  if FPresence[0] and $40000 <> 0 then
+    begin
+      AWriter.Pack(CTag19VarInt);
+      AWriter.Pack(VarInt(FSierra));
+    end;
+  if FPresence[0] and $80000 <> 0 then
+    begin
+      AWriter.Pack(CTag20VarInt);
+      AWriter.Pack(VarInt(FTango));
+    end;
+  if FPresence[0] and $100000 <> 0 then
+    begin
+      AWriter.Pack(CTag21VarInt);
+      AWriter.Pack(VarInt(FUniform));
+    end;
+  if FPresence[0] and $200000 <> 0 then
+    begin
+      AWriter.Pack(CTag22VarInt);
+      AWriter.Pack(VarInt(FVictor));
+    end;
+  if FPresence[0] and $400000 <> 0 then
+    begin
+      AWriter.Pack(CTag23VarInt);
+      AWriter.Pack(VarInt(FWhiskey));
+    end;
+  if FPresence[0] and $800000 <> 0 then
+    begin
+      AWriter.Pack(CTag24VarInt);
+      AWriter.Pack(VarInt(FXray));
+    end;
+  if FPresence[0] and $1000000 <> 0 then
+    begin
+      AWriter.Pack(CTag25VarInt);
+      AWriter.Pack(VarInt(FYankee));
+    end;
+  if FPresence[0] and $2000000 <> 0 then
+    begin
+      AWriter.Pack(CTag26VarInt);
+      AWriter.Pack(VarInt(FZulu));
+    end;
+  if FPresence[0] and $4000000 <> 0 then
+    begin
+      AWriter.Pack(CTag27VarInt);
+      AWriter.Pack(VarInt(FAmber));
+    end;
+  if FPresence[0] and $8000000 <> 0 then
+    begin
+      AWriter.Pack(CTag28VarInt);
+      AWriter.Pack(VarInt(FBronze));
+    end;
+  if FPresence[0] and $10000000 <> 0 then
+    begin
+      AWriter.Pack(CTag29VarInt);
+      AWriter.Pack(VarInt(FCopper));
+    end;
+  if FPresence[0] and $20000000 <> 0 then
+    begin
+      AWriter.Pack(CTag30VarInt);
+      AWriter.Pack(VarInt(FDiamond));
+    end;
+  if FPresence[0] and $40000000 <> 0 then
+    begin
+      AWriter.Pack(CTag31VarInt);
+      AWriter.Pack(VarInt(FEmerald));
+    end;
+  if FPresence[0] and $80000000 <> 0 then
+    begin
+      AWriter.Pack(CTag32VarInt);
+      AWriter.Pack(VarInt(FFlint));
+    end;
+  if FPresence[1] and $1 <> 0 then
+    begin
+      AWriter.Pack(CTag33VarInt);
+      AWriter.Pack(VarInt(FGarnet));
+    end;
+  if FPresence[1] and $2 <> 0 then
+    begin
+      AWriter.Pack(CTag34VarInt);
+      AWriter.Pack(VarInt(FHematite));
+    end;
+end;
+
+function TWidePresence.ComputeSize(AWriter: TWriter): Integer;
+begin
+  Result := 0;
+  if FPresence[0] and $1 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FAlpha));
+    end;
+  if FPresence[0] and $2 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FBravo));
+    end;
+  if FPresence[0] and $4 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FCharlie));
+    end;
+  if FPresence[0] and $8 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FDelta));
+    end;
+  if FPresence[0] and $10 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FEcho));
+    end;
+  if FPresence[0] and $20 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FFoxtrot));
+    end;
+  if FPresence[0] and $40 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FGolf));
+    end;
+  if FPresence[0] and $80 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FHotel));
+    end;
+  if FPresence[0] and $100 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FIndia));
+    end;
+  if FPresence[0] and $200 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FJuliet));
+    end;
+  if FPresence[0] and $400 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FKilo));
+    end;
+  if FPresence[0] and $800 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FLima));
+    end;
+  if FPresence[0] and $1000 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FMike));
+    end;
+  if FPresence[0] and $2000 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FNovember));
+    end;
+  if FPresence[0] and $4000 <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FOscar));
+    end;
+  if FPresence[0] and $8000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FPapa));
+    end;
+  if FPresence[0] and $10000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FQuebec));
+    end;
+  if FPresence[0] and $20000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FRomeo));
+    end;
+  if FPresence[0] and $40000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FSierra));
+    end;
+  if FPresence[0] and $80000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FTango));
+    end;
+  if FPresence[0] and $100000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FUniform));
+    end;
+  if FPresence[0] and $200000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FVictor));
+    end;
+  if FPresence[0] and $400000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FWhiskey));
+    end;
+  if FPresence[0] and $800000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FXray));
+    end;
+  if FPresence[0] and $1000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FYankee));
+    end;
+  if FPresence[0] and $2000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FZulu));
+    end;
+  if FPresence[0] and $4000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FAmber));
+    end;
+  if FPresence[0] and $8000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FBronze));
+    end;
+  if FPresence[0] and $10000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FCopper));
+    end;
+  if FPresence[0] and $20000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FDiamond));
+    end;
+  if FPresence[0] and $40000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FEmerald));
+    end;
+  if FPresence[0] and $80000000 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FFlint));
+    end;
+  if FPresence[1] and $1 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FGarnet));
+    end;
+  if FPresence[1] and $2 <> 0 then
+    begin
+      Inc(Result, 2 + VarInt.ByteCount(FHematite));
+    end;
+end;
+
+procedure TWidePresence.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FAlpha := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $1;
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBravo := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $2;
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FCharlie := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $4;
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FDelta := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $8;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FEcho := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $10;
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FFoxtrot := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $20;
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FGolf := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $40;
+            end
+          else
+            AReader.SkipField(WireType);
+        8:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FHotel := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $80;
+            end
+          else
+            AReader.SkipField(WireType);
+        9:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FIndia := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $100;
+            end
+          else
+            AReader.SkipField(WireType);
+        10:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FJuliet := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $200;
+            end
+          else
+            AReader.SkipField(WireType);
+        11:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FKilo := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $400;
+            end
+          else
+            AReader.SkipField(WireType);
+        12:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FLima := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $800;
+            end
+          else
+            AReader.SkipField(WireType);
+        13:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FMike := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $1000;
+            end
+          else
+            AReader.SkipField(WireType);
+        14:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FNovember := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $2000;
+            end
+          else
+            AReader.SkipField(WireType);
+        15:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FOscar := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $4000;
+            end
+          else
+            AReader.SkipField(WireType);
+        16:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FPapa := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $8000;
+            end
+          else
+            AReader.SkipField(WireType);
+        17:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FQuebec := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $10000;
+            end
+          else
+            AReader.SkipField(WireType);
+        18:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FRomeo := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $20000;
+            end
+          else
+            AReader.SkipField(WireType);
+        19:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FSierra := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $40000;
+            end
+          else
+            AReader.SkipField(WireType);
+        20:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FTango := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $80000;
+            end
+          else
+            AReader.SkipField(WireType);
+        21:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FUniform := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $100000;
+            end
+          else
+            AReader.SkipField(WireType);
+        22:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FVictor := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $200000;
+            end
+          else
+            AReader.SkipField(WireType);
+        23:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FWhiskey := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $400000;
+            end
+          else
+            AReader.SkipField(WireType);
+        24:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FXray := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $800000;
+            end
+          else
+            AReader.SkipField(WireType);
+        25:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FYankee := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $1000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        26:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FZulu := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $2000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        27:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FAmber := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $4000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        28:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FBronze := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $8000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        29:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FCopper := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $10000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        30:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FDiamond := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $20000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        31:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FEmerald := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $40000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        32:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FFlint := Int32(VarIntValue);
+              FPresence[0] := FPresence[0] or $80000000;
+            end
+          else
+            AReader.SkipField(WireType);
+        33:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FGarnet := Int32(VarIntValue);
+              FPresence[1] := FPresence[1] or $1;
+            end
+          else
+            AReader.SkipField(WireType);
+        34:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FHematite := Int32(VarIntValue);
+              FPresence[1] := FPresence[1] or $2;
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+function TPresence.HasInt32: Boolean;
+begin
+  Result := FPresence and $1 <> 0;
+end;
+
+procedure TPresence.SetInt32(const AValue: int32);
+begin
+  FInt32 := AValue;
+  FPresence := FPresence or $1;
+end;
+
+procedure TPresence.ClearInt32;
+begin
+  FInt32 := Default(int32);
+  FPresence := FPresence and not UInt32($1);
+end;
+
+function TPresence.HasDouble: Boolean;
+begin
+  Result := FPresence and $2 <> 0;
+end;
+
+procedure TPresence.SetDouble(const AValue: double);
+begin
+  FDouble := AValue;
+  FPresence := FPresence or $2;
+end;
+
+procedure TPresence.ClearDouble;
+begin
+  FDouble := Default(double);
+  FPresence := FPresence and not UInt32($2);
+end;
+
+function TPresence.HasBool: Boolean;
+begin
+  Result := FPresence and $4 <> 0;
+end;
+
+procedure TPresence.SetBool(const AValue: bool);
+begin
+  FBool := AValue;
+  FPresence := FPresence or $4;
+end;
+
+procedure TPresence.ClearBool;
+begin
+  FBool := Default(bool);
+  FPresence := FPresence and not UInt32($4);
+end;
+
+function TPresence.HasString: Boolean;
+begin
+  Result := FPresence and $8 <> 0;
+end;
+
+procedure TPresence.SetString(const AValue: string);
+begin
+  FString := AValue;
+  FPresence := FPresence or $8;
+end;
+
+procedure TPresence.ClearString;
+begin
+  FString := Default(string);
+  FPresence := FPresence and not UInt32($8);
+end;
+
+function TPresence.HasBytes: Boolean;
+begin
+  Result := FPresence and $10 <> 0;
+end;
+
+procedure TPresence.SetBytes(const AValue: bytes);
+begin
+  FBytes := AValue;
+  FPresence := FPresence or $10;
+end;
+
+procedure TPresence.ClearBytes;
+begin
+  FBytes := Default(bytes);
+  FPresence := FPresence and not UInt32($10);
+end;
+
+function TPresence.HasLevel: Boolean;
+begin
+  Result := FPresence and $20 <> 0;
+end;
+
+procedure TPresence.SetLevel(const AValue: TLevel);
+begin
+  FLevel := AValue;
+  FPresence := FPresence or $20;
+end;
+
+procedure TPresence.ClearLevel;
+begin
+  FLevel := Default(TLevel);
+  FPresence := FPresence and not UInt32($20);
+end;
+
+function TPresence.HasSint64: Boolean;
+begin
+  Result := FPresence and $40 <> 0;
+end;
+
+procedure TPresence.SetSint64(const AValue: sint64);
+begin
+  FSint64 := AValue;
+  FPresence := FPresence or $40;
+end;
+
+procedure TPresence.ClearSint64;
+begin
+  FSint64 := Default(sint64);
+  FPresence := FPresence and not UInt32($40);
+end;
+
+function TWidePresence.HasAlpha: Boolean;
+begin
+  Result := FPresence[0] and $1 <> 0;
+end;
+
+procedure TWidePresence.SetAlpha(const AValue: int32);
+begin
+  FAlpha := AValue;
+  FPresence[0] := FPresence[0] or $1;
+end;
+
+procedure TWidePresence.ClearAlpha;
+begin
+  FAlpha := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($1);
+end;
+
+function TWidePresence.HasBravo: Boolean;
+begin
+  Result := FPresence[0] and $2 <> 0;
+end;
+
+procedure TWidePresence.SetBravo(const AValue: int32);
+begin
+  FBravo := AValue;
+  FPresence[0] := FPresence[0] or $2;
+end;
+
+procedure TWidePresence.ClearBravo;
+begin
+  FBravo := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($2);
+end;
+
+function TWidePresence.HasCharlie: Boolean;
+begin
+  Result := FPresence[0] and $4 <> 0;
+end;
+
+procedure TWidePresence.SetCharlie(const AValue: int32);
+begin
+  FCharlie := AValue;
+  FPresence[0] := FPresence[0] or $4;
+end;
+
+procedure TWidePresence.ClearCharlie;
+begin
+  FCharlie := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($4);
+end;
+
+function TWidePresence.HasDelta: Boolean;
+begin
+  Result := FPresence[0] and $8 <> 0;
+end;
+
+procedure TWidePresence.SetDelta(const AValue: int32);
+begin
+  FDelta := AValue;
+  FPresence[0] := FPresence[0] or $8;
+end;
+
+procedure TWidePresence.ClearDelta;
+begin
+  FDelta := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($8);
+end;
+
+function TWidePresence.HasEcho: Boolean;
+begin
+  Result := FPresence[0] and $10 <> 0;
+end;
+
+procedure TWidePresence.SetEcho(const AValue: int32);
+begin
+  FEcho := AValue;
+  FPresence[0] := FPresence[0] or $10;
+end;
+
+procedure TWidePresence.ClearEcho;
+begin
+  FEcho := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($10);
+end;
+
+function TWidePresence.HasFoxtrot: Boolean;
+begin
+  Result := FPresence[0] and $20 <> 0;
+end;
+
+procedure TWidePresence.SetFoxtrot(const AValue: int32);
+begin
+  FFoxtrot := AValue;
+  FPresence[0] := FPresence[0] or $20;
+end;
+
+procedure TWidePresence.ClearFoxtrot;
+begin
+  FFoxtrot := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($20);
+end;
+
+function TWidePresence.HasGolf: Boolean;
+begin
+  Result := FPresence[0] and $40 <> 0;
+end;
+
+procedure TWidePresence.SetGolf(const AValue: int32);
+begin
+  FGolf := AValue;
+  FPresence[0] := FPresence[0] or $40;
+end;
+
+procedure TWidePresence.ClearGolf;
+begin
+  FGolf := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($40);
+end;
+
+function TWidePresence.HasHotel: Boolean;
+begin
+  Result := FPresence[0] and $80 <> 0;
+end;
+
+procedure TWidePresence.SetHotel(const AValue: int32);
+begin
+  FHotel := AValue;
+  FPresence[0] := FPresence[0] or $80;
+end;
+
+procedure TWidePresence.ClearHotel;
+begin
+  FHotel := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($80);
+end;
+
+function TWidePresence.HasIndia: Boolean;
+begin
+  Result := FPresence[0] and $100 <> 0;
+end;
+
+procedure TWidePresence.SetIndia(const AValue: int32);
+begin
+  FIndia := AValue;
+  FPresence[0] := FPresence[0] or $100;
+end;
+
+procedure TWidePresence.ClearIndia;
+begin
+  FIndia := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($100);
+end;
+
+function TWidePresence.HasJuliet: Boolean;
+begin
+  Result := FPresence[0] and $200 <> 0;
+end;
+
+procedure TWidePresence.SetJuliet(const AValue: int32);
+begin
+  FJuliet := AValue;
+  FPresence[0] := FPresence[0] or $200;
+end;
+
+procedure TWidePresence.ClearJuliet;
+begin
+  FJuliet := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($200);
+end;
+
+function TWidePresence.HasKilo: Boolean;
+begin
+  Result := FPresence[0] and $400 <> 0;
+end;
+
+procedure TWidePresence.SetKilo(const AValue: int32);
+begin
+  FKilo := AValue;
+  FPresence[0] := FPresence[0] or $400;
+end;
+
+procedure TWidePresence.ClearKilo;
+begin
+  FKilo := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($400);
+end;
+
+function TWidePresence.HasLima: Boolean;
+begin
+  Result := FPresence[0] and $800 <> 0;
+end;
+
+procedure TWidePresence.SetLima(const AValue: int32);
+begin
+  FLima := AValue;
+  FPresence[0] := FPresence[0] or $800;
+end;
+
+procedure TWidePresence.ClearLima;
+begin
+  FLima := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($800);
+end;
+
+function TWidePresence.HasMike: Boolean;
+begin
+  Result := FPresence[0] and $1000 <> 0;
+end;
+
+procedure TWidePresence.SetMike(const AValue: int32);
+begin
+  FMike := AValue;
+  FPresence[0] := FPresence[0] or $1000;
+end;
+
+procedure TWidePresence.ClearMike;
+begin
+  FMike := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($1000);
+end;
+
+function TWidePresence.HasNovember: Boolean;
+begin
+  Result := FPresence[0] and $2000 <> 0;
+end;
+
+procedure TWidePresence.SetNovember(const AValue: int32);
+begin
+  FNovember := AValue;
+  FPresence[0] := FPresence[0] or $2000;
+end;
+
+procedure TWidePresence.ClearNovember;
+begin
+  FNovember := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($2000);
+end;
+
+function TWidePresence.HasOscar: Boolean;
+begin
+  Result := FPresence[0] and $4000 <> 0;
+end;
+
+procedure TWidePresence.SetOscar(const AValue: int32);
+begin
+  FOscar := AValue;
+  FPresence[0] := FPresence[0] or $4000;
+end;
+
+procedure TWidePresence.ClearOscar;
+begin
+  FOscar := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($4000);
+end;
+
+function TWidePresence.HasPapa: Boolean;
+begin
+  Result := FPresence[0] and $8000 <> 0;
+end;
+
+procedure TWidePresence.SetPapa(const AValue: int32);
+begin
+  FPapa := AValue;
+  FPresence[0] := FPresence[0] or $8000;
+end;
+
+procedure TWidePresence.ClearPapa;
+begin
+  FPapa := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($8000);
+end;
+
+function TWidePresence.HasQuebec: Boolean;
+begin
+  Result := FPresence[0] and $10000 <> 0;
+end;
+
+procedure TWidePresence.SetQuebec(const AValue: int32);
+begin
+  FQuebec := AValue;
+  FPresence[0] := FPresence[0] or $10000;
+end;
+
+procedure TWidePresence.ClearQuebec;
+begin
+  FQuebec := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($10000);
+end;
+
+function TWidePresence.HasRomeo: Boolean;
+begin
+  Result := FPresence[0] and $20000 <> 0;
+end;
+
+procedure TWidePresence.SetRomeo(const AValue: int32);
+begin
+  FRomeo := AValue;
+  FPresence[0] := FPresence[0] or $20000;
+end;
+
+procedure TWidePresence.ClearRomeo;
+begin
+  FRomeo := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($20000);
+end;
+
+function TWidePresence.HasSierra: Boolean;
+begin
+  Result := FPresence[0] and $40000 <> 0;
+end;
+
+procedure TWidePresence.SetSierra(const AValue: int32);
+begin
+  FSierra := AValue;
+  FPresence[0] := FPresence[0] or $40000;
+end;
+
+procedure TWidePresence.ClearSierra;
+begin
+  FSierra := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($40000);
+end;
+
+function TWidePresence.HasTango: Boolean;
+begin
+  Result := FPresence[0] and $80000 <> 0;
+end;
+
+procedure TWidePresence.SetTango(const AValue: int32);
+begin
+  FTango := AValue;
+  FPresence[0] := FPresence[0] or $80000;
+end;
+
+procedure TWidePresence.ClearTango;
+begin
+  FTango := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($80000);
+end;
+
+function TWidePresence.HasUniform: Boolean;
+begin
+  Result := FPresence[0] and $100000 <> 0;
+end;
+
+procedure TWidePresence.SetUniform(const AValue: int32);
+begin
+  FUniform := AValue;
+  FPresence[0] := FPresence[0] or $100000;
+end;
+
+procedure TWidePresence.ClearUniform;
+begin
+  FUniform := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($100000);
+end;
+
+function TWidePresence.HasVictor: Boolean;
+begin
+  Result := FPresence[0] and $200000 <> 0;
+end;
+
+procedure TWidePresence.SetVictor(const AValue: int32);
+begin
+  FVictor := AValue;
+  FPresence[0] := FPresence[0] or $200000;
+end;
+
+procedure TWidePresence.ClearVictor;
+begin
+  FVictor := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($200000);
+end;
+
+function TWidePresence.HasWhiskey: Boolean;
+begin
+  Result := FPresence[0] and $400000 <> 0;
+end;
+
+procedure TWidePresence.SetWhiskey(const AValue: int32);
+begin
+  FWhiskey := AValue;
+  FPresence[0] := FPresence[0] or $400000;
+end;
+
+procedure TWidePresence.ClearWhiskey;
+begin
+  FWhiskey := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($400000);
+end;
+
+function TWidePresence.HasXray: Boolean;
+begin
+  Result := FPresence[0] and $800000 <> 0;
+end;
+
+procedure TWidePresence.SetXray(const AValue: int32);
+begin
+  FXray := AValue;
+  FPresence[0] := FPresence[0] or $800000;
+end;
+
+procedure TWidePresence.ClearXray;
+begin
+  FXray := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($800000);
+end;
+
+function TWidePresence.HasYankee: Boolean;
+begin
+  Result := FPresence[0] and $1000000 <> 0;
+end;
+
+procedure TWidePresence.SetYankee(const AValue: int32);
+begin
+  FYankee := AValue;
+  FPresence[0] := FPresence[0] or $1000000;
+end;
+
+procedure TWidePresence.ClearYankee;
+begin
+  FYankee := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($1000000);
+end;
+
+function TWidePresence.HasZulu: Boolean;
+begin
+  Result := FPresence[0] and $2000000 <> 0;
+end;
+
+procedure TWidePresence.SetZulu(const AValue: int32);
+begin
+  FZulu := AValue;
+  FPresence[0] := FPresence[0] or $2000000;
+end;
+
+procedure TWidePresence.ClearZulu;
+begin
+  FZulu := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($2000000);
+end;
+
+function TWidePresence.HasAmber: Boolean;
+begin
+  Result := FPresence[0] and $4000000 <> 0;
+end;
+
+procedure TWidePresence.SetAmber(const AValue: int32);
+begin
+  FAmber := AValue;
+  FPresence[0] := FPresence[0] or $4000000;
+end;
+
+procedure TWidePresence.ClearAmber;
+begin
+  FAmber := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($4000000);
+end;
+
+function TWidePresence.HasBronze: Boolean;
+begin
+  Result := FPresence[0] and $8000000 <> 0;
+end;
+
+procedure TWidePresence.SetBronze(const AValue: int32);
+begin
+  FBronze := AValue;
+  FPresence[0] := FPresence[0] or $8000000;
+end;
+
+procedure TWidePresence.ClearBronze;
+begin
+  FBronze := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($8000000);
+end;
+
+function TWidePresence.HasCopper: Boolean;
+begin
+  Result := FPresence[0] and $10000000 <> 0;
+end;
+
+procedure TWidePresence.SetCopper(const AValue: int32);
+begin
+  FCopper := AValue;
+  FPresence[0] := FPresence[0] or $10000000;
+end;
+
+procedure TWidePresence.ClearCopper;
+begin
+  FCopper := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($10000000);
+end;
+
+function TWidePresence.HasDiamond: Boolean;
+begin
+  Result := FPresence[0] and $20000000 <> 0;
+end;
+
+procedure TWidePresence.SetDiamond(const AValue: int32);
+begin
+  FDiamond := AValue;
+  FPresence[0] := FPresence[0] or $20000000;
+end;
+
+procedure TWidePresence.ClearDiamond;
+begin
+  FDiamond := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($20000000);
+end;
+
+function TWidePresence.HasEmerald: Boolean;
+begin
+  Result := FPresence[0] and $40000000 <> 0;
+end;
+
+procedure TWidePresence.SetEmerald(const AValue: int32);
+begin
+  FEmerald := AValue;
+  FPresence[0] := FPresence[0] or $40000000;
+end;
+
+procedure TWidePresence.ClearEmerald;
+begin
+  FEmerald := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($40000000);
+end;
+
+function TWidePresence.HasFlint: Boolean;
+begin
+  Result := FPresence[0] and $80000000 <> 0;
+end;
+
+procedure TWidePresence.SetFlint(const AValue: int32);
+begin
+  FFlint := AValue;
+  FPresence[0] := FPresence[0] or $80000000;
+end;
+
+procedure TWidePresence.ClearFlint;
+begin
+  FFlint := Default(int32);
+  FPresence[0] := FPresence[0] and not UInt32($80000000);
+end;
+
+function TWidePresence.HasGarnet: Boolean;
+begin
+  Result := FPresence[1] and $1 <> 0;
+end;
+
+procedure TWidePresence.SetGarnet(const AValue: int32);
+begin
+  FGarnet := AValue;
+  FPresence[1] := FPresence[1] or $1;
+end;
+
+procedure TWidePresence.ClearGarnet;
+begin
+  FGarnet := Default(int32);
+  FPresence[1] := FPresence[1] and not UInt32($1);
+end;
+
+function TWidePresence.HasHematite: Boolean;
+begin
+  Result := FPresence[1] and $2 <> 0;
+end;
+
+procedure TWidePresence.SetHematite(const AValue: int32);
+begin
+  FHematite := AValue;
+  FPresence[1] := FPresence[1] or $2;
+end;
+
+procedure TWidePresence.ClearHematite;
+begin
+  FHematite := Default(int32);
+  FPresence[1] := FPresence[1] and not UInt32($2);
+end;
+
+class function TInnerView.Create(const AMessage: MessageView): TInnerView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TInnerView.Create(const AValue: FieldValue): TInnerView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TInnerView.HasValue: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TInnerView.GetValue: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+class function TPresenceView.Create(const AMessage: MessageView): TPresenceView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TPresenceView.Create(const AValue: FieldValue): TPresenceView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TPresenceView.HasInt32: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TPresenceView.GetInt32: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TPresenceView.HasDouble: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.Fixed64);
+end;
+
+function TPresenceView.GetDouble: double;
+begin
+  Result := FMessage.Find(2, TWireType.Fixed64).AsDouble;
+end;
+
+function TPresenceView.HasBool: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TPresenceView.GetBool: bool;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsBoolean;
+end;
+
+function TPresenceView.HasString: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.LengthPrefixed);
+end;
+
+function TPresenceView.GetString: ByteSlice;
+begin
+  Result := FMessage.Find(4, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPresenceView.HasBytes: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.LengthPrefixed);
+end;
+
+function TPresenceView.GetBytes: ByteSlice;
+begin
+  Result := FMessage.Find(5, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPresenceView.HasLevel: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TPresenceView.GetLevel: TLevel;
+begin
+  Result := TLevel(FMessage.Find(6, TWireType.VarInt).AsInt32);
+end;
+
+function TPresenceView.HasSint64: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TPresenceView.GetSint64: sint64;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsSInt64;
+end;
+
+function TPresenceView.HasImplicit: Boolean;
+begin
+  Result := FMessage.Contains(8, TWireType.VarInt);
+end;
+
+function TPresenceView.GetImplicit: int32;
+begin
+  Result := FMessage.Find(8, TWireType.VarInt).AsInt32;
+end;
+
+function TPresenceView.GetRepeated: FieldCursor;
+begin
+  Result := FMessage.Values(9, TWireType.VarInt);
+end;
+
+function TPresenceView.HasFirst: Boolean;
+begin
+  Result := FMessage.Contains(10, TWireType.VarInt);
+end;
+
+function TPresenceView.GetFirst: int32;
+begin
+  Result := FMessage.Find(10, TWireType.VarInt).AsInt32;
+end;
+
+function TPresenceView.HasSecond: Boolean;
+begin
+  Result := FMessage.Contains(11, TWireType.LengthPrefixed);
+end;
+
+function TPresenceView.GetSecond: ByteSlice;
+begin
+  Result := FMessage.Find(11, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TPresenceView.HasInner: Boolean;
+begin
+  Result := FMessage.Contains(12, TWireType.LengthPrefixed);
+end;
+
+function TPresenceView.GetInner: TInnerView;
+begin
+  Result := TInnerView.Create(FMessage.Find(12, TWireType.LengthPrefixed));
+end;
+
+class function TWidePresenceView.Create(const AMessage: MessageView): TWidePresenceView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TWidePresenceView.Create(const AValue: FieldValue): TWidePresenceView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TWidePresenceView.HasAlpha: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetAlpha: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasBravo: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetBravo: int32;
+begin
+  Result := FMessage.Find(2, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasCharlie: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetCharlie: int32;
+begin
+  Result := FMessage.Find(3, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasDelta: Boolean;
+begin
+  Result := FMessage.Contains(4, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetDelta: int32;
+begin
+  Result := FMessage.Find(4, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasEcho: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetEcho: int32;
+begin
+  Result := FMessage.Find(5, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasFoxtrot: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetFoxtrot: int32;
+begin
+  Result := FMessage.Find(6, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasGolf: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetGolf: int32;
+begin
+  Result := FMessage.Find(7, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasHotel: Boolean;
+begin
+  Result := FMessage.Contains(8, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetHotel: int32;
+begin
+  Result := FMessage.Find(8, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasIndia: Boolean;
+begin
+  Result := FMessage.Contains(9, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetIndia: int32;
+begin
+  Result := FMessage.Find(9, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasJuliet: Boolean;
+begin
+  Result := FMessage.Contains(10, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetJuliet: int32;
+begin
+  Result := FMessage.Find(10, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasKilo: Boolean;
+begin
+  Result := FMessage.Contains(11, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetKilo: int32;
+begin
+  Result := FMessage.Find(11, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasLima: Boolean;
+begin
+  Result := FMessage.Contains(12, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetLima: int32;
+begin
+  Result := FMessage.Find(12, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasMike: Boolean;
+begin
+  Result := FMessage.Contains(13, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetMike: int32;
+begin
+  Result := FMessage.Find(13, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasNovember: Boolean;
+begin
+  Result := FMessage.Contains(14, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetNovember: int32;
+begin
+  Result := FMessage.Find(14, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasOscar: Boolean;
+begin
+  Result := FMessage.Contains(15, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetOscar: int32;
+begin
+  Result := FMessage.Find(15, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasPapa: Boolean;
+begin
+  Result := FMessage.Contains(16, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetPapa: int32;
+begin
+  Result := FMessage.Find(16, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasQuebec: Boolean;
+begin
+  Result := FMessage.Contains(17, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetQuebec: int32;
+begin
+  Result := FMessage.Find(17, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasRomeo: Boolean;
+begin
+  Result := FMessage.Contains(18, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetRomeo: int32;
+begin
+  Result := FMessage.Find(18, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasSierra: Boolean;
+begin
+  Result := FMessage.Contains(19, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetSierra: int32;
+begin
+  Result := FMessage.Find(19, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasTango: Boolean;
+begin
+  Result := FMessage.Contains(20, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetTango: int32;
+begin
+  Result := FMessage.Find(20, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasUniform: Boolean;
+begin
+  Result := FMessage.Contains(21, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetUniform: int32;
+begin
+  Result := FMessage.Find(21, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasVictor: Boolean;
+begin
+  Result := FMessage.Contains(22, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetVictor: int32;
+begin
+  Result := FMessage.Find(22, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasWhiskey: Boolean;
+begin
+  Result := FMessage.Contains(23, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetWhiskey: int32;
+begin
+  Result := FMessage.Find(23, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasXray: Boolean;
+begin
+  Result := FMessage.Contains(24, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetXray: int32;
+begin
+  Result := FMessage.Find(24, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasYankee: Boolean;
+begin
+  Result := FMessage.Contains(25, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetYankee: int32;
+begin
+  Result := FMessage.Find(25, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasZulu: Boolean;
+begin
+  Result := FMessage.Contains(26, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetZulu: int32;
+begin
+  Result := FMessage.Find(26, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasAmber: Boolean;
+begin
+  Result := FMessage.Contains(27, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetAmber: int32;
+begin
+  Result := FMessage.Find(27, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasBronze: Boolean;
+begin
+  Result := FMessage.Contains(28, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetBronze: int32;
+begin
+  Result := FMessage.Find(28, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasCopper: Boolean;
+begin
+  Result := FMessage.Contains(29, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetCopper: int32;
+begin
+  Result := FMessage.Find(29, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasDiamond: Boolean;
+begin
+  Result := FMessage.Contains(30, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetDiamond: int32;
+begin
+  Result := FMessage.Find(30, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasEmerald: Boolean;
+begin
+  Result := FMessage.Contains(31, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetEmerald: int32;
+begin
+  Result := FMessage.Find(31, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasFlint: Boolean;
+begin
+  Result := FMessage.Contains(32, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetFlint: int32;
+begin
+  Result := FMessage.Find(32, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasGarnet: Boolean;
+begin
+  Result := FMessage.Contains(33, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetGarnet: int32;
+begin
+  Result := FMessage.Find(33, TWireType.VarInt).AsInt32;
+end;
+
+function TWidePresenceView.HasHematite: Boolean;
+begin
+  Result := FMessage.Contains(34, TWireType.VarInt);
+end;
+
+function TWidePresenceView.GetHematite: int32;
+begin
+  Result := FMessage.Find(34, TWireType.VarInt).AsInt32;
+end;
+
+initialization
+
+EnumRegistry.Register(TypeInfo(TLevel), CLevelByValue);
+TInner.Table := MessageTable.Create(TypeInfo(TInner), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TInner(nil^).FValue)]);
+TPresence.Table := MessageTable.Create(TypeInfo(TPresence), [
+  FieldEntry.Create(1, TFieldKind.Int32, [TFieldFlag.Presence], @TPresence(nil^).FInt32, nil, nil, @TPresence(nil^).FPresence, 0),
+  FieldEntry.Create(2, TFieldKind.Double, [TFieldFlag.Presence], @TPresence(nil^).FDouble, nil, nil, @TPresence(nil^).FPresence, 1),
+  FieldEntry.Create(3, TFieldKind.Bool, [TFieldFlag.Presence], @TPresence(nil^).FBool, nil, nil, @TPresence(nil^).FPresence, 2),
+  FieldEntry.Create(4, TFieldKind.&String, [TFieldFlag.Presence], @TPresence(nil^).FString, nil, nil, @TPresence(nil^).FPresence, 3),
+  FieldEntry.Create(5, TFieldKind.Bytes, [TFieldFlag.Presence], @TPresence(nil^).FBytes, nil, nil, @TPresence(nil^).FPresence, 4),
+  FieldEntry.Create(6, TFieldKind.Enum8, [TFieldFlag.Presence], @TPresence(nil^).FLevel, nil, nil, @TPresence(nil^).FPresence, 5),
+  FieldEntry.Create(7, TFieldKind.SInt64, [TFieldFlag.Presence], @TPresence(nil^).FSint64, nil, nil, @TPresence(nil^).FPresence, 6),
+  FieldEntry.Create(8, TFieldKind.Int32, [], @TPresence(nil^).FImplicit),
+  FieldEntry.Create(9, TFieldKind.Int32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TPresence(nil^).FRepeated, TypeInfo(TArray<int32>), nil),
+  FieldEntry.Create(10, TFieldKind.Int32, [TFieldFlag.Oneof], @TPresence(nil^).FChoice.FFirst, nil, nil, @TPresence(nil^).FChoice.FCase, 1),
+  FieldEntry.Create(11, TFieldKind.&String, [TFieldFlag.Oneof], @TPresence(nil^).FChoice.FSecond, nil, nil, @TPresence(nil^).FChoice.FCase, 2),
+  FieldEntry.Create(12, TFieldKind.Message, [TFieldFlag.Boxed], @TPresence(nil^).FInner, TypeInfo(TArray<TInner>), @TInner.Table)]);
+TWidePresence.Table := MessageTable.Create(TypeInfo(TWidePresence), [
+  FieldEntry.Create(1, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FAlpha, nil, nil, @TWidePresence(nil^).FPresence[0], 0),
+  FieldEntry.Create(2, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FBravo, nil, nil, @TWidePresence(nil^).FPresence[0], 1),
+  FieldEntry.Create(3, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FCharlie, nil, nil, @TWidePresence(nil^).FPresence[0], 2),
+  FieldEntry.Create(4, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FDelta, nil, nil, @TWidePresence(nil^).FPresence[0], 3),
+  FieldEntry.Create(5, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FEcho, nil, nil, @TWidePresence(nil^).FPresence[0], 4),
+  FieldEntry.Create(6, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FFoxtrot, nil, nil, @TWidePresence(nil^).FPresence[0], 5),
+  FieldEntry.Create(7, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FGolf, nil, nil, @TWidePresence(nil^).FPresence[0], 6),
+  FieldEntry.Create(8, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FHotel, nil, nil, @TWidePresence(nil^).FPresence[0], 7),
+  FieldEntry.Create(9, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FIndia, nil, nil, @TWidePresence(nil^).FPresence[0], 8),
+  FieldEntry.Create(10, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FJuliet, nil, nil, @TWidePresence(nil^).FPresence[0], 9),
+  FieldEntry.Create(11, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FKilo, nil, nil, @TWidePresence(nil^).FPresence[0], 10),
+  FieldEntry.Create(12, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FLima, nil, nil, @TWidePresence(nil^).FPresence[0], 11),
+  FieldEntry.Create(13, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FMike, nil, nil, @TWidePresence(nil^).FPresence[0], 12),
+  FieldEntry.Create(14, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FNovember, nil, nil, @TWidePresence(nil^).FPresence[0], 13),
+  FieldEntry.Create(15, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FOscar, nil, nil, @TWidePresence(nil^).FPresence[0], 14),
+  FieldEntry.Create(16, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FPapa, nil, nil, @TWidePresence(nil^).FPresence[0], 15),
+  FieldEntry.Create(17, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FQuebec, nil, nil, @TWidePresence(nil^).FPresence[0], 16),
+  FieldEntry.Create(18, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FRomeo, nil, nil, @TWidePresence(nil^).FPresence[0], 17),
+  FieldEntry.Create(19, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FSierra, nil, nil, @TWidePresence(nil^).FPresence[0], 18),
+  FieldEntry.Create(20, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FTango, nil, nil, @TWidePresence(nil^).FPresence[0], 19),
+  FieldEntry.Create(21, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FUniform, nil, nil, @TWidePresence(nil^).FPresence[0], 20),
+  FieldEntry.Create(22, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FVictor, nil, nil, @TWidePresence(nil^).FPresence[0], 21),
+  FieldEntry.Create(23, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FWhiskey, nil, nil, @TWidePresence(nil^).FPresence[0], 22),
+  FieldEntry.Create(24, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FXray, nil, nil, @TWidePresence(nil^).FPresence[0], 23),
+  FieldEntry.Create(25, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FYankee, nil, nil, @TWidePresence(nil^).FPresence[0], 24),
+  FieldEntry.Create(26, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FZulu, nil, nil, @TWidePresence(nil^).FPresence[0], 25),
+  FieldEntry.Create(27, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FAmber, nil, nil, @TWidePresence(nil^).FPresence[0], 26),
+  FieldEntry.Create(28, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FBronze, nil, nil, @TWidePresence(nil^).FPresence[0], 27),
+  FieldEntry.Create(29, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FCopper, nil, nil, @TWidePresence(nil^).FPresence[0], 28),
+  FieldEntry.Create(30, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FDiamond, nil, nil, @TWidePresence(nil^).FPresence[0], 29),
+  FieldEntry.Create(31, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FEmerald, nil, nil, @TWidePresence(nil^).FPresence[0], 30),
+  FieldEntry.Create(32, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FFlint, nil, nil, @TWidePresence(nil^).FPresence[0], 31),
+  FieldEntry.Create(33, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FGarnet, nil, nil, @TWidePresence(nil^).FPresence[1], 0),
+  FieldEntry.Create(34, TFieldKind.Int32, [TFieldFlag.Presence], @TWidePresence(nil^).FHematite, nil, nil, @TWidePresence(nil^).FPresence[1], 1)]);
+
+end.
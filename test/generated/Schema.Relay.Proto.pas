@@ -0,0 +1,805 @@
+unit Schema.Relay.Proto;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
+
+type
+
+  THeader = record
+    [Tag(1), Name('hop')] FHop: int32;
+    [Tag(2), Name('target')] FTarget: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      FUnknown: Bytes;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  THeaderView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): THeaderView; overload; static;
+    class function Create(const AValue: FieldValue): THeaderView; overload; static;
+    function HasHop: Boolean;
+    function GetHop: int32;
+    function HasTarget: Boolean;
+    function GetTarget: ByteSlice;
+  end;
+
+  TFrame = record
+    [Tag(1), Name('id')] FId: int32;
+    [Tag(2), Name('header')] FHeader: THeader;
+    [Tag(3), Name('payload')] FPayload: bytes;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      FUnknown: Bytes;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TFrameView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TFrameView; overload; static;
+    class function Create(const AValue: FieldValue): TFrameView; overload; static;
+    function HasId: Boolean;
+    function GetId: int32;
+    function HasHeader: Boolean;
+    function GetHeader: THeaderView;
+    function HasPayload: Boolean;
+    function GetPayload: ByteSlice;
+  end;
+
+  TExtendedHeader = record
+    [Tag(1), Name('hop')] FHop: int32;
+    [Tag(2), Name('target')] FTarget: string;
+    [Tag(3), Name('weight')] FWeight: double;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      FUnknown: Bytes;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TExtendedHeaderView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TExtendedHeaderView; overload; static;
+    class function Create(const AValue: FieldValue): TExtendedHeaderView; overload; static;
+    function HasHop: Boolean;
+    function GetHop: int32;
+    function HasTarget: Boolean;
+    function GetTarget: ByteSlice;
+    function HasWeight: Boolean;
+    function GetWeight: double;
+  end;
+
+  TExtendedFrame = record
+    [Tag(1), Name('id')] FId: int32;
+    [Tag(2), Name('header')] FHeader: TExtendedHeader;
+    [Tag(3), Name('payload')] FPayload: bytes;
+    [Tag(4), Name('tags')] FTags: TArray<string>;
+    [Tag(5), Name('stamp')] FStamp: fixed64;
+    [Tag(6), Name('priority')] FPriority: sint32;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      FUnknown: Bytes;
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TExtendedFrameView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TExtendedFrameView; overload; static;
+    class function Create(const AValue: FieldValue): TExtendedFrameView; overload; static;
+    function HasId: Boolean;
+    function GetId: int32;
+    function HasHeader: Boolean;
+    function GetHeader: TExtendedHeaderView;
+    function HasPayload: Boolean;
+    function GetPayload: ByteSlice;
+    function GetTags: FieldCursor;
+    function HasStamp: Boolean;
+    function GetStamp: fixed64;
+    function HasPriority: Boolean;
+    function GetPriority: sint32;
+  end;
+
+implementation
+
+const
+  CHeaderFieldSeeds: array [0 .. 1] of Int32 = (
+    -1, -2
+  );
+  CHeaderFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 2; FName: 'target'),
+    (FValue: 1; FName: 'hop')
+  );
+
+class function THeader.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CHeaderFieldSeeds, CHeaderFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CFrameFieldSeeds: array [0 .. 2] of Int32 = (
+    1, 0, -3
+  );
+  CFrameFieldNames: array [0 .. 2] of NamedValue = (
+    (FValue: 3; FName: 'payload'),
+    (FValue: 1; FName: 'id'),
+    (FValue: 2; FName: 'header')
+  );
+
+class function TFrame.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CFrameFieldSeeds, CFrameFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CExtendedHeaderFieldSeeds: array [0 .. 2] of Int32 = (
+    2, 0, -3
+  );
+  CExtendedHeaderFieldNames: array [0 .. 2] of NamedValue = (
+    (FValue: 3; FName: 'weight'),
+    (FValue: 2; FName: 'target'),
+    (FValue: 1; FName: 'hop')
+  );
+
+class function TExtendedHeader.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CExtendedHeaderFieldSeeds, CExtendedHeaderFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CExtendedFrameFieldSeeds: array [0 .. 5] of Int32 = (
+    0, 1, -5, -6, 0, 3
+  );
+  CExtendedFrameFieldNames: array [0 .. 5] of NamedValue = (
+    (FValue: 3; FName: 'payload'),
+    (FValue: 2; FName: 'header'),
+    (FValue: 1; FName: 'id'),
+    (FValue: 4; FName: 'tags'),
+    (FValue: 5; FName: 'stamp'),
+    (FValue: 6; FName: 'priority')
+  );
+
+class function TExtendedFrame.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CExtendedFrameFieldSeeds, CExtendedFrameFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag2LengthPrefixed: EncodedTag = (FBytes: $12; FCount: 1);
+  CTag3Fixed64: EncodedTag = (FBytes: $19; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5Fixed64: EncodedTag = (FBytes: $29; FCount: 1);
+  CTag6VarInt: EncodedTag = (FBytes: $30; FCount: 1);
+
+procedure THeader.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure THeader.EncodeTo(AWriter: TWriter);
+begin
+  if FHop <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FHop));
+    end;
+  if FTarget <> '' then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(FTarget, AWriter.NextSize);
+    end;
+  AWriter.Splice(FUnknown);
+end;
+
+function THeader.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FHop <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FHop));
+    end;
+  if FTarget <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FTarget));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  Inc(Result, Length(FUnknown));
+end;
+
+procedure THeader.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FHop := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FTarget);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+      else
+        AReader.SkipField(WireType, FUnknown);
+      end;
+    end;
+end;
+
+procedure TFrame.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TFrame.EncodeTo(AWriter: TWriter);
+var
+  Size: Integer;
+begin
+  if FId <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FId));
+    end;
+  Size := AWriter.NextSize;
+  if Size > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(Size));
+      FHeader.EncodeTo(AWriter);
+    end;
+  if Length(FPayload) > 0 then
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(FPayload);
+    end;
+  AWriter.Splice(FUnknown);
+end;
+
+function TFrame.ComputeSize(AWriter: TWriter): Integer;
+var
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FId <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FId));
+    end;
+  Slot := AWriter.ReserveSize;
+  Size := AWriter.StoreSize(Slot, FHeader.ComputeSize(AWriter));
+  if Size > 0 then
+    Inc(Result, 1 + VarInt.ByteCount(Size) + Size)
+  else
+    AWriter.ReleaseSizes(Slot);
+  if Length(FPayload) > 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FPayload)) + Length(FPayload));
+    end;
+  Inc(Result, Length(FUnknown));
+end;
+
+procedure TFrame.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FId := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              FHeader.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FPayload);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+      else
+        AReader.SkipField(WireType, FUnknown);
+      end;
+    end;
+end;
+
+procedure TExtendedHeader.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TExtendedHeader.EncodeTo(AWriter: TWriter);
+begin
+  if FHop <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FHop));
+    end;
+  if FTarget <> '' then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(FTarget, AWriter.NextSize);
+    end;
+  if FWeight <> 0 then
+    begin
+      AWriter.Pack(CTag3Fixed64);
+      AWriter.Pack(FixedInt64(FWeight));
+    end;
+  AWriter.Splice(FUnknown);
+end;
+
+function TExtendedHeader.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FHop <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FHop));
+    end;
+  if FTarget <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FTarget));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FWeight <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  Inc(Result, Length(FUnknown));
+end;
+
+procedure TExtendedHeader.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FHop := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FTarget);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        3:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FWeight := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+      else
+        AReader.SkipField(WireType, FUnknown);
+      end;
+    end;
+end;
+
+procedure TExtendedFrame.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TExtendedFrame.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+  Size: Integer;
+begin
+  if FId <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FId));
+    end;
+  Size := AWriter.NextSize;
+  if Size > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(Size));
+      FHeader.EncodeTo(AWriter);
+    end;
+  if Length(FPayload) > 0 then
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(FPayload);
+    end;
+  for I := 0 to High(FTags) do
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(FTags[I], AWriter.NextSize);
+    end;
+  if FStamp <> 0 then
+    begin
+      AWriter.Pack(CTag5Fixed64);
+      AWriter.Pack(FixedInt64(UInt64(FStamp)));
+    end;
+  if FPriority <> 0 then
+    begin
+      AWriter.Pack(CTag6VarInt);
+      AWriter.Pack(SignedInt(Int32(FPriority)));
+    end;
+  AWriter.Splice(FUnknown);
+end;
+
+function TExtendedFrame.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FId <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FId));
+    end;
+  Slot := AWriter.ReserveSize;
+  Size := AWriter.StoreSize(Slot, FHeader.ComputeSize(AWriter));
+  if Size > 0 then
+    Inc(Result, 1 + VarInt.ByteCount(Size) + Size)
+  else
+    AWriter.ReleaseSizes(Slot);
+  if Length(FPayload) > 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(Length(FPayload)) + Length(FPayload));
+    end;
+  for I := 0 to High(FTags) do
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FTags[I]));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FStamp <> 0 then
+    begin
+      Inc(Result, 1 + 8);
+    end;
+  if FPriority <> 0 then
+    begin
+      Inc(Result, 1 + SignedInt.ByteCount(Int32(FPriority)));
+    end;
+  Inc(Result, Length(FUnknown));
+end;
+
+procedure TExtendedFrame.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FId := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              FHeader.ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FPayload);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              SetLength(FTags, Length(FTags) + 1);
+              AReader.Parse(FTags[High(FTags)]);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        5:
+          if WireType = TWireType.Fixed64 then
+            begin
+              AReader.Parse(Fixed64Value);
+              FStamp := UInt64(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+        6:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(SignedIntValue);
+              FPriority := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType, FUnknown);
+      else
+        AReader.SkipField(WireType, FUnknown);
+      end;
+    end;
+end;
+
+class function THeaderView.Create(const AMessage: MessageView): THeaderView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function THeaderView.Create(const AValue: FieldValue): THeaderView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function THeaderView.HasHop: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function THeaderView.GetHop: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function THeaderView.HasTarget: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function THeaderView.GetTarget: ByteSlice;
+begin
+  Result := FMessage.Find(2, TWireType.LengthPrefixed).AsSlice;
+end;
+
+class function TFrameView.Create(const AMessage: MessageView): TFrameView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TFrameView.Create(const AValue: FieldValue): TFrameView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TFrameView.HasId: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TFrameView.GetId: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TFrameView.HasHeader: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TFrameView.GetHeader: THeaderView;
+begin
+  Result := THeaderView.Create(FMessage.Find(2, TWireType.LengthPrefixed));
+end;
+
+function TFrameView.HasPayload: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.LengthPrefixed);
+end;
+
+function TFrameView.GetPayload: ByteSlice;
+begin
+  Result := FMessage.Find(3, TWireType.LengthPrefixed).AsSlice;
+end;
+
+class function TExtendedHeaderView.Create(const AMessage: MessageView): TExtendedHeaderView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TExtendedHeaderView.Create(const AValue: FieldValue): TExtendedHeaderView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TExtendedHeaderView.HasHop: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TExtendedHeaderView.GetHop: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TExtendedHeaderView.HasTarget: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TExtendedHeaderView.GetTarget: ByteSlice;
+begin
+  Result := FMessage.Find(2, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TExtendedHeaderView.HasWeight: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.Fixed64);
+end;
+
+function TExtendedHeaderView.GetWeight: double;
+begin
+  Result := FMessage.Find(3, TWireType.Fixed64).AsDouble;
+end;
+
+class function TExtendedFrameView.Create(const AMessage: MessageView): TExtendedFrameView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TExtendedFrameView.Create(const AValue: FieldValue): TExtendedFrameView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TExtendedFrameView.HasId: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TExtendedFrameView.GetId: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TExtendedFrameView.HasHeader: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TExtendedFrameView.GetHeader: TExtendedHeaderView;
+begin
+  Result := TExtendedHeaderView.Create(FMessage.Find(2, TWireType.LengthPrefixed));
+end;
+
+function TExtendedFrameView.HasPayload: Boolean;
+begin
+  Result := FMessage.Contains(3, TWireType.LengthPrefixed);
+end;
+
+function TExtendedFrameView.GetPayload: ByteSlice;
+begin
+  Result := FMessage.Find(3, TWireType.LengthPrefixed).AsSlice;
+end;
+
+function TExtendedFrameView.GetTags: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.LengthPrefixed);
+end;
+
+function TExtendedFrameView.HasStamp: Boolean;
+begin
+  Result := FMessage.Contains(5, TWireType.Fixed64);
+end;
+
+function TExtendedFrameView.GetStamp: fixed64;
+begin
+  Result := FMessage.Find(5, TWireType.Fixed64).AsUInt64;
+end;
+
+function TExtendedFrameView.HasPriority: Boolean;
+begin
+  Result := FMessage.Contains(6, TWireType.VarInt);
+end;
+
+function TExtendedFrameView.GetPriority: sint32;
+begin
+  Result := FMessage.Find(6, TWireType.VarInt).AsSInt32;
+end;
+
+initialization
+
+THeader.Table := MessageTable.Create(TypeInfo(THeader), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @THeader(nil^).FHop),
+  FieldEntry.Create(2, TFieldKind.&String, [], @THeader(nil^).FTarget)], NativeInt(@THeader(nil^).FUnknown));
+TFrame.Table := MessageTable.Create(TypeInfo(TFrame), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TFrame(nil^).FId),
+  FieldEntry.Create(2, TFieldKind.Message, [], @TFrame(nil^).FHeader, nil, @THeader.Table),
+  FieldEntry.Create(3, TFieldKind.Bytes, [], @TFrame(nil^).FPayload)], NativeInt(@TFrame(nil^).FUnknown));
+TExtendedHeader.Table := MessageTable.Create(TypeInfo(TExtendedHeader), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TExtendedHeader(nil^).FHop),
+  FieldEntry.Create(2, TFieldKind.&String, [], @TExtendedHeader(nil^).FTarget),
+  FieldEntry.Create(3, TFieldKind.Double, [], @TExtendedHeader(nil^).FWeight)], NativeInt(@TExtendedHeader(nil^).FUnknown));
+TExtendedFrame.Table := MessageTable.Create(TypeInfo(TExtendedFrame), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TExtendedFrame(nil^).FId),
+  FieldEntry.Create(2, TFieldKind.Message, [], @TExtendedFrame(nil^).FHeader, nil, @TExtendedHeader.Table),
+  FieldEntry.Create(3, TFieldKind.Bytes, [], @TExtendedFrame(nil^).FPayload),
+  FieldEntry.Create(4, TFieldKind.&String, [TFieldFlag.Repeated], @TExtendedFrame(nil^).FTags, TypeInfo(TArray<string>), nil),
+  FieldEntry.Create(5, TFieldKind.Fixed64, [], @TExtendedFrame(nil^).FStamp),
+  FieldEntry.Create(6, TFieldKind.SInt32, [], @TExtendedFrame(nil^).FPriority)], NativeInt(@TExtendedFrame(nil^).FUnknown));
+
+end.
@@ -0,0 +1,742 @@
+unit Schema.Sensor.Proto;
+
+{$SCOPEDENUMS ON}
+
+interface
+
+uses
+  Delphi.Serial,
+  Delphi.Serial.Protobuf.Types,
+  Delphi.Serial.Protobuf.Reader,
+  Delphi.Serial.Protobuf.Writer,
+  Delphi.Serial.Protobuf.Table,
+  Delphi.Serial.Protobuf.View;
+
+type
+
+  TSample = record
+    [Tag(1), Name('time')] FTime: int32;
+    [Tag(2), Name('label')] FLabel: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TSampleView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TSampleView; overload; static;
+    class function Create(const AValue: FieldValue): TSampleView; overload; static;
+    function HasTime: Boolean;
+    function GetTime: int32;
+    function HasLabel: Boolean;
+    function GetLabel: ByteSlice;
+  end;
+
+  TBounded4SInt32 = record
+    private
+      FCount: Integer;
+      FItems: array [0 .. 3] of sint32;
+      function GetItem(AIndex: Integer): sint32;
+      procedure SetItem(AIndex: Integer; const AValue: sint32);
+      procedure Grow;
+    public
+      property Items[AIndex: Integer]: sint32 read GetItem write SetItem; default;
+      property Count: Integer read FCount;
+      procedure Add(const AValue: sint32);
+      procedure Clear;
+  end;
+
+  TBounded3Double = record
+    private
+      FCount: Integer;
+      FItems: array [0 .. 2] of double;
+      function GetItem(AIndex: Integer): double;
+      procedure SetItem(AIndex: Integer; const AValue: double);
+      procedure Grow;
+    public
+      property Items[AIndex: Integer]: double read GetItem write SetItem; default;
+      property Count: Integer read FCount;
+      procedure Add(const AValue: double);
+      procedure Clear;
+  end;
+
+  TBounded2String = record
+    private
+      FCount: Integer;
+      FItems: array [0 .. 1] of string;
+      function GetItem(AIndex: Integer): string;
+      procedure SetItem(AIndex: Integer; const AValue: string);
+      procedure Grow;
+    public
+      property Items[AIndex: Integer]: string read GetItem write SetItem; default;
+      property Count: Integer read FCount;
+      procedure Add(const AValue: string);
+      procedure Clear;
+  end;
+
+  TBounded2Sample = record
+    private
+      FCount: Integer;
+      FItems: array [0 .. 1] of TSample;
+      function GetItem(AIndex: Integer): TSample;
+      procedure SetItem(AIndex: Integer; const AValue: TSample);
+      procedure Grow;
+    public
+      property Items[AIndex: Integer]: TSample read GetItem write SetItem; default;
+      property Count: Integer read FCount;
+      procedure Add(const AValue: TSample);
+      procedure Clear;
+  end;
+
+  TBounded5Bool = record
+    private
+      FCount: Integer;
+      FItems: array [0 .. 4] of bool;
+      function GetItem(AIndex: Integer): bool;
+      procedure SetItem(AIndex: Integer; const AValue: bool);
+      procedure Grow;
+    public
+      property Items[AIndex: Integer]: bool read GetItem write SetItem; default;
+      property Count: Integer read FCount;
+      procedure Add(const AValue: bool);
+      procedure Clear;
+  end;
+
+  TReading = record
+    [Tag(1), Name('values')] FValues: TBounded4SInt32;
+    [Tag(2), Name('weights')] FWeights: TBounded3Double;
+    [Tag(3), Name('tags')] FTags: TBounded2String;
+    [Tag(4), Name('samples')] FSamples: TBounded2Sample;
+    [Tag(5), Name('flags')] FFlags: TBounded5Bool;
+    [Tag(6), Name('history')] FHistory: TArray<int32>;
+    [Tag(7), Name('name')] FName: string;
+    class var Table: MessageTable;
+    class function FindFieldTag(const AName: string): Integer; static;
+    procedure SerializeTo(AWriter: TWriter);
+    procedure ParseFrom(AReader: TReader);
+    function ComputeSize(AWriter: TWriter): Integer;
+    private
+      procedure EncodeTo(AWriter: TWriter);
+  end;
+
+  TReadingView = record
+    FMessage: MessageView;
+    class function Create(const AMessage: MessageView): TReadingView; overload; static;
+    class function Create(const AValue: FieldValue): TReadingView; overload; static;
+    function GetValues: FieldCursor;
+    function GetWeights: FieldCursor;
+    function GetTags: FieldCursor;
+    function GetSamples: FieldCursor;
+    function GetFlags: FieldCursor;
+    function GetHistory: FieldCursor;
+    function HasName: Boolean;
+    function GetName: ByteSlice;
+  end;
+
+implementation
+
+const
+  CSampleFieldSeeds: array [0 .. 1] of Int32 = (
+    -1, -2
+  );
+  CSampleFieldNames: array [0 .. 1] of NamedValue = (
+    (FValue: 1; FName: 'time'),
+    (FValue: 2; FName: 'label')
+  );
+
+class function TSample.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CSampleFieldSeeds, CSampleFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+const
+  CReadingFieldSeeds: array [0 .. 6] of Int32 = (
+    0, -2, 1, -5, 1, 0, -6
+  );
+  CReadingFieldNames: array [0 .. 6] of NamedValue = (
+    (FValue: 2; FName: 'weights'),
+    (FValue: 1; FName: 'values'),
+    (FValue: 4; FName: 'samples'),
+    (FValue: 6; FName: 'history'),
+    (FValue: 7; FName: 'name'),
+    (FValue: 3; FName: 'tags'),
+    (FValue: 5; FName: 'flags')
+  );
+
+class function TReading.FindFieldTag(const AName: string): Integer;
+begin
+  if not PerfectHash.TryGetValue(CReadingFieldSeeds, CReadingFieldNames, AName, Result) then
+    Result := 0;
+end;
+
+function TBounded4SInt32.GetItem(AIndex: Integer): sint32;
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  Result := FItems[AIndex];
+end;
+
+procedure TBounded4SInt32.SetItem(AIndex: Integer; const AValue: sint32);
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  FItems[AIndex] := AValue;
+end;
+
+procedure TBounded4SInt32.Grow;
+begin
+  if FCount = Length(FItems) then
+    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);
+  Inc(FCount);
+end;
+
+procedure TBounded4SInt32.Add(const AValue: sint32);
+begin
+  Grow;
+  FItems[FCount - 1] := AValue;
+end;
+
+procedure TBounded4SInt32.Clear;
+begin
+  Self := Default(TBounded4SInt32); // releases the values, so that the decoders can append in place again
+end;
+
+function TBounded3Double.GetItem(AIndex: Integer): double;
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  Result := FItems[AIndex];
+end;
+
+procedure TBounded3Double.SetItem(AIndex: Integer; const AValue: double);
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  FItems[AIndex] := AValue;
+end;
+
+procedure TBounded3Double.Grow;
+begin
+  if FCount = Length(FItems) then
+    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);
+  Inc(FCount);
+end;
+
+procedure TBounded3Double.Add(const AValue: double);
+begin
+  Grow;
+  FItems[FCount - 1] := AValue;
+end;
+
+procedure TBounded3Double.Clear;
+begin
+  Self := Default(TBounded3Double); // releases the values, so that the decoders can append in place again
+end;
+
+function TBounded2String.GetItem(AIndex: Integer): string;
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  Result := FItems[AIndex];
+end;
+
+procedure TBounded2String.SetItem(AIndex: Integer; const AValue: string);
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  FItems[AIndex] := AValue;
+end;
+
+procedure TBounded2String.Grow;
+begin
+  if FCount = Length(FItems) then
+    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);
+  Inc(FCount);
+end;
+
+procedure TBounded2String.Add(const AValue: string);
+begin
+  Grow;
+  FItems[FCount - 1] := AValue;
+end;
+
+procedure TBounded2String.Clear;
+begin
+  Self := Default(TBounded2String); // releases the values, so that the decoders can append in place again
+end;
+
+function TBounded2Sample.GetItem(AIndex: Integer): TSample;
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  Result := FItems[AIndex];
+end;
+
+procedure TBounded2Sample.SetItem(AIndex: Integer; const AValue: TSample);
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  FItems[AIndex] := AValue;
+end;
+
+procedure TBounded2Sample.Grow;
+begin
+  if FCount = Length(FItems) then
+    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);
+  Inc(FCount);
+end;
+
+procedure TBounded2Sample.Add(const AValue: TSample);
+begin
+  Grow;
+  FItems[FCount - 1] := AValue;
+end;
+
+procedure TBounded2Sample.Clear;
+begin
+  Self := Default(TBounded2Sample); // releases the values, so that the decoders can append in place again
+end;
+
+function TBounded5Bool.GetItem(AIndex: Integer): bool;
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  Result := FItems[AIndex];
+end;
+
+procedure TBounded5Bool.SetItem(AIndex: Integer; const AValue: bool);
+begin
+  if Cardinal(AIndex) >= Cardinal(FCount) then
+    raise ESerialError.CreateFmt('Index out of bounds: %d', [AIndex]);
+  FItems[AIndex] := AValue;
+end;
+
+procedure TBounded5Bool.Grow;
+begin
+  if FCount = Length(FItems) then
+    raise ESerialError.CreateFmt('A bounded field holds at most %d values', [Length(FItems)]);
+  Inc(FCount);
+end;
+
+procedure TBounded5Bool.Add(const AValue: bool);
+begin
+  Grow;
+  FItems[FCount - 1] := AValue;
+end;
+
+procedure TBounded5Bool.Clear;
+begin
+  Self := Default(TBounded5Bool); // releases the values, so that the decoders can append in place again
+end;
+
+const
+  CTag1VarInt: EncodedTag = (FBytes: $08; FCount: 1);
+  CTag1LengthPrefixed: EncodedTag = (FBytes: $0A; FCount: 1);
+  CTag2LengthPrefixed: EncodedTag = (FBytes: $12; FCount: 1);
+  CTag3LengthPrefixed: EncodedTag = (FBytes: $1A; FCount: 1);
+  CTag4LengthPrefixed: EncodedTag = (FBytes: $22; FCount: 1);
+  CTag5LengthPrefixed: EncodedTag = (FBytes: $2A; FCount: 1);
+  CTag6LengthPrefixed: EncodedTag = (FBytes: $32; FCount: 1);
+  CTag7LengthPrefixed: EncodedTag = (FBytes: $3A; FCount: 1);
+
+procedure TSample.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TSample.EncodeTo(AWriter: TWriter);
+begin
+  if FTime <> 0 then
+    begin
+      AWriter.Pack(CTag1VarInt);
+      AWriter.Pack(VarInt(FTime));
+    end;
+  if FLabel <> '' then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(FLabel, AWriter.NextSize);
+    end;
+end;
+
+function TSample.ComputeSize(AWriter: TWriter): Integer;
+var
+  Size: Integer;
+begin
+  Result := 0;
+  if FTime <> 0 then
+    begin
+      Inc(Result, 1 + VarInt.ByteCount(FTime));
+    end;
+  if FLabel <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FLabel));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TSample.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.VarInt then
+            begin
+              AReader.Parse(VarIntValue);
+              FTime := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FLabel);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+procedure TReading.SerializeTo(AWriter: TWriter);
+begin
+  AWriter.ResetSizes;
+  AWriter.Require(ComputeSize(AWriter) + TWriter.CTagSlack); // grow the stream once for the whole message
+  EncodeTo(AWriter);
+  AWriter.Truncate;
+end;
+
+procedure TReading.EncodeTo(AWriter: TWriter);
+var
+  I: Integer;
+begin
+  if FValues.FCount > 0 then
+    begin
+      AWriter.Pack(CTag1LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to FValues.FCount - 1 do
+        AWriter.Pack(SignedInt(Int32(FValues.FItems[I])));
+    end;
+  if FWeights.FCount > 0 then
+    begin
+      AWriter.Pack(CTag2LengthPrefixed);
+      AWriter.Pack(VarInt(FWeights.FCount * 8));
+      for I := 0 to FWeights.FCount - 1 do
+        AWriter.Pack(FixedInt64(FWeights.FItems[I]));
+    end;
+  for I := 0 to FTags.FCount - 1 do
+    begin
+      AWriter.Pack(CTag3LengthPrefixed);
+      AWriter.Pack(FTags.FItems[I], AWriter.NextSize);
+    end;
+  for I := 0 to FSamples.FCount - 1 do
+    begin
+      AWriter.Pack(CTag4LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      FSamples.FItems[I].EncodeTo(AWriter);
+    end;
+  if FFlags.FCount > 0 then
+    begin
+      AWriter.Pack(CTag5LengthPrefixed);
+      AWriter.Pack(VarInt(FFlags.FCount * 1));
+      for I := 0 to FFlags.FCount - 1 do
+        AWriter.Pack(VarInt(Ord(FFlags.FItems[I])));
+    end;
+  if Length(FHistory) > 0 then
+    begin
+      AWriter.Pack(CTag6LengthPrefixed);
+      AWriter.Pack(VarInt(AWriter.NextSize));
+      for I := 0 to High(FHistory) do
+        AWriter.Pack(VarInt(FHistory[I]));
+    end;
+  if FName <> '' then
+    begin
+      AWriter.Pack(CTag7LengthPrefixed);
+      AWriter.Pack(FName, AWriter.NextSize);
+    end;
+end;
+
+function TReading.ComputeSize(AWriter: TWriter): Integer;
+var
+  I: Integer;
+  Slot: Integer;
+  Size: Integer;
+begin
+  Result := 0;
+  if FValues.FCount > 0 then
+    begin
+      Size := 0;
+      for I := 0 to FValues.FCount - 1 do
+        Inc(Size, SignedInt.ByteCount(Int32(FValues.FItems[I])));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FWeights.FCount > 0 then
+    begin
+      Size := FWeights.FCount * 8;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to FTags.FCount - 1 do
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FTags.FItems[I]));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  for I := 0 to FSamples.FCount - 1 do
+    begin
+      Slot := AWriter.ReserveSize;
+      Size := AWriter.StoreSize(Slot, FSamples.FItems[I].ComputeSize(AWriter));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FFlags.FCount > 0 then
+    begin
+      Size := FFlags.FCount * 1;
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if Length(FHistory) > 0 then
+    begin
+      Size := 0;
+      for I := 0 to High(FHistory) do
+        Inc(Size, VarInt.ByteCount(FHistory[I]));
+      AWriter.StoreSize(Size);
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+  if FName <> '' then
+    begin
+      Size := AWriter.StoreSize(TWriter.ByteCount(FName));
+      Inc(Result, 1 + VarInt.ByteCount(Size) + Size);
+    end;
+end;
+
+procedure TReading.ParseFrom(AReader: TReader);
+var
+  WireType: TWireType;
+  Tag: FieldTag;
+  Fixed64Value: FixedInt64;
+  SignedIntValue: SignedInt;
+  VarIntValue: VarInt;
+begin
+  while not AReader.AtEnd do
+    begin
+      AReader.Parse(WireType, Tag);
+      case Tag of
+        1:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  FValues.Grow;
+                  AReader.Parse(SignedIntValue);
+                  FValues.FItems[FValues.FCount - 1] := Int32(SignedIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              FValues.Grow;
+              AReader.Parse(SignedIntValue);
+              FValues.FItems[FValues.FCount - 1] := Int32(SignedIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        2:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  FWeights.Grow;
+                  AReader.Parse(Fixed64Value);
+                  FWeights.FItems[FWeights.FCount - 1] := Double(Fixed64Value);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.Fixed64 then
+            begin
+              FWeights.Grow;
+              AReader.Parse(Fixed64Value);
+              FWeights.FItems[FWeights.FCount - 1] := Double(Fixed64Value);
+            end
+          else
+            AReader.SkipField(WireType);
+        3:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FTags.Grow;
+              AReader.Parse(FTags.FItems[FTags.FCount - 1]);
+            end
+          else
+            AReader.SkipField(WireType);
+        4:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              FSamples.Grow;
+              AReader.BeginLengthPrefixed;
+              FSamples.FItems[FSamples.FCount - 1].ParseFrom(AReader);
+              AReader.EndLengthPrefixed;
+            end
+          else
+            AReader.SkipField(WireType);
+        5:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  FFlags.Grow;
+                  AReader.Parse(VarIntValue);
+                  FFlags.FItems[FFlags.FCount - 1] := UInt64(VarIntValue) <> 0;
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              FFlags.Grow;
+              AReader.Parse(VarIntValue);
+              FFlags.FItems[FFlags.FCount - 1] := UInt64(VarIntValue) <> 0;
+            end
+          else
+            AReader.SkipField(WireType);
+        6:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.BeginLengthPrefixed;
+              while not AReader.AtEnd do
+                begin
+                  SetLength(FHistory, Length(FHistory) + 1);
+                  AReader.Parse(VarIntValue);
+                  FHistory[High(FHistory)] := Int32(VarIntValue);
+                end;
+              AReader.EndLengthPrefixed;
+            end
+          else if WireType = TWireType.VarInt then
+            begin
+              SetLength(FHistory, Length(FHistory) + 1);
+              AReader.Parse(VarIntValue);
+              FHistory[High(FHistory)] := Int32(VarIntValue);
+            end
+          else
+            AReader.SkipField(WireType);
+        7:
+          if WireType = TWireType.LengthPrefixed then
+            begin
+              AReader.Parse(FName);
+            end
+          else
+            AReader.SkipField(WireType);
+      else
+        AReader.SkipField(WireType);
+      end;
+    end;
+end;
+
+class function TSampleView.Create(const AMessage: MessageView): TSampleView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TSampleView.Create(const AValue: FieldValue): TSampleView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TSampleView.HasTime: Boolean;
+begin
+  Result := FMessage.Contains(1, TWireType.VarInt);
+end;
+
+function TSampleView.GetTime: int32;
+begin
+  Result := FMessage.Find(1, TWireType.VarInt).AsInt32;
+end;
+
+function TSampleView.HasLabel: Boolean;
+begin
+  Result := FMessage.Contains(2, TWireType.LengthPrefixed);
+end;
+
+function TSampleView.GetLabel: ByteSlice;
+begin
+  Result := FMessage.Find(2, TWireType.LengthPrefixed).AsSlice;
+end;
+
+class function TReadingView.Create(const AMessage: MessageView): TReadingView;
+begin
+  Result.FMessage := AMessage;
+end;
+
+class function TReadingView.Create(const AValue: FieldValue): TReadingView;
+begin
+  Result.FMessage := MessageView.Create(AValue.AsSlice);
+end;
+
+function TReadingView.GetValues: FieldCursor;
+begin
+  Result := FMessage.Values(1, TWireType.VarInt);
+end;
+
+function TReadingView.GetWeights: FieldCursor;
+begin
+  Result := FMessage.Values(2, TWireType.Fixed64);
+end;
+
+function TReadingView.GetTags: FieldCursor;
+begin
+  Result := FMessage.Values(3, TWireType.LengthPrefixed);
+end;
+
+function TReadingView.GetSamples: FieldCursor;
+begin
+  Result := FMessage.Values(4, TWireType.LengthPrefixed);
+end;
+
+function TReadingView.GetFlags: FieldCursor;
+begin
+  Result := FMessage.Values(5, TWireType.VarInt);
+end;
+
+function TReadingView.GetHistory: FieldCursor;
+begin
+  Result := FMessage.Values(6, TWireType.VarInt);
+end;
+
+function TReadingView.HasName: Boolean;
+begin
+  Result := FMessage.Contains(7, TWireType.LengthPrefixed);
+end;
+
+function TReadingView.GetName: ByteSlice;
+begin
+  Result := FMessage.Find(7, TWireType.LengthPrefixed).AsSlice;
+end;
+
+initialization
+
+TSample.Table := MessageTable.Create(TypeInfo(TSample), [
+  FieldEntry.Create(1, TFieldKind.Int32, [], @TSample(nil^).FTime),
+  FieldEntry.Create(2, TFieldKind.&String, [], @TSample(nil^).FLabel)]);
+TReading.Table := MessageTable.Create(TypeInfo(TReading), [
+  FieldEntry.Create(1, TFieldKind.SInt32, [TFieldFlag.Repeated, TFieldFlag.&Packed, TFieldFlag.Bounded], @TReading(nil^).FValues.FItems, nil, nil, @TReading(nil^).FValues.FCount, 4),
+  FieldEntry.Create(2, TFieldKind.Double, [TFieldFlag.Repeated, TFieldFlag.&Packed, TFieldFlag.Bounded], @TReading(nil^).FWeights.FItems, nil, nil, @TReading(nil^).FWeights.FCount, 3),
+  FieldEntry.Create(3, TFieldKind.&String, [TFieldFlag.Repeated, TFieldFlag.Bounded], @TReading(nil^).FTags.FItems, nil, nil, @TReading(nil^).FTags.FCount, 2),
+  FieldEntry.Create(4, TFieldKind.Message, [TFieldFlag.Repeated, TFieldFlag.Bounded], @TReading(nil^).FSamples.FItems, nil, @TSample.Table, @TReading(nil^).FSamples.FCount, 2),
+  FieldEntry.Create(5, TFieldKind.Bool, [TFieldFlag.Repeated, TFieldFlag.&Packed, TFieldFlag.Bounded], @TReading(nil^).FFlags.FItems, nil, nil, @TReading(nil^).FFlags.FCount, 5),
+  FieldEntry.Create(6, TFieldKind.Int32, [TFieldFlag.Repeated, TFieldFlag.&Packed], @TReading(nil^).FHistory, TypeInfo(TArray<int32>), nil),
+  FieldEntry.Create(7, TFieldKind.&String, [], @TReading(nil^).FName)]);
+
+end.